@@ -0,0 +1,50 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_ALIGNEDALLOCATOR_H
+#define JASON_ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+
+/// @brief The alignment (in bytes) used for numeric buffers. This matches a cache line, and is wide enough for any SIMD register we target.
+constexpr size_t NumericAlignment = 64;
+
+/// @brief A standard-library compatible allocator that returns memory aligned to `Alignment` bytes.
+/// @tparam T The type being allocated
+/// @tparam Alignment The byte alignment of every allocation. Must be a power of two.
+template<typename T, size_t Alignment = NumericAlignment>
+class AlignedAllocator
+{
+public:
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept { }
+
+    [[nodiscard]] T* allocate(size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T* p, size_t) noexcept
+    {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+#endif //JASON_ALIGNEDALLOCATOR_H
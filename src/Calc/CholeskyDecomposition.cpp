@@ -0,0 +1,167 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "CholeskyDecomposition.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    //The number of columns factored at a time before the trailing submatrix is updated with a GEMM.
+    constexpr size_t BlockSize = 64;
+}
+
+CholeskyDecomposition::CholeskyDecomposition(const Matrix& A) : Factor(A)
+{
+    if (!A.IsValid())
+        throw OperationError("Cholesky decomposition", "empty matrix");
+    if (!A.IsSquare())
+        throw OperationError("Cholesky decomposition", "the matrix must be square");
+
+    Factorize();
+}
+
+void CholeskyDecomposition::Factorize()
+{
+    size_t n = Factor.Rows();
+    const auto& simd = SimdKernels();
+
+    /*
+     * Right looking blocked Cholesky, on the lower triangle. For each block of columns:
+     *  1. Factor the diagonal block, A11 = L11 * L11^T.
+     *  2. Solve L21 * L11^T = A21 for the panel below it.
+     *  3. Update the trailing submatrix, A22 -= L21 * L21^T, through GEMM. Only the lower triangle of A22 is ever read, so the
+     *     update is done one block row at a time, stopping at the diagonal, which skips almost half the work of a full product.
+     */
+    for (size_t k0 = 0; k0 < n; k0 += BlockSize)
+    {
+        size_t kb = std::min(BlockSize, n - k0), next = k0 + kb;
+        FactorizeDiagonalBlock(k0, kb);
+
+        if (next == n)
+            break;
+
+        for (size_t i = next; i < n; i++)
+        {
+            double* row = Factor.RowData(i);
+            for (size_t j = k0; j < next; j++)
+            {
+                const double* l = Factor.RowData(j);
+                row[j] = (row[j] - simd.Dot(row + k0, l + k0, j - k0)) / l[j];
+            }
+        }
+
+        for (size_t i0 = next; i0 < n; i0 += BlockSize)
+        {
+            size_t ib = std::min(BlockSize, n - i0), width = i0 + ib - next;
+            ViewMultiply(Factor.Block(i0, next, ib, width),
+                         Factor.Block(i0, k0, ib, kb),
+                         Factor.Block(next, k0, width, kb).Transposed(),
+                         -1.0, 1.0);
+        }
+    }
+
+    for (size_t i = 0; i + 1 < n; i++)
+        std::fill(Factor.RowData(i) + i + 1, Factor.RowData(i) + n, 0.0);
+}
+void CholeskyDecomposition::FactorizeDiagonalBlock(size_t Start, size_t Width)
+{
+    const auto& simd = SimdKernels();
+
+    for (size_t j = Start; j < Start + Width; j++)
+    {
+        double* pivotRow = Factor.RowData(j);
+        double diag = pivotRow[j] - simd.Dot(pivotRow + Start, pivotRow + Start, j - Start);
+        if (!(diag > 0)) //Also catches NaN.
+            throw OperationError("Cholesky decomposition", "the matrix is not positive definite");
+
+        pivotRow[j] = std::sqrt(diag);
+        for (size_t i = j + 1; i < Start + Width; i++)
+        {
+            double* row = Factor.RowData(i);
+            row[j] = (row[j] - simd.Dot(row + Start, pivotRow + Start, j - Start)) / pivotRow[j];
+        }
+    }
+}
+
+double CholeskyDecomposition::Determinant() const noexcept
+{
+    double result = 1;
+    for (size_t i = 0; i < Size(); i++)
+        result *= Factor.RowData(i)[i];
+
+    return result * result;
+}
+double CholeskyDecomposition::LogDeterminant() const noexcept
+{
+    double result = 0;
+    for (size_t i = 0; i < Size(); i++)
+        result += std::log(Factor.RowData(i)[i]);
+
+    return 2 * result;
+}
+Matrix CholeskyDecomposition::Inverse() const
+{
+    return Solve(Matrix::Identity(Size()));
+}
+
+MathVector CholeskyDecomposition::Solve(const MathVector& b) const
+{
+    if (b.Dim() != Size())
+        throw OperationError("solve", "dimension mismatch");
+
+    size_t n = Size();
+    const auto& simd = SimdKernels();
+    MathVector x(b);
+    double* y = x.data();
+
+    //L * y = b
+    for (size_t i = 0; i < n; i++)
+    {
+        const double* l = Factor.RowData(i);
+        y[i] = (y[i] - simd.Dot(l, y, i)) / l[i];
+    }
+    //L^T * x = y. Row i of L is column i of L^T, so once x[i] is known it is subtracted from everything above it in one pass.
+    for (size_t i = n; i-- > 0; )
+    {
+        const double* l = Factor.RowData(i);
+        y[i] /= l[i];
+        simd.Axpy(y, -y[i], l, i);
+    }
+
+    return x;
+}
+Matrix CholeskyDecomposition::Solve(const Matrix& B) const
+{
+    if (B.Rows() != Size())
+        throw OperationError("solve", "dimension mismatch");
+
+    size_t n = Size(), m = B.Columns();
+    const auto& simd = SimdKernels();
+    Matrix X(B);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const double* l = Factor.RowData(i);
+        double* row = X.RowData(i);
+        for (size_t k = 0; k < i; k++)
+            if (l[k] != 0)
+                simd.Axpy(row, -l[k], X.RowData(k), m);
+
+        simd.Divide(row, l[i], m);
+    }
+    for (size_t i = n; i-- > 0; )
+    {
+        const double* l = Factor.RowData(i);
+        double* row = X.RowData(i);
+        simd.Divide(row, l[i], m);
+        for (size_t k = 0; k < i; k++)
+            if (l[k] != 0)
+                simd.Axpy(X.RowData(k), -l[k], row, m);
+    }
+
+    return X;
+}
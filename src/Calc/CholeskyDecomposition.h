@@ -0,0 +1,52 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_CHOLESKYDECOMPOSITION_H
+#define JASON_CHOLESKYDECOMPOSITION_H
+
+#include "Matrix.h"
+#include "MathVector.h"
+
+/// <summary>
+/// The factorization A = L * L^T of a symmetric positive definite matrix, where L is lower triangular with a positive diagonal.
+/// It costs half the work of LU, needs no pivoting, and doubles as the cheapest test of positive definiteness.
+/// </summary>
+class CholeskyDecomposition
+{
+private:
+    /// <summary>
+    /// L on and below the diagonal. The upper triangle is left zero.
+    /// </summary>
+    Matrix Factor;
+
+    void Factorize();
+    void FactorizeDiagonalBlock(size_t Start, size_t Width);
+
+public:
+    /// <summary>
+    /// Factors the matrix, reading only its lower triangle (the upper triangle is assumed to mirror it). Throws if the matrix is empty, not square, or not positive definite.
+    /// </summary>
+    explicit CholeskyDecomposition(const Matrix& A);
+
+    [[nodiscard]] size_t Size() const noexcept { return Factor.Rows(); }
+    [[nodiscard]] const Matrix& L() const noexcept { return Factor; }
+
+    [[nodiscard]] double Determinant() const noexcept;
+    /// <summary>
+    /// The natural log of the determinant, which does not overflow or underflow for large matrices.
+    /// </summary>
+    [[nodiscard]] double LogDeterminant() const noexcept;
+    [[nodiscard]] Matrix Inverse() const;
+
+    /// <summary>
+    /// Solves Ax = b for x.
+    /// </summary>
+    [[nodiscard]] MathVector Solve(const MathVector& b) const;
+    /// <summary>
+    /// Solves AX = B for X, treating every column of B as its own right hand side.
+    /// </summary>
+    [[nodiscard]] Matrix Solve(const Matrix& B) const;
+};
+
+#endif //JASON_CHOLESKYDECOMPOSITION_H
@@ -91,6 +91,20 @@ void Complex::str_deserialize(std::istream& in)
     
     in >> this->a >> this->b;
 }
+size_t Complex::bin_size() const noexcept
+{
+    return 2 * sizeof(double);
+}
+void Complex::bin_serialize(BinaryWriter& out) const
+{
+    out.Write(this->a);
+    out.Write(this->b);
+}
+void Complex::bin_deserialize(BinaryReader& in)
+{
+    this->a = in.Read<double>();
+    this->b = in.Read<double>();
+}
 
 std::unique_ptr<VariableType> Complex::Clone() const noexcept
 {
@@ -31,6 +31,9 @@ public:
     [[nodiscard]] VariableTypes GetType() const noexcept override { return VT_Complex; }
     void str_serialize(std::ostream& out) const noexcept override;
     void str_deserialize(std::istream& in) override;
+    [[nodiscard]] size_t bin_size() const noexcept override;
+    void bin_serialize(BinaryWriter& out) const override;
+    void bin_deserialize(BinaryReader& in) override;
     void dbg_fmt(std::ostream& out) const noexcept override;
     void dsp_fmt(std::ostream& out) const noexcept override;
     
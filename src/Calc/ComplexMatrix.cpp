@@ -0,0 +1,173 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "ComplexMatrix.h"
+#include "Gemm.h"
+#include "SimdKernels.h"
+#include "../Core/Errors.h"
+
+#include <cmath>
+#include <utility>
+
+ComplexMatrix::ComplexMatrix(size_t Rows, size_t Columns) noexcept : Re(Rows, Columns), Im(Rows, Columns)
+{
+
+}
+ComplexMatrix::ComplexMatrix(const Matrix& Real) : Re(Real), Im(Real.Rows(), Real.Columns())
+{
+
+}
+ComplexMatrix::ComplexMatrix(Matrix Real, Matrix Imag) : Re(std::move(Real)), Im(std::move(Imag))
+{
+    if (Re.Rows() != Im.Rows() || Re.Columns() != Im.Columns())
+        throw OperationError("complex matrix", "the real and imaginary parts must have the same dimensions");
+}
+
+ComplexMatrix ComplexMatrix::Identity(size_t Size)
+{
+    return ComplexMatrix(Matrix::Identity(Size));
+}
+
+Complex ComplexMatrix::Get(size_t i, size_t j) const
+{
+    return { Re.Access(i, j), Im.Access(i, j) };
+}
+void ComplexMatrix::Set(size_t i, size_t j, const Complex& Value)
+{
+    Re.Access(i, j) = Value.a;
+    Im.Access(i, j) = Value.b;
+}
+
+ComplexMatrix ComplexMatrix::Transpose() const
+{
+    return { Re.Transpose(), Im.Transpose() };
+}
+ComplexMatrix ComplexMatrix::ConjugateTranspose() const
+{
+    ComplexMatrix result = Transpose();
+    result.Conjugate();
+    return result;
+}
+void ComplexMatrix::Conjugate()
+{
+    if (Im.IsValid())
+        Im *= -1.0;
+}
+double ComplexMatrix::FrobeniusNorm() const noexcept
+{
+    return std::hypot(Re.FrobeniusNorm(), Im.FrobeniusNorm());
+}
+
+void ComplexMatrix::RequireSameShape(const ComplexMatrix& Other, char Operator) const
+{
+    if (!this->IsValid() || !Other.IsValid())
+        throw OperatorError(Operator, this->GetTypeString(), Other.GetTypeString(), "empty matrix");
+    if (this->Rows() != Other.Rows() || this->Columns() != Other.Columns())
+        throw OperatorError(Operator, this->GetTypeString(), Other.GetTypeString(), "dimension mismatch");
+}
+
+ComplexMatrix ComplexMatrix::operator+(const ComplexMatrix& Two) const
+{
+    ComplexMatrix result(*this);
+    result += Two;
+    return result;
+}
+ComplexMatrix ComplexMatrix::operator-(const ComplexMatrix& Two) const
+{
+    ComplexMatrix result(*this);
+    result -= Two;
+    return result;
+}
+ComplexMatrix ComplexMatrix::operator*(const ComplexMatrix& Two) const
+{
+    if (!this->IsValid() || !Two.IsValid())
+        throw OperatorError('*', this->GetTypeString(), Two.GetTypeString(), "empty matrix");
+    if (this->Columns() != Two.Rows())
+        throw OperatorError('*', this->GetTypeString(), Two.GetTypeString(), "dimension mismatch");
+
+    size_t m = this->Rows(), n = Two.Columns(), k = this->Columns();
+    size_t lda = Re.LeadingDimension(), ldb = Two.Re.LeadingDimension();
+    ComplexMatrix result(m, n);
+    size_t ldc = result.Re.LeadingDimension();
+
+    //(Ar + Ai i)(Br + Bi i) = (Ar Br - Ai Bi) + (Ar Bi + Ai Br) i
+    Gemm(m, n, k, 1.0, Re.RowData(0), lda, Two.Re.RowData(0), ldb, 0.0, result.Re.RowData(0), ldc);
+    Gemm(m, n, k, -1.0, Im.RowData(0), lda, Two.Im.RowData(0), ldb, 1.0, result.Re.RowData(0), ldc);
+    Gemm(m, n, k, 1.0, Re.RowData(0), lda, Two.Im.RowData(0), ldb, 0.0, result.Im.RowData(0), ldc);
+    Gemm(m, n, k, 1.0, Im.RowData(0), lda, Two.Re.RowData(0), ldb, 1.0, result.Im.RowData(0), ldc);
+
+    return result;
+}
+ComplexVector ComplexMatrix::operator*(const ComplexVector& Two) const
+{
+    if (!this->IsValid() || !Two.IsValid())
+        throw OperatorError('*', this->GetTypeString(), Two.GetTypeString(), "empty operand");
+    if (this->Columns() != Two.Size())
+        throw OperatorError('*', this->GetTypeString(), Two.GetTypeString(), "dimension mismatch");
+
+    const auto& simd = SimdKernels();
+    size_t n = this->Columns();
+    ComplexVector result(this->Rows());
+    for (size_t i = 0; i < this->Rows(); i++)
+    {
+        const double* ar = Re.RowData(i), * ai = Im.RowData(i);
+        result.Real()[i] = simd.Dot(ar, Two.Real(), n) - simd.Dot(ai, Two.Imag(), n);
+        result.Imag()[i] = simd.Dot(ar, Two.Imag(), n) + simd.Dot(ai, Two.Real(), n);
+    }
+
+    return result;
+}
+ComplexMatrix ComplexMatrix::operator*(const Complex& Fac) const
+{
+    ComplexMatrix result(*this);
+    result *= Fac;
+    return result;
+}
+ComplexMatrix ComplexMatrix::operator*(double Fac) const
+{
+    ComplexMatrix result(*this);
+    result *= Fac;
+    return result;
+}
+
+ComplexMatrix& ComplexMatrix::operator+=(const ComplexMatrix& Two)
+{
+    RequireSameShape(Two, '+');
+
+    Re += Two.Re;
+    Im += Two.Im;
+    return *this;
+}
+ComplexMatrix& ComplexMatrix::operator-=(const ComplexMatrix& Two)
+{
+    RequireSameShape(Two, '-');
+
+    Re -= Two.Re;
+    Im -= Two.Im;
+    return *this;
+}
+ComplexMatrix& ComplexMatrix::operator*=(const ComplexMatrix& Two)
+{
+    //As with Matrix, the product cannot be formed in place.
+    *this = *this * Two;
+    return *this;
+}
+ComplexMatrix& ComplexMatrix::operator*=(const Complex& Fac)
+{
+    if (!this->IsValid())
+        throw OperatorError('*', this->GetTypeString(), Fac.GetTypeString(), "empty matrix");
+
+    //Row by row, so that the padding of both halves stays zero.
+    const auto& simd = SimdKernels();
+    for (size_t i = 0; i < this->Rows(); i++)
+        simd.ComplexScale(Re.RowData(i), Im.RowData(i), Fac.a, Fac.b, this->Columns());
+
+    return *this;
+}
+ComplexMatrix& ComplexMatrix::operator*=(double Fac)
+{
+    Re *= Fac;
+    Im *= Fac;
+    return *this;
+}
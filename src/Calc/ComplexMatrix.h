@@ -0,0 +1,85 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_COMPLEXMATRIX_H
+#define JASON_COMPLEXMATRIX_H
+
+#include "Matrix.h"
+#include "Complex.h"
+#include "ComplexVector.h"
+
+#include <string>
+
+/// <summary>
+/// A dense complex matrix, stored as two real matrices: one for the real parts and one for the imaginary parts.
+/// Both halves keep the Matrix layout (aligned, padded rows), so they can be viewed, transposed, and multiplied with the real routines.
+/// The product A * B is formed from four real GEMMs: Re = Ar Br - Ai Bi, and Im = Ar Bi + Ai Br.
+/// </summary>
+class ComplexMatrix
+{
+private:
+    Matrix Re;
+    Matrix Im;
+
+    void RequireSameShape(const ComplexMatrix& Other, char Operator) const;
+
+public:
+    /// <summary>
+    /// Creates a zero matrix.
+    /// </summary>
+    ComplexMatrix(size_t Rows, size_t Columns) noexcept;
+    /// <summary>
+    /// Copies a real matrix, with every imaginary part zero.
+    /// </summary>
+    explicit ComplexMatrix(const Matrix& Real);
+    /// <summary>
+    /// Takes the real and imaginary parts as two matrices. Throws if their shapes differ.
+    /// </summary>
+    ComplexMatrix(Matrix Real, Matrix Imag);
+
+    [[nodiscard]] static ComplexMatrix Identity(size_t Size);
+
+    [[nodiscard]] size_t Rows() const noexcept { return Re.Rows(); }
+    [[nodiscard]] size_t Columns() const noexcept { return Re.Columns(); }
+    [[nodiscard]] bool IsValid() const noexcept { return Re.IsValid(); }
+    [[nodiscard]] bool IsSquare() const noexcept { return Re.IsSquare(); }
+    [[nodiscard]] std::string GetTypeString() const { return "(ComplexMatrix:" + std::to_string(Rows()) + "x" + std::to_string(Columns()) + ")"; }
+
+    [[nodiscard]] const Matrix& Real() const noexcept { return Re; }
+    [[nodiscard]] Matrix& Real() noexcept { return Re; }
+    [[nodiscard]] const Matrix& Imag() const noexcept { return Im; }
+    [[nodiscard]] Matrix& Imag() noexcept { return Im; }
+
+    [[nodiscard]] Complex Get(size_t i, size_t j) const;
+    void Set(size_t i, size_t j, const Complex& Value);
+
+    /// <summary>
+    /// The transpose, without conjugation.
+    /// </summary>
+    [[nodiscard]] ComplexMatrix Transpose() const;
+    /// <summary>
+    /// The conjugate transpose (Hermitian adjoint), A^H.
+    /// </summary>
+    [[nodiscard]] ComplexMatrix ConjugateTranspose() const;
+    /// <summary>
+    /// Replaces every element with its complex conjugate.
+    /// </summary>
+    void Conjugate();
+    [[nodiscard]] double FrobeniusNorm() const noexcept;
+
+    ComplexMatrix operator+(const ComplexMatrix& Two) const;
+    ComplexMatrix operator-(const ComplexMatrix& Two) const;
+    ComplexMatrix operator*(const ComplexMatrix& Two) const;
+    ComplexVector operator*(const ComplexVector& Two) const;
+    ComplexMatrix operator*(const Complex& Fac) const;
+    ComplexMatrix operator*(double Fac) const;
+
+    ComplexMatrix& operator+=(const ComplexMatrix& Two);
+    ComplexMatrix& operator-=(const ComplexMatrix& Two);
+    ComplexMatrix& operator*=(const ComplexMatrix& Two);
+    ComplexMatrix& operator*=(const Complex& Fac);
+    ComplexMatrix& operator*=(double Fac);
+};
+
+#endif //JASON_COMPLEXMATRIX_H
@@ -0,0 +1,206 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "ComplexVector.h"
+#include "SimdKernels.h"
+#include "../Core/Errors.h"
+
+#include <algorithm>
+#include <cmath>
+
+ComplexVector::ComplexVector(size_t Size, const Complex& Value) : Re(Size, Value.a), Im(Size, Value.b)
+{
+
+}
+ComplexVector::ComplexVector(const std::vector<Complex>& Values) : Re(Values.size()), Im(Values.size())
+{
+    for (size_t i = 0; i < Values.size(); i++)
+    {
+        Re[i] = Values[i].a;
+        Im[i] = Values[i].b;
+    }
+}
+
+ComplexVector ComplexVector::FromParts(const double* Real, const double* Imag, size_t Count)
+{
+    ComplexVector result(Count);
+    std::copy_n(Real, Count, result.Re.data());
+    if (Imag)
+        std::copy_n(Imag, Count, result.Im.data());
+
+    return result;
+}
+std::vector<Complex> ComplexVector::ToComplex() const
+{
+    std::vector<Complex> result;
+    result.reserve(Size());
+    for (size_t i = 0; i < Size(); i++)
+        result.emplace_back(Re[i], Im[i]);
+
+    return result;
+}
+
+Complex ComplexVector::Get(size_t i) const
+{
+    if (i >= Size())
+        throw std::logic_error("Out of range");
+
+    return { Re[i], Im[i] };
+}
+void ComplexVector::Set(size_t i, const Complex& Value)
+{
+    if (i >= Size())
+        throw std::logic_error("Out of range");
+
+    Re[i] = Value.a;
+    Im[i] = Value.b;
+}
+
+void ComplexVector::RequireSameSize(const ComplexVector& Other, char Operator) const
+{
+    if (!this->IsValid() || !Other.IsValid())
+        throw OperatorError(Operator, this->GetTypeString(), Other.GetTypeString(), "empty vector");
+    if (this->Size() != Other.Size())
+        throw OperatorError(Operator, this->GetTypeString(), Other.GetTypeString(), "dimension mismatch");
+}
+
+ComplexVector ComplexVector::operator+(const ComplexVector& Two) const
+{
+    ComplexVector result(*this);
+    result += Two;
+    return result;
+}
+ComplexVector ComplexVector::operator-(const ComplexVector& Two) const
+{
+    ComplexVector result(*this);
+    result -= Two;
+    return result;
+}
+ComplexVector ComplexVector::operator*(const ComplexVector& Two) const
+{
+    ComplexVector result(*this);
+    result *= Two;
+    return result;
+}
+ComplexVector ComplexVector::operator/(const ComplexVector& Two) const
+{
+    ComplexVector result(*this);
+    result /= Two;
+    return result;
+}
+ComplexVector ComplexVector::operator*(const Complex& Fac) const
+{
+    ComplexVector result(*this);
+    result *= Fac;
+    return result;
+}
+ComplexVector ComplexVector::operator*(double Fac) const
+{
+    ComplexVector result(*this);
+    result *= Fac;
+    return result;
+}
+
+ComplexVector& ComplexVector::operator+=(const ComplexVector& Two)
+{
+    RequireSameSize(Two, '+');
+
+    const auto& simd = SimdKernels();
+    simd.Add(Re.data(), Two.Re.data(), Size());
+    simd.Add(Im.data(), Two.Im.data(), Size());
+    return *this;
+}
+ComplexVector& ComplexVector::operator-=(const ComplexVector& Two)
+{
+    RequireSameSize(Two, '-');
+
+    const auto& simd = SimdKernels();
+    simd.Subtract(Re.data(), Two.Re.data(), Size());
+    simd.Subtract(Im.data(), Two.Im.data(), Size());
+    return *this;
+}
+ComplexVector& ComplexVector::operator*=(const ComplexVector& Two)
+{
+    RequireSameSize(Two, '*');
+
+    SimdKernels().ComplexMultiply(Re.data(), Im.data(), Two.Re.data(), Two.Im.data(), Size());
+    return *this;
+}
+ComplexVector& ComplexVector::operator/=(const ComplexVector& Two)
+{
+    RequireSameSize(Two, '/');
+
+    SimdKernels().ComplexDivide(Re.data(), Im.data(), Two.Re.data(), Two.Im.data(), Size());
+    return *this;
+}
+ComplexVector& ComplexVector::operator*=(const Complex& Fac)
+{
+    SimdKernels().ComplexScale(Re.data(), Im.data(), Fac.a, Fac.b, Size());
+    return *this;
+}
+ComplexVector& ComplexVector::operator*=(double Fac)
+{
+    const auto& simd = SimdKernels();
+    simd.Scale(Re.data(), Fac, Size());
+    simd.Scale(Im.data(), Fac, Size());
+    return *this;
+}
+ComplexVector& ComplexVector::operator/=(const Complex& Fac)
+{
+    if (Fac.a == 0 && Fac.b == 0)
+        throw OperatorError('/', this->GetTypeString(), Fac.GetTypeString(), "magnitude of second operand is zero");
+
+    //One complex division, then a multiply per element.
+    double s = 1.0 / std::fmax(std::fabs(Fac.a), std::fabs(Fac.b));
+    double re = Fac.a * s, im = Fac.b * s;
+    double f = s / (re * re + im * im);
+    return *this *= Complex(re * f, -im * f);
+}
+
+void ComplexVector::Conjugate() noexcept
+{
+    SimdKernels().Scale(Im.data(), -1.0, Size());
+}
+std::vector<double> ComplexVector::Abs() const
+{
+    std::vector<double> result(Size());
+    SimdKernels().ComplexAbs(result.data(), Re.data(), Im.data(), Size());
+    return result;
+}
+double ComplexVector::Norm() const noexcept
+{
+    const auto& simd = SimdKernels();
+    size_t n = Size();
+    double sum = simd.Dot(Re.data(), Re.data(), n) + simd.Dot(Im.data(), Im.data(), n);
+    if (std::isfinite(sum) && sum >= 0x1p-900)
+        return std::sqrt(sum);
+
+    //The squares overflowed, or the small ones underflowed, so the sum is taken again relative to the largest part.
+    double scale = 0;
+    for (size_t i = 0; i < n; i++)
+        scale = std::fmax(scale, std::fmax(std::fabs(Re[i]), std::fabs(Im[i])));
+    if (scale == 0 || std::isinf(scale))
+        return scale;
+
+    double scaled = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        double re = Re[i] / scale, im = Im[i] / scale;
+        scaled += re * re + im * im;
+    }
+
+    return scale * std::sqrt(scaled);
+}
+
+Complex ComplexVector::DotProduct(const ComplexVector& One, const ComplexVector& Two)
+{
+    One.RequireSameSize(Two, '.');
+
+    //conj(a + bi) * (c + di) = (ac + bd) + (ad - bc)i
+    const auto& simd = SimdKernels();
+    size_t n = One.Size();
+    double re = simd.Dot(One.Re.data(), Two.Re.data(), n) + simd.Dot(One.Im.data(), Two.Im.data(), n);
+    double im = simd.Dot(One.Re.data(), Two.Im.data(), n) - simd.Dot(One.Im.data(), Two.Re.data(), n);
+    return { re, im };
+}
@@ -0,0 +1,96 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_COMPLEXVECTOR_H
+#define JASON_COMPLEXVECTOR_H
+
+#include "Complex.h"
+#include "AlignedAllocator.h"
+
+#include <string>
+#include <vector>
+
+/// <summary>
+/// A dense array of complex numbers, stored split: all of the real parts in one aligned array, and all of the imaginary parts in another.
+/// Unlike a list of Complex objects, there is no allocation or virtual dispatch per element, and every operation runs the SIMD kernels over the two arrays.
+/// </summary>
+class ComplexVector
+{
+private:
+    std::vector<double, AlignedAllocator<double>> Re;
+    std::vector<double, AlignedAllocator<double>> Im;
+
+    void RequireSameSize(const ComplexVector& Other, char Operator) const;
+
+public:
+    ComplexVector() noexcept = default;
+    /// <summary>
+    /// Creates Size copies of Value.
+    /// </summary>
+    explicit ComplexVector(size_t Size, const Complex& Value = Complex());
+    explicit ComplexVector(const std::vector<Complex>& Values);
+    /// <summary>
+    /// Copies Count real parts, and Count imaginary parts. Imag may be null, for a purely real vector.
+    /// </summary>
+    [[nodiscard]] static ComplexVector FromParts(const double* Real, const double* Imag, size_t Count);
+    [[nodiscard]] std::vector<Complex> ToComplex() const;
+
+    [[nodiscard]] size_t Size() const noexcept { return Re.size(); }
+    [[nodiscard]] bool IsValid() const noexcept { return !Re.empty(); }
+    [[nodiscard]] std::string GetTypeString() const { return "(ComplexVector:" + std::to_string(Size()) + ")"; }
+
+    /// <summary>
+    /// The real parts, as a contiguous array of Size() doubles.
+    /// </summary>
+    [[nodiscard]] const double* Real() const noexcept { return Re.data(); }
+    [[nodiscard]] double* Real() noexcept { return Re.data(); }
+    /// <summary>
+    /// The imaginary parts, as a contiguous array of Size() doubles.
+    /// </summary>
+    [[nodiscard]] const double* Imag() const noexcept { return Im.data(); }
+    [[nodiscard]] double* Imag() noexcept { return Im.data(); }
+
+    [[nodiscard]] Complex Get(size_t i) const;
+    void Set(size_t i, const Complex& Value);
+
+    //Arithmetic between two vectors is element by element.
+
+    ComplexVector operator+(const ComplexVector& Two) const;
+    ComplexVector operator-(const ComplexVector& Two) const;
+    ComplexVector operator*(const ComplexVector& Two) const;
+    ComplexVector operator/(const ComplexVector& Two) const;
+    ComplexVector operator*(const Complex& Fac) const;
+    ComplexVector operator*(double Fac) const;
+
+    ComplexVector& operator+=(const ComplexVector& Two);
+    ComplexVector& operator-=(const ComplexVector& Two);
+    ComplexVector& operator*=(const ComplexVector& Two);
+    /// <summary>
+    /// Divides element by element. A zero divisor gives NaN in that element, instead of throwing.
+    /// </summary>
+    ComplexVector& operator/=(const ComplexVector& Two);
+    ComplexVector& operator*=(const Complex& Fac);
+    ComplexVector& operator*=(double Fac);
+    ComplexVector& operator/=(const Complex& Fac);
+
+    /// <summary>
+    /// Replaces every element with its complex conjugate.
+    /// </summary>
+    void Conjugate() noexcept;
+    /// <summary>
+    /// The magnitude of every element.
+    /// </summary>
+    [[nodiscard]] std::vector<double> Abs() const;
+    /// <summary>
+    /// The Euclidean norm, sqrt(sum |x_i|^2).
+    /// </summary>
+    [[nodiscard]] double Norm() const noexcept;
+
+    /// <summary>
+    /// The Hermitian inner product, sum conj(One_i) * Two_i. DotProduct(x, x) is the squared norm of x.
+    /// </summary>
+    [[nodiscard]] static Complex DotProduct(const ComplexVector& One, const ComplexVector& Two);
+};
+
+#endif //JASON_COMPLEXVECTOR_H
@@ -0,0 +1,47 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_EXPRESSIONOPERATORS_H
+#define JASON_EXPRESSIONOPERATORS_H
+
+#include "Constraints.h"
+
+#include <concepts>
+#include <type_traits>
+
+//The element-wise operations shared by the lazy expressions in MatrixExpression.h and VectorExpression.h.
+
+/// <summary>
+/// A factor for scaling an expression. Unlike IsScalarOrDouble, this excludes vectors, matrices and expressions, so that scaling never competes with the product.
+/// </summary>
+template<typename T>
+concept ExpressionFactor = std::is_arithmetic_v<std::remove_cvref_t<T>> || std::same_as<std::remove_cvref_t<T>, Scalar>;
+
+struct ExpressionAssign
+{
+    static constexpr char Symbol = '=';
+    [[nodiscard]] static double Apply(double, double Two) noexcept { return Two; }
+};
+struct ExpressionAdd
+{
+    static constexpr char Symbol = '+';
+    [[nodiscard]] static double Apply(double One, double Two) noexcept { return One + Two; }
+};
+struct ExpressionSubtract
+{
+    static constexpr char Symbol = '-';
+    [[nodiscard]] static double Apply(double One, double Two) noexcept { return One - Two; }
+};
+struct ExpressionMultiply
+{
+    static constexpr char Symbol = '*';
+    [[nodiscard]] static double Apply(double One, double Two) noexcept { return One * Two; }
+};
+struct ExpressionDivide
+{
+    static constexpr char Symbol = '/';
+    [[nodiscard]] static double Apply(double One, double Two) noexcept { return One / Two; }
+};
+
+#endif //JASON_EXPRESSIONOPERATORS_H
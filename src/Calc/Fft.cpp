@@ -0,0 +1,597 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "Fft.h"
+#include "SimdKernels.h"
+#include "../Core/Errors.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <numbers>
+#include <unordered_map>
+
+namespace
+{
+    using AlignedBuffer = std::vector<double, AlignedAllocator<double>>;
+
+    /*
+     * Small DFTs, in place on the P points (r[q], i[q]). All of them compute y[k] = sum x[q] * e^(-2 pi i q k / P), with the constant
+     * multiplications factored the usual way. Multiplying by -i maps (a, b) to (b, -a).
+     */
+
+    template<size_t P>
+    void Butterfly(double* r, double* i) noexcept;
+
+    template<>
+    inline void Butterfly<2>(double* r, double* i) noexcept
+    {
+        double r0 = r[0], i0 = i[0];
+        r[0] = r0 + r[1];
+        i[0] = i0 + i[1];
+        r[1] = r0 - r[1];
+        i[1] = i0 - i[1];
+    }
+    template<>
+    inline void Butterfly<3>(double* r, double* i) noexcept
+    {
+        constexpr double s = 0.86602540378443864676; //sin(2 pi / 3)
+
+        double t1r = r[1] + r[2], t1i = i[1] + i[2];
+        double t2r = r[0] - 0.5 * t1r, t2i = i[0] - 0.5 * t1i;
+        double t3r = s * (r[1] - r[2]), t3i = s * (i[1] - i[2]);
+
+        r[0] += t1r;
+        i[0] += t1i;
+        r[1] = t2r + t3i;
+        i[1] = t2i - t3r;
+        r[2] = t2r - t3i;
+        i[2] = t2i + t3r;
+    }
+    template<>
+    inline void Butterfly<4>(double* r, double* i) noexcept
+    {
+        double ar = r[0] + r[2], ai = i[0] + i[2];
+        double br = r[0] - r[2], bi = i[0] - i[2];
+        double cr = r[1] + r[3], ci = i[1] + i[3];
+        double dr = r[1] - r[3], di = i[1] - i[3];
+
+        r[0] = ar + cr;
+        i[0] = ai + ci;
+        r[2] = ar - cr;
+        i[2] = ai - ci;
+        r[1] = br + di;
+        i[1] = bi - dr;
+        r[3] = br - di;
+        i[3] = bi + dr;
+    }
+    template<>
+    inline void Butterfly<5>(double* r, double* i) noexcept
+    {
+        constexpr double c1 = 0.30901699437494742410, c2 = -0.80901699437494742410; //cos(2 pi / 5), cos(4 pi / 5)
+        constexpr double s1 = 0.95105651629515357212, s2 = 0.58778525229247312917; //sin(2 pi / 5), sin(4 pi / 5)
+
+        double t1r = r[1] + r[4], t1i = i[1] + i[4];
+        double t2r = r[2] + r[3], t2i = i[2] + i[3];
+        double t3r = r[1] - r[4], t3i = i[1] - i[4];
+        double t4r = r[2] - r[3], t4i = i[2] - i[3];
+
+        double b1r = r[0] + c1 * t1r + c2 * t2r, b1i = i[0] + c1 * t1i + c2 * t2i;
+        double b2r = r[0] + c2 * t1r + c1 * t2r, b2i = i[0] + c2 * t1i + c1 * t2i;
+        double d1r = s1 * t3r + s2 * t4r, d1i = s1 * t3i + s2 * t4i;
+        double d2r = s2 * t3r - s1 * t4r, d2i = s2 * t3i - s1 * t4i;
+
+        r[0] += t1r + t2r;
+        i[0] += t1i + t2i;
+        r[1] = b1r + d1i;
+        i[1] = b1i - d1r;
+        r[4] = b1r - d1i;
+        i[4] = b1i + d1r;
+        r[2] = b2r + d2i;
+        i[2] = b2i - d2r;
+        r[3] = b2r - d2i;
+        i[3] = b2i + d2r;
+    }
+
+    /*
+     * One Stockham pass of radix P, from x to y. Span is the length of the sub-transforms already completed. Leg q of butterfly (b, k) reads
+     * x[b * Span + k + q * n / P], and is written to y[b * Span * P + q * Span + k], so both sides are contiguous in k, which is the inner loop.
+     */
+    template<size_t P, bool Twiddled>
+    void Pass(const double* xr, const double* xi, double* yr, double* yi, size_t n, size_t Span, const double* twr, const double* twi) noexcept
+    {
+        const size_t legs = n / P, blocks = legs / Span;
+        for (size_t b = 0; b < blocks; b++)
+        {
+            const double* inr = xr + b * Span, * ini = xi + b * Span;
+            double* outr = yr + b * Span * P, * outi = yi + b * Span * P;
+
+            for (size_t k = 0; k < Span; k++)
+            {
+                double r[P], i[P];
+                for (size_t q = 0; q < P; q++)
+                {
+                    r[q] = inr[k + q * legs];
+                    i[q] = ini[k + q * legs];
+                }
+
+                if constexpr (Twiddled)
+                {
+                    for (size_t q = 1; q < P; q++)
+                    {
+                        double wr = twr[(q - 1) * Span + k], wi = twi[(q - 1) * Span + k];
+                        double re = r[q] * wr - i[q] * wi;
+                        i[q] = r[q] * wi + i[q] * wr;
+                        r[q] = re;
+                    }
+                }
+
+                Butterfly<P>(r, i);
+
+                for (size_t q = 0; q < P; q++)
+                {
+                    outr[k + q * Span] = r[q];
+                    outi[k + q * Span] = i[q];
+                }
+            }
+        }
+    }
+    template<size_t P>
+    void Pass(const double* xr, const double* xi, double* yr, double* yi, size_t n, size_t Span, const double* twr, const double* twi) noexcept
+    {
+        //The first pass has Span = 1, where every twiddle factor is 1.
+        if (Span == 1)
+            Pass<P, false>(xr, xi, yr, yi, n, Span, twr, twi);
+        else
+            Pass<P, true>(xr, xi, yr, yi, n, Span, twr, twi);
+    }
+
+    /// @brief The factors for the transform of a real signal of even length n, through a complex transform of length n / 2.
+    struct RealFftPlan
+    {
+        std::shared_ptr<const FftPlan> Half;
+        AlignedBuffer TwiddleRe, TwiddleIm; //e^(-2 pi i k / n), for k = 0 to n / 2
+    };
+
+    template<typename T>
+    struct PlanCache
+    {
+        std::mutex Lock;
+        std::unordered_map<size_t, std::shared_ptr<const T>> Plans;
+
+        template<typename Build>
+        std::shared_ptr<const T> Get(size_t Size, Build&& Builder)
+        {
+            {
+                std::lock_guard<std::mutex> guard(Lock);
+                auto found = Plans.find(Size);
+                if (found != Plans.end())
+                    return found->second;
+            }
+
+            //Built outside the lock, since building a plan can fetch other plans. If two threads race, the first one stored wins.
+            std::shared_ptr<const T> plan = Builder();
+            std::lock_guard<std::mutex> guard(Lock);
+            return Plans.try_emplace(Size, std::move(plan)).first->second;
+        }
+        void Clear()
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+            Plans.clear();
+        }
+    };
+
+    PlanCache<FftPlan>& ComplexPlans()
+    {
+        static PlanCache<FftPlan> cache;
+        return cache;
+    }
+    PlanCache<RealFftPlan>& RealPlans()
+    {
+        static PlanCache<RealFftPlan> cache;
+        return cache;
+    }
+
+    std::shared_ptr<const RealFftPlan> GetRealPlan(size_t n)
+    {
+        return RealPlans().Get(n, [n]
+        {
+            auto plan = std::make_shared<RealFftPlan>();
+            size_t h = n / 2;
+            plan->Half = FftPlan::Get(h);
+            plan->TwiddleRe.resize(h + 1);
+            plan->TwiddleIm.resize(h + 1);
+            for (size_t k = 0; k <= h; k++)
+            {
+                double angle = -2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(n);
+                plan->TwiddleRe[k] = std::cos(angle);
+                plan->TwiddleIm[k] = std::sin(angle);
+            }
+
+            return plan;
+        });
+    }
+
+    /// @brief Writes bins 0 to n / 2 of the transform of the n real samples at x.
+    void RealForward(const double* x, size_t n, double* OutRe, double* OutIm)
+    {
+        size_t h = n / 2;
+        if (n % 2 == 1)
+        {
+            AlignedBuffer re(x, x + n), im(n, 0.0);
+            FftPlan::Get(n)->Forward(re.data(), im.data());
+            std::copy_n(re.data(), h + 1, OutRe);
+            std::copy_n(im.data(), h + 1, OutIm);
+            return;
+        }
+
+        //Even samples become the real parts, and odd samples the imaginary parts, of a signal z of length h. Its transform Z holds
+        //the transforms of both halves, E[k] = (Z[k] + conj(Z[h - k])) / 2 and O[k] = -i (Z[k] - conj(Z[h - k])) / 2, and X[k] = E[k] + t^k O[k].
+        auto plan = GetRealPlan(n);
+        AlignedBuffer zr(h), zi(h);
+        for (size_t j = 0; j < h; j++)
+        {
+            zr[j] = x[2 * j];
+            zi[j] = x[2 * j + 1];
+        }
+        plan->Half->Forward(zr.data(), zi.data());
+
+        for (size_t k = 0; k <= h; k++)
+        {
+            size_t a = k % h, b = (h - k) % h;
+            double er = 0.5 * (zr[a] + zr[b]), ei = 0.5 * (zi[a] - zi[b]);
+            double orr = 0.5 * (zi[a] + zi[b]), oi = -0.5 * (zr[a] - zr[b]);
+            double tr = plan->TwiddleRe[k], ti = plan->TwiddleIm[k];
+
+            OutRe[k] = er + tr * orr - ti * oi;
+            OutIm[k] = ei + tr * oi + ti * orr;
+        }
+    }
+    /// @brief Writes the n real samples whose transform has bins 0 to n / 2 at (Re, Im). The inverse of RealForward.
+    void RealInverse(const double* Re, const double* Im, size_t n, double* x)
+    {
+        size_t h = n / 2;
+        //The imaginary parts of bin 0, and of bin n / 2 when n is even, are zero for any real signal, so they are not read.
+        auto imag = [&](size_t k) { return k == 0 || (n % 2 == 0 && k == h) ? 0.0 : Im[k]; };
+
+        if (n % 2 == 1)
+        {
+            AlignedBuffer re(n), im(n);
+            for (size_t k = 0; k <= h; k++)
+            {
+                re[k] = Re[k];
+                im[k] = imag(k);
+                if (k != 0)
+                {
+                    re[n - k] = Re[k];
+                    im[n - k] = -imag(k);
+                }
+            }
+
+            FftPlan::Get(n)->Inverse(re.data(), im.data());
+            std::copy_n(re.data(), n, x);
+            return;
+        }
+
+        //Undoes RealForward: E[k] = (X[k] + conj(X[h - k])) / 2, O[k] = conj(t^k) (X[k] - conj(X[h - k])) / 2, and Z[k] = E[k] + i O[k].
+        auto plan = GetRealPlan(n);
+        AlignedBuffer zr(h), zi(h);
+        for (size_t k = 0; k < h; k++)
+        {
+            double xr = Re[k], xi = imag(k), cr = Re[h - k], ci = -imag(h - k);
+            double er = 0.5 * (xr + cr), ei = 0.5 * (xi + ci);
+            double dr = 0.5 * (xr - cr), di = 0.5 * (xi - ci);
+            double tr = plan->TwiddleRe[k], ti = -plan->TwiddleIm[k];
+            double orr = dr * tr - di * ti, oi = dr * ti + di * tr;
+
+            zr[k] = er - oi;
+            zi[k] = ei + orr;
+        }
+
+        plan->Half->Inverse(zr.data(), zi.data());
+        for (size_t j = 0; j < h; j++)
+        {
+            x[2 * j] = zr[j];
+            x[2 * j + 1] = zi[j];
+        }
+    }
+
+    void TransformRows(ComplexMatrix& Target, bool Inverse)
+    {
+        auto plan = FftPlan::Get(Target.Columns());
+        for (size_t i = 0; i < Target.Rows(); i++)
+        {
+            if (Inverse)
+                plan->Inverse(Target.Real().RowData(i), Target.Imag().RowData(i));
+            else
+                plan->Forward(Target.Real().RowData(i), Target.Imag().RowData(i));
+        }
+    }
+    ComplexMatrix Transform2(ComplexMatrix Target, bool Inverse)
+    {
+        if (!Target.IsValid())
+            throw OperationError(Inverse ? "inverse FFT" : "FFT", "empty signal");
+
+        //Rows are contiguous, so the columns are transformed as the rows of the transpose.
+        TransformRows(Target, Inverse);
+        Target = Target.Transpose();
+        TransformRows(Target, Inverse);
+        return Target.Transpose();
+    }
+}
+
+FftPlan::FftPlan(size_t Size) : n(Size)
+{
+    if (n <= 1)
+        return;
+
+    std::vector<size_t> radices;
+    size_t rest = n;
+    for (size_t p : { 4, 2, 3, 5 })
+    {
+        while (rest % p == 0)
+        {
+            radices.push_back(p);
+            rest /= p;
+        }
+    }
+
+    if (rest != 1)
+    {
+        //Bluestein: with jk = (j^2 + k^2 - (k - j)^2) / 2, X[k] = w[k] * sum (x[j] w[j]) conj(w[k - j]), a convolution of length 2n - 1.
+        size_t m = FastSize(2 * n - 1);
+        Inner = Get(m);
+
+        ChirpRe.resize(n);
+        ChirpIm.resize(n);
+        size_t q = 0; //k^2 mod 2n, updated incrementally so it cannot overflow
+        for (size_t k = 0; k < n; k++)
+        {
+            double angle = -std::numbers::pi * static_cast<double>(q) / static_cast<double>(n);
+            ChirpRe[k] = std::cos(angle);
+            ChirpIm[k] = std::sin(angle);
+            q = (q + 2 * k + 1) % (2 * n);
+        }
+
+        FilterRe.assign(m, 0.0);
+        FilterIm.assign(m, 0.0);
+        for (size_t k = 0; k < n; k++)
+        {
+            FilterRe[k] = ChirpRe[k];
+            FilterIm[k] = -ChirpIm[k];
+            if (k != 0)
+            {
+                FilterRe[m - k] = ChirpRe[k];
+                FilterIm[m - k] = -ChirpIm[k];
+            }
+        }
+
+        Inner->Execute(FilterRe.data(), FilterIm.data());
+        const auto& simd = SimdKernels();
+        simd.Scale(FilterRe.data(), 1.0 / static_cast<double>(m), m);
+        simd.Scale(FilterIm.data(), 1.0 / static_cast<double>(m), m);
+        return;
+    }
+
+    size_t span = 1;
+    for (size_t p : radices)
+    {
+        Stage stage { p, span, {}, {} };
+        if (span > 1)
+        {
+            stage.TwiddleRe.resize((p - 1) * span);
+            stage.TwiddleIm.resize((p - 1) * span);
+            for (size_t r = 1; r < p; r++)
+            {
+                for (size_t k = 0; k < span; k++)
+                {
+                    double angle = -2.0 * std::numbers::pi * static_cast<double>(r * k) / static_cast<double>(span * p);
+                    stage.TwiddleRe[(r - 1) * span + k] = std::cos(angle);
+                    stage.TwiddleIm[(r - 1) * span + k] = std::sin(angle);
+                }
+            }
+        }
+
+        Stages.push_back(std::move(stage));
+        span *= p;
+    }
+}
+
+std::shared_ptr<const FftPlan> FftPlan::Get(size_t Size)
+{
+    return ComplexPlans().Get(Size, [Size] { return std::shared_ptr<const FftPlan>(new FftPlan(Size)); });
+}
+void FftPlan::ClearCache()
+{
+    ComplexPlans().Clear();
+    RealPlans().Clear();
+}
+size_t FftPlan::FastSize(size_t Size) noexcept
+{
+    if (Size <= 1)
+        return 1;
+
+    size_t best = SIZE_MAX;
+    for (size_t p5 = 1; p5 < 2 * Size; p5 *= 5)
+    {
+        for (size_t p35 = p5; p35 < 2 * Size; p35 *= 3)
+        {
+            size_t candidate = p35;
+            while (candidate < Size)
+                candidate *= 2;
+
+            best = std::min(best, candidate);
+        }
+    }
+
+    return best;
+}
+
+void FftPlan::Stockham(double* Re, double* Im) const
+{
+    AlignedBuffer scratchRe(n), scratchIm(n);
+    double* xr = Re, * xi = Im, * yr = scratchRe.data(), * yi = scratchIm.data();
+
+    for (const Stage& stage : Stages)
+    {
+        const double* twr = stage.TwiddleRe.data(), * twi = stage.TwiddleIm.data();
+        switch (stage.Radix)
+        {
+            case 2:
+                Pass<2>(xr, xi, yr, yi, n, stage.Span, twr, twi);
+                break;
+            case 3:
+                Pass<3>(xr, xi, yr, yi, n, stage.Span, twr, twi);
+                break;
+            case 4:
+                Pass<4>(xr, xi, yr, yi, n, stage.Span, twr, twi);
+                break;
+            default:
+                Pass<5>(xr, xi, yr, yi, n, stage.Span, twr, twi);
+                break;
+        }
+
+        std::swap(xr, yr);
+        std::swap(xi, yi);
+    }
+
+    if (xr != Re)
+    {
+        std::copy_n(xr, n, Re);
+        std::copy_n(xi, n, Im);
+    }
+}
+void FftPlan::Bluestein(double* Re, double* Im) const
+{
+    const auto& simd = SimdKernels();
+    size_t m = Inner->Size();
+    AlignedBuffer ar(m, 0.0), ai(m, 0.0);
+    std::copy_n(Re, n, ar.data());
+    std::copy_n(Im, n, ai.data());
+
+    simd.ComplexMultiply(ar.data(), ai.data(), ChirpRe.data(), ChirpIm.data(), n);
+    Inner->Execute(ar.data(), ai.data());
+    simd.ComplexMultiply(ar.data(), ai.data(), FilterRe.data(), FilterIm.data(), m);
+
+    //The inverse transform, as conj(FFT(conj(a))). The 1 / m factor is already in the filter.
+    simd.Scale(ai.data(), -1.0, m);
+    Inner->Execute(ar.data(), ai.data());
+    simd.Scale(ai.data(), -1.0, n);
+
+    std::copy_n(ar.data(), n, Re);
+    std::copy_n(ai.data(), n, Im);
+    simd.ComplexMultiply(Re, Im, ChirpRe.data(), ChirpIm.data(), n);
+}
+void FftPlan::Execute(double* Re, double* Im) const
+{
+    if (Inner)
+        Bluestein(Re, Im);
+    else if (!Stages.empty())
+        Stockham(Re, Im);
+}
+
+void FftPlan::Forward(double* Re, double* Im) const
+{
+    Execute(Re, Im);
+}
+void FftPlan::Inverse(double* Re, double* Im) const
+{
+    //IFFT(x) = conj(FFT(conj(x))) / n. On split storage, conjugation only negates the imaginary array.
+    const auto& simd = SimdKernels();
+    double scale = n == 0 ? 1.0 : 1.0 / static_cast<double>(n);
+    simd.Scale(Im, -1.0, n);
+    Execute(Re, Im);
+    simd.Scale(Re, scale, n);
+    simd.Scale(Im, -scale, n);
+}
+
+ComplexVector Fft(const ComplexVector& Signal)
+{
+    if (!Signal.IsValid())
+        throw OperationError("FFT", "empty signal");
+
+    ComplexVector result(Signal);
+    FftPlan::Get(result.Size())->Forward(result.Real(), result.Imag());
+    return result;
+}
+ComplexVector InverseFft(const ComplexVector& Spectrum)
+{
+    if (!Spectrum.IsValid())
+        throw OperationError("inverse FFT", "empty signal");
+
+    ComplexVector result(Spectrum);
+    FftPlan::Get(result.Size())->Inverse(result.Real(), result.Imag());
+    return result;
+}
+
+ComplexVector RealFft(const MathVector& Signal)
+{
+    if (!Signal.IsValid())
+        throw OperationError("FFT", "empty signal");
+
+    ComplexVector result(Signal.Dim() / 2 + 1);
+    RealForward(Signal.data(), Signal.Dim(), result.Real(), result.Imag());
+    return result;
+}
+MathVector InverseRealFft(const ComplexVector& Spectrum, size_t Count)
+{
+    if (Count == 0)
+        throw OperationError("inverse FFT", "empty signal");
+    if (Spectrum.Size() != Count / 2 + 1)
+        throw OperationError("inverse FFT", "the spectrum of " + std::to_string(Count) + " real samples has " + std::to_string(Count / 2 + 1) + " bins");
+
+    MathVector result(Count);
+    RealInverse(Spectrum.Real(), Spectrum.Imag(), Count, result.data());
+    return result;
+}
+
+ComplexMatrix Fft2(const ComplexMatrix& Signal)
+{
+    return Transform2(Signal, false);
+}
+ComplexMatrix Fft2(const Matrix& Signal)
+{
+    return Transform2(ComplexMatrix(Signal), false);
+}
+ComplexMatrix InverseFft2(const ComplexMatrix& Spectrum)
+{
+    return Transform2(Spectrum, true);
+}
+
+MathVector Convolve(const MathVector& One, const MathVector& Two)
+{
+    if (!One.IsValid() || !Two.IsValid())
+        throw OperationError("convolution", "empty signal");
+
+    size_t n1 = One.Dim(), n2 = Two.Dim(), length = n1 + n2 - 1;
+    MathVector result(length);
+
+    //Below this, the direct sum is cheaper than three transforms.
+    constexpr size_t DirectLimit = 64;
+    if (std::min(n1, n2) <= DirectLimit)
+    {
+        const MathVector& longer = n1 >= n2 ? One : Two, & shorter = n1 >= n2 ? Two : One;
+        const auto& simd = SimdKernels();
+        for (size_t j = 0; j < shorter.Dim(); j++)
+            simd.Axpy(result.data() + j, shorter.data()[j], longer.data(), longer.Dim());
+
+        return result;
+    }
+
+    //An even length keeps both transforms on the half length complex path.
+    size_t n = 2 * FftPlan::FastSize((length + 1) / 2), bins = n / 2 + 1;
+    AlignedBuffer padded(n, 0.0), ar(bins), ai(bins), br(bins), bi(bins);
+
+    std::copy_n(One.data(), n1, padded.data());
+    RealForward(padded.data(), n, ar.data(), ai.data());
+    std::fill(padded.begin(), padded.end(), 0.0);
+    std::copy_n(Two.data(), n2, padded.data());
+    RealForward(padded.data(), n, br.data(), bi.data());
+
+    SimdKernels().ComplexMultiply(ar.data(), ai.data(), br.data(), bi.data(), bins);
+    RealInverse(ar.data(), ai.data(), n, padded.data());
+
+    std::copy_n(padded.data(), length, result.data());
+    return result;
+}
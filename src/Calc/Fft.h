@@ -0,0 +1,106 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_FFT_H
+#define JASON_FFT_H
+
+#include "AlignedAllocator.h"
+#include "MathVector.h"
+#include "Matrix.h"
+#include "ComplexVector.h"
+#include "ComplexMatrix.h"
+
+#include <memory>
+#include <vector>
+
+/*
+ * FFT
+ *
+ * Discrete Fourier transforms in O(n log n), for any length, on split (real array, imaginary array) storage.
+ *  - Lengths whose only prime factors are 2, 3 and 5 use a mixed-radix Stockham FFT with radix 4, 2, 3 and 5 stages. Stockham ping-pongs between
+ *    two buffers, so the output is in natural order with no bit-reversal pass, and each stage streams through memory in order.
+ *  - Any other length uses Bluestein's algorithm, which rewrites the transform as a convolution, computed with a 2/3/5 FFT of at least 2n - 1.
+ *  - Real input is packed into a complex signal of half the length, and separated again afterwards, for about half the work of a complex FFT.
+ *
+ * The forward transform is X[k] = sum x[j] * e^(-2 pi i j k / n), and the inverse includes the 1 / n factor, so InverseFft(Fft(x)) = x.
+ *
+ * Twiddle factors (and Bluestein's chirp and filter) depend only on the length, so they are computed once into an FftPlan, cached, and shared
+ * by every later transform of that length. Plans are immutable, so one plan can be used by several threads at once.
+ */
+
+/// @brief The precomputed factors for transforms of one length. Obtain plans with FftPlan::Get.
+class FftPlan
+{
+private:
+    /// @brief One Stockham pass. Twiddle (r - 1) * Span + k is e^(-2 pi i r k / (Span * Radix)).
+    struct Stage
+    {
+        size_t Radix;
+        size_t Span; //The product of the radices of the earlier stages
+        std::vector<double, AlignedAllocator<double>> TwiddleRe, TwiddleIm;
+    };
+
+    size_t n;
+    std::vector<Stage> Stages;
+
+    //Bluestein: the chirp w[k] = e^(-pi i k^2 / n), and the transform of the conjugated chirp padded to the inner length, divided by that length.
+    std::shared_ptr<const FftPlan> Inner;
+    std::vector<double, AlignedAllocator<double>> ChirpRe, ChirpIm, FilterRe, FilterIm;
+
+    explicit FftPlan(size_t Size);
+
+    void Stockham(double* Re, double* Im) const;
+    void Bluestein(double* Re, double* Im) const;
+    /// @brief The unscaled forward transform, in place.
+    void Execute(double* Re, double* Im) const;
+
+public:
+    /// @brief Returns the plan for transforms of Size points, building and caching it on first use. Thread safe.
+    [[nodiscard]] static std::shared_ptr<const FftPlan> Get(size_t Size);
+    /// @brief Releases every cached plan. Plans still held elsewhere stay valid.
+    static void ClearCache();
+    /// @brief The smallest length >= Size with no prime factors other than 2, 3 and 5, which transforms without Bluestein.
+    [[nodiscard]] static size_t FastSize(size_t Size) noexcept;
+
+    [[nodiscard]] size_t Size() const noexcept { return n; }
+    /// @brief True if the length has a prime factor above 5, so the plan goes through Bluestein's algorithm.
+    [[nodiscard]] bool IsBluestein() const noexcept { return Inner != nullptr; }
+
+    /// @brief Replaces the Size() points at Re and Im with their forward transform.
+    void Forward(double* Re, double* Im) const;
+    /// @brief Replaces the Size() points at Re and Im with their inverse transform, including the 1 / n factor.
+    void Inverse(double* Re, double* Im) const;
+};
+
+/// <summary>
+/// The discrete Fourier transform of a complex signal. Throws OperationError if the signal is empty.
+/// </summary>
+[[nodiscard]] ComplexVector Fft(const ComplexVector& Signal);
+/// <summary>
+/// The inverse discrete Fourier transform, including the 1 / n factor.
+/// </summary>
+[[nodiscard]] ComplexVector InverseFft(const ComplexVector& Spectrum);
+
+/// <summary>
+/// The transform of a real signal of n samples. Since the spectrum of a real signal is conjugate symmetric, only bins 0 to n / 2 are returned.
+/// </summary>
+[[nodiscard]] ComplexVector RealFft(const MathVector& Signal);
+/// <summary>
+/// Recovers Count real samples from bins 0 to Count / 2 of their spectrum, as returned by RealFft. The imaginary parts of bin 0 (and of bin Count / 2, for even Count) are ignored.
+/// </summary>
+[[nodiscard]] MathVector InverseRealFft(const ComplexVector& Spectrum, size_t Count);
+
+/// <summary>
+/// The two dimensional transform: every row is transformed, then every column.
+/// </summary>
+[[nodiscard]] ComplexMatrix Fft2(const ComplexMatrix& Signal);
+[[nodiscard]] ComplexMatrix Fft2(const Matrix& Signal);
+[[nodiscard]] ComplexMatrix InverseFft2(const ComplexMatrix& Spectrum);
+
+/// <summary>
+/// The linear convolution of two real signals, of length One.Dim() + Two.Dim() - 1, computed with real FFTs.
+/// </summary>
+[[nodiscard]] MathVector Convolve(const MathVector& One, const MathVector& Two);
+
+#endif //JASON_FFT_H
@@ -0,0 +1,297 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_FIXEDMATRIX_H
+#define JASON_FIXEDMATRIX_H
+
+#include "MathVector.h"
+#include "Matrix.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+/*
+ * FIXED SIZE TYPES
+ *
+ * FixedVector<N> and FixedMatrix<R, C> hold their elements inline (on the stack, when they are locals), and their
+ * dimensions are template parameters. Shapes are checked by the compiler, so none of the operations allocate or check
+ * bounds at runtime, and every loop is over a compile time count, expanded by Unroll.
+ *
+ * They are plain numeric types for small geometry work, not VariableTypes. Use ToMathVector()/ToMatrix() and
+ * FromMathVector()/FromMatrix() to move between them and the dynamic types.
+ */
+
+/// @brief Calls Body(0), Body(1), ..., Body(N - 1) as a fully expanded sequence of calls, with no loop.
+template<size_t N, typename F>
+constexpr void Unroll(F&& Body)
+{
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        (Body(I), ...);
+    }(std::make_index_sequence<N>{});
+}
+
+template<size_t N> requires (N > 0)
+class FixedVector
+{
+private:
+    std::array<double, N> Data{};
+
+public:
+    constexpr FixedVector() noexcept = default;
+    template<std::convertible_to<double>... Args> requires (sizeof...(Args) == N)
+    constexpr FixedVector(Args... Values) noexcept : Data{ static_cast<double>(Values)... } { }
+
+    /// @brief Copies a MathVector of the same dimension. Throws OperationError if the dimensions differ.
+    [[nodiscard]] static FixedVector FromMathVector(const MathVector& in)
+    {
+        if (in.Dim() != N)
+            throw OperationError("conversion", "dimension mismatch");
+
+        FixedVector result;
+        Unroll<N>([&](size_t i) { result.Data[i] = in[i]; });
+        return result;
+    }
+    [[nodiscard]] MathVector ToMathVector() const
+    {
+        MathVector result(N);
+        Unroll<N>([&](size_t i) { result[i] = Data[i]; });
+        return result;
+    }
+
+    [[nodiscard]] static constexpr size_t Dim() noexcept { return N; }
+    [[nodiscard]] constexpr double& operator[](size_t i) noexcept { return Data[i]; }
+    [[nodiscard]] constexpr double operator[](size_t i) const noexcept { return Data[i]; }
+    [[nodiscard]] constexpr double* data() noexcept { return Data.data(); }
+    [[nodiscard]] constexpr const double* data() const noexcept { return Data.data(); }
+
+    [[nodiscard]] constexpr double Dot(const FixedVector& Two) const noexcept
+    {
+        double result = 0;
+        Unroll<N>([&](size_t i) { result += Data[i] * Two.Data[i]; });
+        return result;
+    }
+    [[nodiscard]] double Magnitude() const noexcept { return std::sqrt(Dot(*this)); }
+    [[nodiscard]] constexpr FixedVector Cross(const FixedVector& Two) const noexcept requires (N == 3)
+    {
+        const auto& a = Data;
+        const auto& b = Two.Data;
+        return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+    }
+
+    constexpr FixedVector& operator+=(const FixedVector& Two) noexcept { Unroll<N>([&](size_t i) { Data[i] += Two.Data[i]; }); return *this; }
+    constexpr FixedVector& operator-=(const FixedVector& Two) noexcept { Unroll<N>([&](size_t i) { Data[i] -= Two.Data[i]; }); return *this; }
+    constexpr FixedVector& operator*=(double Fac) noexcept { Unroll<N>([&](size_t i) { Data[i] *= Fac; }); return *this; }
+    constexpr FixedVector& operator/=(double Fac) noexcept { Unroll<N>([&](size_t i) { Data[i] /= Fac; }); return *this; }
+
+    [[nodiscard]] constexpr FixedVector operator+(const FixedVector& Two) const noexcept { FixedVector result(*this); return result += Two; }
+    [[nodiscard]] constexpr FixedVector operator-(const FixedVector& Two) const noexcept { FixedVector result(*this); return result -= Two; }
+    [[nodiscard]] constexpr FixedVector operator-() const noexcept { FixedVector result(*this); return result *= -1.0; }
+    [[nodiscard]] constexpr FixedVector operator*(double Fac) const noexcept { FixedVector result(*this); return result *= Fac; }
+    [[nodiscard]] constexpr FixedVector operator/(double Fac) const noexcept { FixedVector result(*this); return result /= Fac; }
+
+    [[nodiscard]] constexpr bool operator==(const FixedVector& Two) const noexcept = default;
+};
+
+template<size_t R, size_t C> requires (R > 0 && C > 0)
+class FixedMatrix
+{
+private:
+    /// @brief Row-major, with no padding: element (i, j) is Data[i * C + j].
+    std::array<double, R * C> Data{};
+
+public:
+    constexpr FixedMatrix() noexcept = default;
+    /// @brief Fills the matrix from R * C values, in row-major order.
+    template<std::convertible_to<double>... Args> requires (sizeof...(Args) == R * C)
+    constexpr FixedMatrix(Args... Values) noexcept : Data{ static_cast<double>(Values)... } { }
+
+    [[nodiscard]] static constexpr FixedMatrix Identity() noexcept requires (R == C)
+    {
+        FixedMatrix result;
+        Unroll<R>([&](size_t i) { result(i, i) = 1; });
+        return result;
+    }
+    /// @brief Copies a Matrix (or a view into one) of the same shape. Throws OperationError if the shapes differ.
+    [[nodiscard]] static FixedMatrix FromView(ConstMatrixView in)
+    {
+        if (in.Rows() != R || in.Columns() != C)
+            throw OperationError("conversion", "dimension mismatch");
+
+        FixedMatrix result;
+        Unroll<R>([&](size_t i) { Unroll<C>([&](size_t j) { result(i, j) = in(i, j); }); });
+        return result;
+    }
+    [[nodiscard]] static FixedMatrix FromMatrix(const Matrix& in) { return FromView(in.View()); }
+    [[nodiscard]] Matrix ToMatrix() const
+    {
+        Matrix result(R, C);
+        Unroll<R>([&](size_t i) { std::copy_n(Data.data() + i * C, C, result.RowData(i)); });
+        return result;
+    }
+    /// @brief A view over this matrix, for passing to the view kernels. Invalidated when this matrix goes out of scope.
+    [[nodiscard]] ConstMatrixView View() const noexcept { return { Data.data(), R, C, C }; }
+    [[nodiscard]] MatrixView View() noexcept { return { Data.data(), R, C, C }; }
+
+    [[nodiscard]] static constexpr size_t Rows() noexcept { return R; }
+    [[nodiscard]] static constexpr size_t Columns() noexcept { return C; }
+    [[nodiscard]] constexpr double& operator()(size_t i, size_t j) noexcept { return Data[i * C + j]; }
+    [[nodiscard]] constexpr double operator()(size_t i, size_t j) const noexcept { return Data[i * C + j]; }
+    /// @brief Returns the start of row i, so that M[i][j] works as it does for Matrix. Unchecked.
+    [[nodiscard]] constexpr double* operator[](size_t i) noexcept { return Data.data() + i * C; }
+    [[nodiscard]] constexpr const double* operator[](size_t i) const noexcept { return Data.data() + i * C; }
+
+    [[nodiscard]] constexpr FixedMatrix<C, R> Transpose() const noexcept
+    {
+        FixedMatrix<C, R> result;
+        Unroll<R>([&](size_t i) { Unroll<C>([&](size_t j) { result(j, i) = (*this)(i, j); }); });
+        return result;
+    }
+
+    constexpr FixedMatrix& operator+=(const FixedMatrix& Two) noexcept { Unroll<R * C>([&](size_t k) { Data[k] += Two.Data[k]; }); return *this; }
+    constexpr FixedMatrix& operator-=(const FixedMatrix& Two) noexcept { Unroll<R * C>([&](size_t k) { Data[k] -= Two.Data[k]; }); return *this; }
+    constexpr FixedMatrix& operator*=(double Fac) noexcept { Unroll<R * C>([&](size_t k) { Data[k] *= Fac; }); return *this; }
+    constexpr FixedMatrix& operator/=(double Fac) noexcept { Unroll<R * C>([&](size_t k) { Data[k] /= Fac; }); return *this; }
+    constexpr FixedMatrix& operator*=(const FixedMatrix& Two) noexcept requires (R == C) { return *this = *this * Two; }
+
+    [[nodiscard]] constexpr FixedMatrix operator+(const FixedMatrix& Two) const noexcept { FixedMatrix result(*this); return result += Two; }
+    [[nodiscard]] constexpr FixedMatrix operator-(const FixedMatrix& Two) const noexcept { FixedMatrix result(*this); return result -= Two; }
+    [[nodiscard]] constexpr FixedMatrix operator*(double Fac) const noexcept { FixedMatrix result(*this); return result *= Fac; }
+    [[nodiscard]] constexpr FixedMatrix operator/(double Fac) const noexcept { FixedMatrix result(*this); return result /= Fac; }
+
+    template<size_t K>
+    [[nodiscard]] constexpr FixedMatrix<R, K> operator*(const FixedMatrix<C, K>& Two) const noexcept
+    {
+        FixedMatrix<R, K> result;
+        Unroll<R>([&](size_t i)
+        {
+            Unroll<C>([&](size_t k)
+            {
+                double a = (*this)(i, k);
+                Unroll<K>([&](size_t j) { result(i, j) += a * Two(k, j); });
+            });
+        });
+        return result;
+    }
+    [[nodiscard]] constexpr FixedVector<R> operator*(const FixedVector<C>& Two) const noexcept
+    {
+        FixedVector<R> result;
+        Unroll<R>([&](size_t i) { Unroll<C>([&](size_t j) { result[i] += (*this)(i, j) * Two[j]; }); });
+        return result;
+    }
+
+    /// @brief Closed form determinant, by cofactor expansion. Only provided up to 4x4, beyond which LU is both cheaper and more accurate.
+    [[nodiscard]] constexpr double Determinant() const noexcept requires (R == C && R <= 4)
+    {
+        const auto& m = *this;
+        if constexpr (R == 1)
+            return m(0, 0);
+        else if constexpr (R == 2)
+            return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+        else if constexpr (R == 3)
+            return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
+                 - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
+                 + m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+        else
+            return Adjugate4().first;
+    }
+    /// @brief Closed form inverse, through the adjugate. Throws OperationError if the matrix is singular.
+    [[nodiscard]] constexpr FixedMatrix Inverse() const requires (R == C && R <= 4)
+    {
+        const auto& m = *this;
+        FixedMatrix adj;
+        double det;
+        if constexpr (R == 1)
+        {
+            adj(0, 0) = 1;
+            det = m(0, 0);
+        }
+        else if constexpr (R == 2)
+        {
+            adj = FixedMatrix(m(1, 1), -m(0, 1), -m(1, 0), m(0, 0));
+            det = Determinant();
+        }
+        else if constexpr (R == 3)
+        {
+            adj = FixedMatrix(
+                m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1), m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2), m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1),
+                m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2), m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0), m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2),
+                m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0), m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1), m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0));
+            det = m(0, 0) * adj(0, 0) + m(0, 1) * adj(1, 0) + m(0, 2) * adj(2, 0);
+        }
+        else
+        {
+            auto [d, a] = Adjugate4();
+            det = d;
+            adj = a;
+        }
+
+        if (det == 0)
+            throw OperationError("inverse", "the matrix is singular");
+
+        return adj / det;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const FixedMatrix& Two) const noexcept = default;
+
+private:
+    /// Returns the determinant and adjugate of a 4x4 matrix, sharing the 2x2 sub-determinants of the top and bottom row pairs between them.
+    [[nodiscard]] constexpr std::pair<double, FixedMatrix> Adjugate4() const noexcept requires (R == 4 && C == 4)
+    {
+        const auto& m = *this;
+        double s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+        double s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+        double s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+        double s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+        double s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+        double s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+
+        double c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+        double c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+        double c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+        double c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+        double c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+        double c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+
+        double det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        FixedMatrix adj(
+             m(1, 1) * c5 - m(1, 2) * c4 + m(1, 3) * c3,
+            -m(0, 1) * c5 + m(0, 2) * c4 - m(0, 3) * c3,
+             m(3, 1) * s5 - m(3, 2) * s4 + m(3, 3) * s3,
+            -m(2, 1) * s5 + m(2, 2) * s4 - m(2, 3) * s3,
+
+            -m(1, 0) * c5 + m(1, 2) * c2 - m(1, 3) * c1,
+             m(0, 0) * c5 - m(0, 2) * c2 + m(0, 3) * c1,
+            -m(3, 0) * s5 + m(3, 2) * s2 - m(3, 3) * s1,
+             m(2, 0) * s5 - m(2, 2) * s2 + m(2, 3) * s1,
+
+             m(1, 0) * c4 - m(1, 1) * c2 + m(1, 3) * c0,
+            -m(0, 0) * c4 + m(0, 1) * c2 - m(0, 3) * c0,
+             m(3, 0) * s4 - m(3, 1) * s2 + m(3, 3) * s0,
+            -m(2, 0) * s4 + m(2, 1) * s2 - m(2, 3) * s0,
+
+            -m(1, 0) * c3 + m(1, 1) * c1 - m(1, 2) * c0,
+             m(0, 0) * c3 - m(0, 1) * c1 + m(0, 2) * c0,
+            -m(3, 0) * s3 + m(3, 1) * s1 - m(3, 2) * s0,
+             m(2, 0) * s3 - m(2, 1) * s1 + m(2, 2) * s0);
+
+        return { det, adj };
+    }
+};
+
+template<size_t N>
+[[nodiscard]] constexpr FixedVector<N> operator*(double Fac, const FixedVector<N>& Vec) noexcept { return Vec * Fac; }
+template<size_t R, size_t C>
+[[nodiscard]] constexpr FixedMatrix<R, C> operator*(double Fac, const FixedMatrix<R, C>& Mat) noexcept { return Mat * Fac; }
+
+using FixedVector2 = FixedVector<2>;
+using FixedVector3 = FixedVector<3>;
+using FixedVector4 = FixedVector<4>;
+using FixedMatrix2 = FixedMatrix<2, 2>;
+using FixedMatrix3 = FixedMatrix<3, 3>;
+using FixedMatrix4 = FixedMatrix<4, 4>;
+
+#endif //JASON_FIXEDMATRIX_H
@@ -0,0 +1,222 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "Gemm.h"
+#include "AlignedAllocator.h"
+
+#include <algorithm>
+#include <barrier>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //Register block. MR x NR accumulators must fit in the register file (4 x 8 doubles = 8 AVX registers).
+    constexpr size_t MR = 4;
+    constexpr size_t NR = 8;
+
+    //Cache blocks. KC x NR of B fits in L1, MC x KC of A fits in L2, KC x NC of B fits in L3.
+    constexpr size_t KC = 256;
+    constexpr size_t MC = 128;
+    constexpr size_t NC = 4096;
+
+    //Below this many multiply-adds, spinning up threads costs more than it saves.
+    constexpr size_t ParallelThreshold = 128 * 128 * 128;
+
+    using PackBuffer = std::vector<double, AlignedAllocator<double>>;
+
+    /// Packs an mc x kc block of A into MR tall slivers. Each sliver is stored column by column, with rows past mc zero filled.
+    void PackA(size_t mc, size_t kc, const double* A, size_t rsa, size_t csa, double* out) noexcept
+    {
+        for (size_t i = 0; i < mc; i += MR)
+        {
+            size_t mr = std::min(MR, mc - i);
+            for (size_t p = 0; p < kc; p++)
+            {
+                size_t r = 0;
+                for (; r < mr; r++)
+                    out[r] = A[(i + r) * rsa + p * csa];
+                for (; r < MR; r++)
+                    out[r] = 0;
+
+                out += MR;
+            }
+        }
+    }
+    /// Packs a kc x nc panel of B into NR wide slivers. Each sliver is stored row by row, with columns past nc zero filled.
+    void PackB(size_t kc, size_t nc, const double* B, size_t rsb, size_t csb, double* out) noexcept
+    {
+        for (size_t j = 0; j < nc; j += NR)
+        {
+            size_t nr = std::min(NR, nc - j);
+            for (size_t p = 0; p < kc; p++)
+            {
+                const double* row = B + p * rsb + j * csb;
+                size_t c = 0;
+                for (; c < nr; c++)
+                    out[c] = row[c * csb];
+                for (; c < NR; c++)
+                    out[c] = 0;
+
+                out += NR;
+            }
+        }
+    }
+
+    /// Computes C[0..mr, 0..nr] += Alpha * a * b, where a and b are packed slivers of depth kc.
+    void MicroKernel(size_t kc, double Alpha, const double* a, const double* b, double* C, size_t rsc, size_t csc, size_t mr, size_t nr) noexcept
+    {
+        double acc[MR][NR] = {};
+
+        for (size_t p = 0; p < kc; p++)
+        {
+            for (size_t i = 0; i < MR; i++)
+            {
+                double ai = a[i];
+                for (size_t j = 0; j < NR; j++)
+                    acc[i][j] += ai * b[j];
+            }
+
+            a += MR;
+            b += NR;
+        }
+
+        for (size_t i = 0; i < mr; i++)
+        {
+            double* row = C + i * rsc;
+            for (size_t j = 0; j < nr; j++)
+                row[j * csc] += Alpha * acc[i][j];
+        }
+    }
+
+    /// Accumulates C += Alpha * A * B for all M rows of C against one packed kc x nc panel of B, packing A block by block into packedA (MC * KC doubles).
+    void MultiplyPanel(size_t M, size_t nc, size_t kc, double Alpha, const double* A, size_t rsa, size_t csa, const double* packedB, double* C, size_t rsc, size_t csc, double* packedA) noexcept
+    {
+        for (size_t ic = 0; ic < M; ic += MC)
+        {
+            size_t mc = std::min(MC, M - ic);
+            PackA(mc, kc, A + ic * rsa, rsa, csa, packedA);
+
+            for (size_t jr = 0; jr < nc; jr += NR)
+            {
+                size_t nr = std::min(NR, nc - jr);
+                for (size_t ir = 0; ir < mc; ir += MR)
+                {
+                    size_t mr = std::min(MR, mc - ir);
+                    MicroKernel(kc, Alpha, packedA + ir * kc, packedB + jr * kc, C + (ic + ir) * rsc + jr * csc, rsc, csc, mr, nr);
+                }
+            }
+        }
+    }
+
+    /// Runs the blocked loop nest on one thread. Beta has already been applied, so this only accumulates.
+    void GemmSerial(size_t M, size_t N, size_t K, double Alpha, const double* A, size_t rsa, size_t csa, const double* B, size_t rsb, size_t csb, double* C, size_t rsc, size_t csc)
+    {
+        PackBuffer packedA(MC * KC), packedB(KC * ((std::min(N, NC) + NR - 1) / NR * NR));
+
+        for (size_t jc = 0; jc < N; jc += NC)
+        {
+            size_t nc = std::min(NC, N - jc);
+            for (size_t pc = 0; pc < K; pc += KC)
+            {
+                size_t kc = std::min(KC, K - pc);
+                PackB(kc, nc, B + pc * rsb + jc * csb, rsb, csb, packedB.data());
+                MultiplyPanel(M, nc, kc, Alpha, A + pc * csa, rsa, csa, packedB.data(), C + jc * csc, rsc, csc, packedA.data());
+            }
+        }
+    }
+}
+
+void Gemm(size_t M, size_t N, size_t K, double Alpha, const double* A, size_t LDA, const double* B, size_t LDB, double Beta, double* C, size_t LDC)
+{
+    GemmStrided(M, N, K, Alpha, A, LDA, 1, B, LDB, 1, Beta, C, LDC, 1);
+}
+void GemmStrided(size_t M, size_t N, size_t K,
+                 double Alpha, const double* A, size_t RSA, size_t CSA,
+                 const double* B, size_t RSB, size_t CSB,
+                 double Beta, double* C, size_t RSC, size_t CSC)
+{
+    if (M == 0 || N == 0)
+        return;
+
+    if (Beta != 1)
+    {
+        for (size_t i = 0; i < M; i++)
+        {
+            double* row = C + i * RSC;
+            for (size_t j = 0; j < N; j++)
+                row[j * CSC] = Beta == 0 ? 0 : row[j * CSC] * Beta;
+        }
+    }
+
+    if (K == 0 || Alpha == 0)
+        return;
+
+    size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    if (M * N * K < ParallelThreshold)
+        threads = 1;
+    threads = std::min(threads, (M + MR - 1) / MR);
+
+    if (threads <= 1)
+    {
+        GemmSerial(M, N, K, Alpha, A, RSA, CSA, B, RSB, CSB, C, RSC, CSC);
+        return;
+    }
+
+    /*
+     * Every thread shares one packed panel of B at a time: the threads pack its slivers between them, wait, then each multiplies its
+     * own slice of rows of C (in multiples of MR) against it, and waits again before the next panel overwrites it. The calling thread
+     * takes part too. If the system refuses to start a thread, the rows are split over the threads that did start.
+     */
+    size_t slivers = (std::min(N, NC) + NR - 1) / NR;
+    PackBuffer packedB(KC * slivers * NR);
+    std::vector<PackBuffer> packedA(threads, PackBuffer(MC * KC));
+    std::barrier sync(static_cast<std::ptrdiff_t>(threads));
+    size_t participants = 1;
+
+    auto work = [&](size_t id)
+    {
+        sync.arrive_and_wait(); //Every thread has started (or been dropped), so participants is final.
+        size_t count = participants;
+        size_t slice = ((M + count - 1) / count + MR - 1) / MR * MR;
+        size_t first = std::min(M, id * slice), rows = std::min(slice, M - first);
+
+        for (size_t jc = 0; jc < N; jc += NC)
+        {
+            size_t nc = std::min(NC, N - jc);
+            for (size_t pc = 0; pc < K; pc += KC)
+            {
+                size_t kc = std::min(KC, K - pc);
+                for (size_t s = id; s * NR < nc; s += count)
+                    PackB(kc, std::min(NR, nc - s * NR), B + pc * RSB + (jc + s * NR) * CSB, RSB, CSB, packedB.data() + s * NR * kc);
+                sync.arrive_and_wait();
+
+                if (rows != 0)
+                    MultiplyPanel(rows, nc, kc, Alpha, A + first * RSA + pc * CSA, RSA, CSA, packedB.data(), C + first * RSC + jc * CSC, RSC, CSC, packedA[id].data());
+                sync.arrive_and_wait();
+            }
+        }
+    };
+
+    std::vector<std::jthread> workers; //Joined on destruction, whichever way this function exits.
+    workers.reserve(threads - 1);
+    for (size_t id = 1; id < threads; id++)
+    {
+        try
+        {
+            workers.emplace_back(work, id);
+        }
+        catch (const std::system_error&)
+        {
+            break;
+        }
+        participants++;
+    }
+
+    for (size_t missing = participants; missing < threads; missing++)
+        sync.arrive_and_drop();
+
+    work(0);
+}
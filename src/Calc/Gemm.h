@@ -0,0 +1,48 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_GEMM_H
+#define JASON_GEMM_H
+
+#include <cstddef>
+
+/*
+ * GEMM
+ *
+ * General matrix-matrix multiply on raw row-major storage, used by Matrix::operator* and by any algorithm that needs
+ * a block update (C = alpha * A * B + beta * C).
+ *
+ * The kernel follows the usual layered approach:
+ *  1. B is split into KC x NC panels and packed into NR wide column slivers (stays in L2/L3).
+ *  2. A is split into MC x KC blocks and packed into MR tall row slivers (stays in L2).
+ *  3. A register blocked MR x NR micro-kernel walks one sliver of each, accumulating in registers (L1).
+ *
+ * Large products are split across threads by rows of C, with each panel of B packed once and shared by all of them.
+ */
+
+/// @brief Computes C = Alpha * A * B + Beta * C.
+/// @param M The rows of A and C
+/// @param N The columns of B and C
+/// @param K The columns of A and rows of B
+/// @param Alpha The factor applied to the product
+/// @param A The first element of A, row-major
+/// @param LDA The leading dimension (row stride) of A
+/// @param B The first element of B, row-major
+/// @param LDB The leading dimension (row stride) of B
+/// @param Beta The factor applied to the existing contents of C. When zero, C is not read.
+/// @param C The first element of C, row-major. Must not alias A or B.
+/// @param LDC The leading dimension (row stride) of C
+void Gemm(size_t M, size_t N, size_t K,
+          double Alpha, const double* A, size_t LDA,
+          const double* B, size_t LDB,
+          double Beta, double* C, size_t LDC);
+
+/// @brief Computes C = Alpha * A * B + Beta * C, where every operand is addressed with a separate row stride (RS) and column stride (CS). Element (i, j) of A is A[i * RSA + j * CSA].
+/// @details This lets transposed and column views be multiplied without copying them first, since the packing step reads them into contiguous slivers regardless.
+void GemmStrided(size_t M, size_t N, size_t K,
+                 double Alpha, const double* A, size_t RSA, size_t CSA,
+                 const double* B, size_t RSB, size_t CSB,
+                 double Beta, double* C, size_t RSC, size_t CSC);
+
+#endif //JASON_GEMM_H
@@ -0,0 +1,74 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "Householder.h"
+
+#include <cmath>
+
+double GenerateReflector(double& Alpha, double* X, size_t Count, size_t Stride)
+{
+    double sigma = 0;
+    for (size_t i = 0; i < Count; i++)
+        sigma += X[i * Stride] * X[i * Stride];
+
+    if (sigma == 0)
+        return 0;
+
+    //Beta takes the opposite sign of Alpha, so that Alpha - Beta never cancels.
+    double norm = std::sqrt(Alpha * Alpha + sigma);
+    double beta = Alpha >= 0 ? -norm : norm;
+    double tau = (beta - Alpha) / beta;
+    double scale = 1.0 / (Alpha - beta);
+    for (size_t i = 0; i < Count; i++)
+        X[i * Stride] *= scale;
+
+    Alpha = beta;
+    return tau;
+}
+
+Matrix GatherReflectors(ConstMatrixView Packed, size_t Start, size_t Width, size_t Offset)
+{
+    size_t rows = Packed.Rows() - Start - Offset;
+    Matrix V(rows, Width);
+    for (size_t t = 0; t < Width; t++)
+    {
+        V.RowData(t)[t] = 1;
+        for (size_t r = t + 1; r < rows; r++)
+            V.RowData(r)[t] = Packed(Start + Offset + r, Start + t);
+    }
+
+    return V;
+}
+
+Matrix ReflectorBlockT(const Matrix& V, const double* Tau)
+{
+    size_t w = V.Columns();
+    Matrix G(w, w), T(w, w);
+    ViewMultiply(G.View(), V.View().Transposed(), V.View());
+
+    //Column j of T is T[0..j, j] = -Tau_j * T[0..j, 0..j] * (V^T v_j)[0..j], with Tau_j on the diagonal.
+    for (size_t j = 0; j < w; j++)
+    {
+        T.RowData(j)[j] = Tau[j];
+        for (size_t i = 0; i < j; i++)
+        {
+            double sum = 0;
+            for (size_t l = i; l < j; l++)
+                sum += T.RowData(i)[l] * G.RowData(l)[j];
+            T.RowData(i)[j] = -Tau[j] * sum;
+        }
+    }
+
+    return T;
+}
+
+void ApplyReflectorBlock(const Matrix& V, const Matrix& T, MatrixView C, bool Transpose)
+{
+    size_t w = V.Columns(), p = C.Columns();
+    Matrix W(w, p), TW(w, p);
+
+    ViewMultiply(W.View(), V.View().Transposed(), C);
+    ViewMultiply(TW.View(), Transpose ? T.View().Transposed() : T.View(), W.View());
+    ViewMultiply(C, V.View(), TW.View(), -1.0, 1.0);
+}
@@ -0,0 +1,37 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_HOUSEHOLDER_H
+#define JASON_HOUSEHOLDER_H
+
+#include "Matrix.h"
+
+/*
+ * HOUSEHOLDER REFLECTORS
+ *
+ * Shared by the orthogonal factorizations (QR, tridiagonalization, bidiagonalization). A reflector is H = I - Tau * v * v^T,
+ * where v[0] = 1 is implicit, and the rest of v is stored in place of the entries it zeroed.
+ *
+ * Consecutive reflectors are applied in blocks through the compact WY form H_0 H_1 ... H_(w-1) = I - V * T * V^T, where V
+ * holds the vectors as columns and T is a small upper triangle. Applying a block is then three GEMMs.
+ */
+
+/// @brief Generates the reflector H with H * (Alpha, X) = (Beta, 0, ..., 0).
+/// @param Alpha The first element. Overwritten with Beta.
+/// @param X The remaining Count elements, Stride apart. Overwritten with v[1..], scaled so that v[0] = 1.
+/// @return Tau. Zero when X is already zero, in which case H is the identity and nothing is changed.
+double GenerateReflector(double& Alpha, double* X, size_t Count, size_t Stride);
+
+/// @brief Copies reflectors Start to Start + Width - 1 into a dense matrix V, with explicit 1s on its diagonal and 0s above.
+/// @details Reflector Start + t is stored in column Start + t of Packed, at and below row Start + t + Offset (the row of its implicit 1).
+/// V has Packed.Rows() - Start - Offset rows; row r of V corresponds to row Start + Offset + r of Packed.
+[[nodiscard]] Matrix GatherReflectors(ConstMatrixView Packed, size_t Start, size_t Width, size_t Offset);
+
+/// @brief Builds the upper triangular T such that H_0 H_1 ... H_(w-1) = I - V * T * V^T, for the reflectors in the columns of V.
+[[nodiscard]] Matrix ReflectorBlockT(const Matrix& V, const double* Tau);
+
+/// @brief Computes C = (I - V T V^T) * C, or (I - V T^T V^T) * C when Transpose is true. C must have as many rows as V.
+void ApplyReflectorBlock(const Matrix& V, const Matrix& T, MatrixView C, bool Transpose);
+
+#endif //JASON_HOUSEHOLDER_H
@@ -0,0 +1,404 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "IterativeSolvers.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace
+{
+    constexpr size_t NoEntry = std::numeric_limits<size_t>::max();
+
+    double Norm(const SimdKernelTable& simd, const MathVector& x) noexcept
+    {
+        return std::sqrt(simd.Dot(x.data(), x.data(), x.Dim()));
+    }
+
+    LinearOperator DenseOperator(const Matrix& A)
+    {
+        return [&A](const MathVector& In, MathVector& Out)
+        {
+            const auto& simd = SimdKernels();
+            for (size_t i = 0; i < A.Rows(); i++)
+                Out.data()[i] = simd.Dot(A.RowData(i), In.data(), A.Columns());
+        };
+    }
+    LinearOperator SparseOperator(const SparseMatrix& A)
+    {
+        return [&A](const MathVector& In, MathVector& Out) { Out = A * In; };
+    }
+
+    template<typename T>
+    std::unique_ptr<Preconditioner> MakePreconditioner(const T& A, PreconditionerKind Kind)
+    {
+        switch (Kind)
+        {
+        case PK_Jacobi:
+            return std::make_unique<JacobiPreconditioner>(A);
+        case PK_ILU0:
+            return std::make_unique<ILU0Preconditioner>(A);
+        default:
+            return nullptr;
+        }
+    }
+
+    void CheckSquare(const char* Action, size_t Rows, size_t Columns, const MathVector& b)
+    {
+        if (Rows == 0 || Rows != Columns)
+            throw OperationError(Action, "the matrix must be square");
+        if (b.Dim() != Rows)
+            throw OperationError(Action, "dimension mismatch");
+    }
+
+    /// Sets x to the initial guess (or zero) and r to b - A * x, returning ||b||.
+    double Start(const char* Action, const LinearOperator& A, const MathVector& b, const MathVector* InitialGuess, MathVector& x, MathVector& r)
+    {
+        const auto& simd = SimdKernels();
+        size_t n = b.Dim();
+        if (n == 0)
+            throw OperationError(Action, "empty system");
+
+        if (InitialGuess)
+        {
+            if (InitialGuess->Dim() != n)
+                throw OperationError(Action, "the initial guess has the wrong dimension");
+
+            x = *InitialGuess;
+            A(x, r);
+            simd.Scale(r.data(), -1.0, n);
+            simd.Add(r.data(), b.data(), n);
+        }
+        else
+        {
+            x = MathVector(n);
+            r = b;
+        }
+
+        return Norm(simd, b);
+    }
+}
+
+JacobiPreconditioner::JacobiPreconditioner(const Matrix& A)
+{
+    if (!A.IsSquare())
+        throw OperationError("Jacobi preconditioner", "the matrix must be square");
+
+    InverseDiagonal.resize(A.Rows());
+    for (size_t i = 0; i < A.Rows(); i++)
+    {
+        double diag = A.RowData(i)[i];
+        if (diag == 0)
+            throw OperationError("Jacobi preconditioner", "zero on the diagonal");
+
+        InverseDiagonal[i] = 1.0 / diag;
+    }
+}
+JacobiPreconditioner::JacobiPreconditioner(const SparseMatrix& A)
+{
+    if (!A.IsSquare())
+        throw OperationError("Jacobi preconditioner", "the matrix must be square");
+
+    InverseDiagonal.resize(A.Rows());
+    for (size_t i = 0; i < A.Rows(); i++)
+    {
+        double diag = A.At(i, i);
+        if (diag == 0)
+            throw OperationError("Jacobi preconditioner", "zero on the diagonal");
+
+        InverseDiagonal[i] = 1.0 / diag;
+    }
+}
+void JacobiPreconditioner::Apply(const MathVector& In, MathVector& Out) const
+{
+    const double* in = In.data();
+    double* out = Out.data();
+    for (size_t i = 0; i < InverseDiagonal.size(); i++)
+        out[i] = in[i] * InverseDiagonal[i];
+}
+
+ILU0Preconditioner::ILU0Preconditioner(const SparseMatrix& A)
+{
+    if (!A.IsSquare())
+        throw OperationError("ILU(0)", "the matrix must be square");
+
+    SparseMatrix csr = A.ToFormat(SF_CSR);
+    Offsets = csr.Offsets();
+    Indices = csr.Indices();
+    Factors = csr.Values();
+    Factorize();
+}
+ILU0Preconditioner::ILU0Preconditioner(const Matrix& A) : ILU0Preconditioner(SparseMatrix(A))
+{
+
+}
+void ILU0Preconditioner::Factorize()
+{
+    /*
+     * Row by row (IKJ) Gaussian elimination, where any update that would land outside the pattern of A is dropped.
+     * Position maps the columns of the current row to their slot in Factors, so each update is a constant time lookup.
+     */
+    size_t n = Offsets.size() - 1;
+    Diagonal.assign(n, NoEntry);
+    for (size_t i = 0; i < n; i++)
+        for (size_t k = Offsets[i]; k < Offsets[i + 1]; k++)
+            if (Indices[k] == i)
+                Diagonal[i] = k;
+
+    std::vector<size_t> position(n, NoEntry);
+    for (size_t i = 0; i < n; i++)
+    {
+        if (Diagonal[i] == NoEntry)
+            throw OperationError("ILU(0)", "the matrix has a missing diagonal entry");
+
+        for (size_t k = Offsets[i]; k < Offsets[i + 1]; k++)
+            position[Indices[k]] = k;
+
+        for (size_t kk = Offsets[i]; kk < Diagonal[i]; kk++)
+        {
+            size_t k = Indices[kk];
+            double fac = Factors[kk] /= Factors[Diagonal[k]];
+            for (size_t kj = Diagonal[k] + 1; kj < Offsets[k + 1]; kj++)
+            {
+                size_t target = position[Indices[kj]];
+                if (target != NoEntry)
+                    Factors[target] -= fac * Factors[kj];
+            }
+        }
+
+        if (Factors[Diagonal[i]] == 0)
+            throw OperationError("ILU(0)", "zero pivot");
+
+        for (size_t k = Offsets[i]; k < Offsets[i + 1]; k++)
+            position[Indices[k]] = NoEntry;
+    }
+}
+void ILU0Preconditioner::Apply(const MathVector& In, MathVector& Out) const
+{
+    size_t n = Diagonal.size();
+    const double* in = In.data();
+    double* out = Out.data();
+
+    //L * y = In, then U * Out = y.
+    for (size_t i = 0; i < n; i++)
+    {
+        double sum = in[i];
+        for (size_t k = Offsets[i]; k < Diagonal[i]; k++)
+            sum -= Factors[k] * out[Indices[k]];
+        out[i] = sum;
+    }
+    for (size_t i = n; i-- > 0; )
+    {
+        double sum = out[i];
+        for (size_t k = Diagonal[i] + 1; k < Offsets[i + 1]; k++)
+            sum -= Factors[k] * out[Indices[k]];
+        out[i] = sum / Factors[Diagonal[i]];
+    }
+}
+
+IterativeSolverResult ConjugateGradient(const LinearOperator& A, const MathVector& b, const IterativeSolverOptions& Options, const Preconditioner* M, const MathVector* InitialGuess)
+{
+    const auto& simd = SimdKernels();
+    size_t n = b.Dim();
+
+    IterativeSolverResult result;
+    MathVector& x = result.Solution;
+    MathVector r(n);
+    double bNorm = Start("conjugate gradient", A, b, InitialGuess, x, r);
+    if (bNorm == 0)
+    {
+        //The solution of A * x = 0 is x = 0.
+        x = MathVector(n);
+        result.Converged = true;
+        result.ResidualHistory.push_back(0);
+        return result;
+    }
+
+    MathVector z(n), p(n), Ap(n);
+    auto precondition = [&]() { if (M) M->Apply(r, z); else z = r; };
+
+    precondition();
+    p = z;
+    double rz = simd.Dot(r.data(), z.data(), n);
+    double residual = Norm(simd, r) / bNorm;
+    result.ResidualHistory.push_back(residual);
+
+    while (residual > Options.Tolerance && result.Iterations < Options.MaxIterations)
+    {
+        A(p, Ap);
+        double curvature = simd.Dot(p.data(), Ap.data(), n);
+        if (curvature <= 0)
+            throw OperationError("conjugate gradient", "the operator is not positive definite");
+
+        double alpha = rz / curvature;
+        simd.Axpy(x.data(), alpha, p.data(), n);
+        simd.Axpy(r.data(), -alpha, Ap.data(), n);
+
+        result.Iterations++;
+        residual = Norm(simd, r) / bNorm;
+        result.ResidualHistory.push_back(residual);
+        if (residual <= Options.Tolerance)
+            break;
+
+        precondition();
+        double rzNext = simd.Dot(r.data(), z.data(), n);
+        double beta = rzNext / rz;
+        rz = rzNext;
+
+        //p = z + beta * p
+        simd.Scale(p.data(), beta, n);
+        simd.Add(p.data(), z.data(), n);
+    }
+
+    result.Converged = residual <= Options.Tolerance;
+    return result;
+}
+IterativeSolverResult ConjugateGradient(const Matrix& A, const MathVector& b, const IterativeSolverOptions& Options, const MathVector* InitialGuess)
+{
+    CheckSquare("conjugate gradient", A.Rows(), A.Columns(), b);
+    auto M = MakePreconditioner(A, Options.Preconditioning);
+    return ConjugateGradient(DenseOperator(A), b, Options, M.get(), InitialGuess);
+}
+IterativeSolverResult ConjugateGradient(const SparseMatrix& A, const MathVector& b, const IterativeSolverOptions& Options, const MathVector* InitialGuess)
+{
+    CheckSquare("conjugate gradient", A.Rows(), A.Columns(), b);
+    auto M = MakePreconditioner(A, Options.Preconditioning);
+    return ConjugateGradient(SparseOperator(A), b, Options, M.get(), InitialGuess);
+}
+
+IterativeSolverResult GMRES(const LinearOperator& A, const MathVector& b, const IterativeSolverOptions& Options, const Preconditioner* M, const MathVector* InitialGuess)
+{
+    if (Options.Restart == 0)
+        throw OperationError("GMRES", "the restart length must be at least 1");
+
+    const auto& simd = SimdKernels();
+    size_t n = b.Dim(), m = std::min(Options.Restart, n);
+
+    IterativeSolverResult result;
+    MathVector& x = result.Solution;
+    MathVector r(n);
+    double bNorm = Start("GMRES", A, b, InitialGuess, x, r);
+    if (bNorm == 0)
+    {
+        x = MathVector(n);
+        result.Converged = true;
+        result.ResidualHistory.push_back(0);
+        return result;
+    }
+
+    /*
+     * Each cycle builds an orthonormal basis V of the Krylov space of A * M^-1 by Arnoldi (with modified Gram-Schmidt),
+     * giving the small Hessenberg matrix H. Givens rotations turn H into an upper triangle as it grows, which makes the
+     * least squares residual of each step available for free, as the last entry of g.
+     */
+    Matrix V(m + 1, n), H(m + 1, m);
+    std::vector<double> g(m + 1), cs(m), sn(m), y(m);
+    MathVector w(n), z(n), update(n);
+
+    double residual = Norm(simd, r) / bNorm;
+    result.ResidualHistory.push_back(residual);
+
+    while (residual > Options.Tolerance && result.Iterations < Options.MaxIterations)
+    {
+        double beta = Norm(simd, r);
+        std::copy_n(r.data(), n, V.RowData(0));
+        simd.Scale(V.RowData(0), 1.0 / beta, n);
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = beta;
+
+        size_t k = 0;
+        while (k < m && result.Iterations < Options.MaxIterations)
+        {
+            std::copy_n(V.RowData(k), n, update.data());
+            if (M)
+                M->Apply(update, z);
+            else
+                z = update;
+            A(z, w);
+
+            for (size_t i = 0; i <= k; i++)
+            {
+                double h = simd.Dot(w.data(), V.RowData(i), n);
+                H.RowData(i)[k] = h;
+                simd.Axpy(w.data(), -h, V.RowData(i), n);
+            }
+
+            double next = Norm(simd, w);
+            H.RowData(k + 1)[k] = next;
+            if (next != 0)
+            {
+                std::copy_n(w.data(), n, V.RowData(k + 1));
+                simd.Scale(V.RowData(k + 1), 1.0 / next, n);
+            }
+
+            for (size_t i = 0; i < k; i++)
+            {
+                double a = H.RowData(i)[k], c = H.RowData(i + 1)[k];
+                H.RowData(i)[k] = cs[i] * a + sn[i] * c;
+                H.RowData(i + 1)[k] = -sn[i] * a + cs[i] * c;
+            }
+
+            double a = H.RowData(k)[k], c = H.RowData(k + 1)[k], d = std::hypot(a, c);
+            cs[k] = d == 0 ? 1.0 : a / d;
+            sn[k] = d == 0 ? 0.0 : c / d;
+            H.RowData(k)[k] = d;
+            H.RowData(k + 1)[k] = 0;
+            g[k + 1] = -sn[k] * g[k];
+            g[k] = cs[k] * g[k];
+
+            k++;
+            result.Iterations++;
+            residual = std::abs(g[k]) / bNorm;
+            result.ResidualHistory.push_back(residual);
+
+            if (residual <= Options.Tolerance || next == 0) //next == 0 means the Krylov space is invariant, so the solution is exact.
+                break;
+        }
+
+        //Solve the k x k triangle H * y = g, then x += M^-1 * (V^T * y).
+        for (size_t i = k; i-- > 0; )
+        {
+            double sum = g[i];
+            for (size_t j = i + 1; j < k; j++)
+                sum -= H.RowData(i)[j] * y[j];
+            y[i] = sum / H.RowData(i)[i];
+        }
+
+        std::fill_n(update.data(), n, 0.0);
+        for (size_t i = 0; i < k; i++)
+            simd.Axpy(update.data(), y[i], V.RowData(i), n);
+        if (M)
+        {
+            M->Apply(update, z);
+            simd.Add(x.data(), z.data(), n);
+        }
+        else
+            simd.Add(x.data(), update.data(), n);
+
+        //The true residual starts the next cycle, and replaces the estimate from the rotations, which can drift from it.
+        A(x, r);
+        simd.Scale(r.data(), -1.0, n);
+        simd.Add(r.data(), b.data(), n);
+        residual = Norm(simd, r) / bNorm;
+        result.ResidualHistory.back() = residual;
+    }
+
+    result.Converged = residual <= Options.Tolerance;
+    return result;
+}
+IterativeSolverResult GMRES(const Matrix& A, const MathVector& b, const IterativeSolverOptions& Options, const MathVector* InitialGuess)
+{
+    CheckSquare("GMRES", A.Rows(), A.Columns(), b);
+    auto M = MakePreconditioner(A, Options.Preconditioning);
+    return GMRES(DenseOperator(A), b, Options, M.get(), InitialGuess);
+}
+IterativeSolverResult GMRES(const SparseMatrix& A, const MathVector& b, const IterativeSolverOptions& Options, const MathVector* InitialGuess)
+{
+    CheckSquare("GMRES", A.Rows(), A.Columns(), b);
+    auto M = MakePreconditioner(A, Options.Preconditioning);
+    return GMRES(SparseOperator(A), b, Options, M.get(), InitialGuess);
+}
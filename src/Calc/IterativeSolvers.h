@@ -0,0 +1,136 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_ITERATIVESOLVERS_H
+#define JASON_ITERATIVESOLVERS_H
+
+#include "Matrix.h"
+#include "MathVector.h"
+#include "SparseMatrix.h"
+
+#include <functional>
+#include <vector>
+
+/*
+ * ITERATIVE SOLVERS
+ *
+ * Krylov solvers for A * x = b, which only ever touch A through products A * v. That makes them usable with dense
+ * matrices, sparse matrices, or any operator given as a callback (matrix-free), and far cheaper than a dense
+ * factorization when the system is large and reasonably well conditioned.
+ *  - ConjugateGradient: for symmetric positive definite A. Short recurrences, so constant memory per iteration.
+ *  - GMRES: for general A. Restarted every Options.Restart iterations to bound the memory of the Krylov basis.
+ */
+
+/// <summary>
+/// A linear operator, computing Out = A * In. Out is already sized to the operator's dimension.
+/// </summary>
+using LinearOperator = std::function<void(const MathVector& In, MathVector& Out)>;
+
+/// <summary>
+/// Selects the preconditioner built by the Matrix and SparseMatrix overloads of the solvers.
+/// </summary>
+enum PreconditionerKind
+{
+    PK_None = 0,
+    PK_Jacobi = 1, //Scales by the inverse of the diagonal. Cheap, and effective for diagonally dominant systems.
+    PK_ILU0 = 2, //Incomplete LU with no fill-in: the LU factors restricted to the sparsity pattern of A.
+};
+
+/// <summary>
+/// Approximates the inverse of A, computing Out = M^-1 * In. A good preconditioner makes M^-1 * A much better conditioned than A.
+/// </summary>
+class Preconditioner
+{
+public:
+    virtual ~Preconditioner() = default;
+
+    virtual void Apply(const MathVector& In, MathVector& Out) const = 0;
+};
+
+class JacobiPreconditioner : public Preconditioner
+{
+private:
+    std::vector<double> InverseDiagonal;
+
+public:
+    /// <summary>
+    /// Throws OperationError if any diagonal entry is zero.
+    /// </summary>
+    explicit JacobiPreconditioner(const Matrix& A);
+    explicit JacobiPreconditioner(const SparseMatrix& A);
+
+    void Apply(const MathVector& In, MathVector& Out) const override;
+};
+
+class ILU0Preconditioner : public Preconditioner
+{
+private:
+    /// <summary>
+    /// L (strictly lower, with an implicit unit diagonal) and U (upper), packed into the CSR pattern of A.
+    /// </summary>
+    std::vector<size_t> Offsets;
+    std::vector<size_t> Indices;
+    std::vector<double> Factors;
+    /// <summary>
+    /// The position of each diagonal entry in Factors.
+    /// </summary>
+    std::vector<size_t> Diagonal;
+
+    void Factorize();
+
+public:
+    /// <summary>
+    /// Throws OperationError if A is not square, has a missing diagonal entry, or a zero pivot shows up.
+    /// </summary>
+    explicit ILU0Preconditioner(const SparseMatrix& A);
+    explicit ILU0Preconditioner(const Matrix& A);
+
+    void Apply(const MathVector& In, MathVector& Out) const override;
+};
+
+struct IterativeSolverOptions
+{
+    /// <summary>
+    /// The solver stops once ||b - A * x|| <= Tolerance * ||b||.
+    /// </summary>
+    double Tolerance = 1e-10;
+    size_t MaxIterations = 1000;
+    /// <summary>
+    /// GMRES only: the size of the Krylov basis kept before restarting.
+    /// </summary>
+    size_t Restart = 30;
+    /// <summary>
+    /// Used by the Matrix and SparseMatrix overloads. Matrix-free solves take their preconditioner directly.
+    /// </summary>
+    PreconditionerKind Preconditioning = PK_None;
+};
+
+struct IterativeSolverResult
+{
+    MathVector Solution;
+    bool Converged = false;
+    size_t Iterations = 0;
+    /// <summary>
+    /// ||b - A * x|| / ||b|| before the first iteration (index 0) and after each one.
+    /// </summary>
+    std::vector<double> ResidualHistory;
+
+    [[nodiscard]] double RelativeResidual() const noexcept { return ResidualHistory.empty() ? 0.0 : ResidualHistory.back(); }
+};
+
+/// <summary>
+/// Solves A * x = b with the (preconditioned) conjugate gradient method. A, and the preconditioner if given, must be symmetric positive definite. Throws OperationError if the iteration detects that A is not.
+/// </summary>
+[[nodiscard]] IterativeSolverResult ConjugateGradient(const LinearOperator& A, const MathVector& b, const IterativeSolverOptions& Options = {}, const Preconditioner* M = nullptr, const MathVector* InitialGuess = nullptr);
+[[nodiscard]] IterativeSolverResult ConjugateGradient(const Matrix& A, const MathVector& b, const IterativeSolverOptions& Options = {}, const MathVector* InitialGuess = nullptr);
+[[nodiscard]] IterativeSolverResult ConjugateGradient(const SparseMatrix& A, const MathVector& b, const IterativeSolverOptions& Options = {}, const MathVector* InitialGuess = nullptr);
+
+/// <summary>
+/// Solves A * x = b with restarted GMRES, right preconditioned so that the residual it tracks is the true residual.
+/// </summary>
+[[nodiscard]] IterativeSolverResult GMRES(const LinearOperator& A, const MathVector& b, const IterativeSolverOptions& Options = {}, const Preconditioner* M = nullptr, const MathVector* InitialGuess = nullptr);
+[[nodiscard]] IterativeSolverResult GMRES(const Matrix& A, const MathVector& b, const IterativeSolverOptions& Options = {}, const MathVector* InitialGuess = nullptr);
+[[nodiscard]] IterativeSolverResult GMRES(const SparseMatrix& A, const MathVector& b, const IterativeSolverOptions& Options = {}, const MathVector* InitialGuess = nullptr);
+
+#endif //JASON_ITERATIVESOLVERS_H
@@ -0,0 +1,237 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "LUDecomposition.h"
+#include "Gemm.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace
+{
+    //The number of columns factored at a time before the trailing submatrix is updated with a GEMM.
+    constexpr size_t BlockSize = 64;
+}
+
+LUDecomposition::LUDecomposition(const Matrix& A) : Factors(A)
+{
+    if (!A.IsValid())
+        throw OperationError("LU decomposition", "empty matrix");
+    if (!A.IsSquare())
+        throw OperationError("LU decomposition", "the matrix must be square");
+
+    Factorize();
+}
+
+void LUDecomposition::Factorize()
+{
+    size_t n = Factors.Rows(), ld = Factors.LeadingDimension();
+    Permutation.resize(n);
+    std::iota(Permutation.begin(), Permutation.end(), 0);
+
+    double largest = 0;
+    for (size_t i = 0; i < n; i++)
+        for (double element : Factors[i])
+            largest = std::max(largest, std::abs(element));
+
+    const auto& simd = SimdKernels();
+
+    /*
+     * Right looking blocked LU. For each block of columns:
+     *  1. Factor the tall panel [A11; A21] with partial pivoting (row swaps are applied to whole rows).
+     *  2. Solve L11 * U12 = A12 for the block row to the right of the panel.
+     *  3. Update the trailing submatrix, A22 -= L21 * U12, which is where almost all the work is, and goes through GEMM.
+     */
+    for (size_t k0 = 0; k0 < n; k0 += BlockSize)
+    {
+        size_t kb = std::min(BlockSize, n - k0);
+        FactorizePanel(k0, kb);
+
+        size_t rest = n - k0 - kb;
+        if (rest == 0)
+            break;
+
+        for (size_t i = k0 + 1; i < k0 + kb; i++)
+        {
+            double* target = Factors.RowData(i) + k0 + kb;
+            const double* l = Factors.RowData(i);
+            for (size_t k = k0; k < i; k++)
+                simd.Axpy(target, -l[k], Factors.RowData(k) + k0 + kb, rest);
+        }
+
+        Gemm(rest, rest, kb,
+             -1.0, Factors.RowData(k0 + kb) + k0, ld,
+             Factors.RowData(k0) + k0 + kb, ld,
+             1.0, Factors.RowData(k0 + kb) + k0 + kb, ld);
+    }
+
+    double tolerance = static_cast<double>(n) * std::numeric_limits<double>::epsilon() * largest;
+    Singular = largest == 0;
+    for (size_t i = 0; i < n && !Singular; i++)
+        Singular = std::abs(Factors.RowData(i)[i]) <= tolerance;
+}
+void LUDecomposition::FactorizePanel(size_t Start, size_t Width)
+{
+    size_t n = Factors.Rows();
+    const auto& simd = SimdKernels();
+
+    for (size_t k = Start; k < Start + Width; k++)
+    {
+        size_t pivot = k;
+        double best = std::abs(Factors.RowData(k)[k]);
+        for (size_t i = k + 1; i < n; i++)
+        {
+            double curr = std::abs(Factors.RowData(i)[k]);
+            if (curr > best)
+            {
+                best = curr;
+                pivot = i;
+            }
+        }
+
+        if (pivot != k)
+        {
+            Factors.RowSwap(k, pivot);
+            std::swap(Permutation[k], Permutation[pivot]);
+            PermutationSign = -PermutationSign;
+        }
+
+        const double* pivotRow = Factors.RowData(k);
+        double pivotValue = pivotRow[k];
+        if (pivotValue == 0) //The whole column is zero, so there is nothing to eliminate.
+            continue;
+
+        size_t remaining = Start + Width - k - 1;
+        for (size_t i = k + 1; i < n; i++)
+        {
+            double* row = Factors.RowData(i);
+            double fac = row[k] /= pivotValue;
+            if (fac != 0 && remaining != 0)
+                simd.Axpy(row + k + 1, -fac, pivotRow + k + 1, remaining);
+        }
+    }
+}
+
+void LUDecomposition::ForwardSubstitute(double* X, size_t LDX, size_t Columns) const noexcept
+{
+    //Solves L * Y = X in place, where L has an implicit unit diagonal.
+    size_t n = Size();
+    const auto& simd = SimdKernels();
+
+    if (Columns == 1 && LDX == 1)
+    {
+        for (size_t i = 1; i < n; i++)
+            X[i] -= simd.Dot(Factors.RowData(i), X, i);
+        return;
+    }
+
+    for (size_t i = 1; i < n; i++)
+    {
+        const double* l = Factors.RowData(i);
+        for (size_t k = 0; k < i; k++)
+            if (l[k] != 0)
+                simd.Axpy(X + i * LDX, -l[k], X + k * LDX, Columns);
+    }
+}
+void LUDecomposition::BackSubstitute(double* X, size_t LDX, size_t Columns) const noexcept
+{
+    //Solves U * Y = X in place.
+    size_t n = Size();
+    const auto& simd = SimdKernels();
+
+    if (Columns == 1 && LDX == 1)
+    {
+        for (size_t i = n; i-- > 0; )
+        {
+            const double* u = Factors.RowData(i);
+            X[i] = (X[i] - simd.Dot(u + i + 1, X + i + 1, n - i - 1)) / u[i];
+        }
+        return;
+    }
+
+    for (size_t i = n; i-- > 0; )
+    {
+        const double* u = Factors.RowData(i);
+        double* row = X + i * LDX;
+        for (size_t k = i + 1; k < n; k++)
+            if (u[k] != 0)
+                simd.Axpy(row, -u[k], X + k * LDX, Columns);
+
+        simd.Divide(row, u[i], Columns);
+    }
+}
+
+Matrix LUDecomposition::L() const
+{
+    size_t n = Size();
+    Matrix result = Matrix::Identity(n);
+    for (size_t i = 1; i < n; i++)
+        std::copy_n(Factors.RowData(i), i, result.RowData(i));
+
+    return result;
+}
+Matrix LUDecomposition::U() const
+{
+    size_t n = Size();
+    Matrix result(n, n);
+    for (size_t i = 0; i < n; i++)
+        std::copy(Factors.RowData(i) + i, Factors.RowData(i) + n, result.RowData(i) + i);
+
+    return result;
+}
+
+double LUDecomposition::Determinant() const noexcept
+{
+    double result = PermutationSign;
+    for (size_t i = 0; i < Size(); i++)
+        result *= Factors.RowData(i)[i];
+
+    return result;
+}
+Matrix LUDecomposition::Inverse() const
+{
+    return Solve(Matrix::Identity(Size()));
+}
+
+MathVector LUDecomposition::Solve(const MathVector& b) const
+{
+    if (Singular)
+        throw OperationError("solve", "the matrix is singular");
+    if (b.Dim() != Size())
+        throw OperationError("solve", "dimension mismatch");
+
+    size_t n = Size();
+    std::vector<double> x(n);
+    for (size_t i = 0; i < n; i++)
+        x[i] = b[Permutation[i]];
+
+    ForwardSubstitute(x.data(), 1, 1);
+    BackSubstitute(x.data(), 1, 1);
+
+    MathVector result(n);
+    for (size_t i = 0; i < n; i++)
+        result[i] = x[i];
+
+    return result;
+}
+Matrix LUDecomposition::Solve(const Matrix& B) const
+{
+    if (Singular)
+        throw OperationError("solve", "the matrix is singular");
+    if (B.Rows() != Size())
+        throw OperationError("solve", "dimension mismatch");
+
+    size_t n = Size(), m = B.Columns();
+    Matrix result(n, m);
+    for (size_t i = 0; i < n; i++)
+        std::copy_n(B.RowData(Permutation[i]), m, result.RowData(i));
+
+    ForwardSubstitute(result.RowData(0), result.LeadingDimension(), m);
+    BackSubstitute(result.RowData(0), result.LeadingDimension(), m);
+
+    return result;
+}
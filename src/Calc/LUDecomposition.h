@@ -0,0 +1,69 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_LUDECOMPOSITION_H
+#define JASON_LUDECOMPOSITION_H
+
+#include "Matrix.h"
+#include "MathVector.h"
+
+#include <vector>
+
+/// <summary>
+/// The factorization PA = LU of a square matrix, computed with partial (row) pivoting. Once computed, the factors can be reused for any number of determinants, inverses and solves, each costing O(n^2) per right hand side instead of a full elimination.
+/// </summary>
+class LUDecomposition
+{
+private:
+    /// <summary>
+    /// L (below the diagonal, with an implicit unit diagonal) and U (on and above the diagonal), packed into one matrix.
+    /// </summary>
+    Matrix Factors;
+    /// <summary>
+    /// Row i of PA is row Permutation[i] of A.
+    /// </summary>
+    std::vector<size_t> Permutation;
+    /// <summary>
+    /// The sign of the permutation, +1 for an even number of row swaps and -1 for odd.
+    /// </summary>
+    int PermutationSign = 1;
+    bool Singular = false;
+
+    void Factorize();
+    void FactorizePanel(size_t Start, size_t Width);
+
+    void ForwardSubstitute(double* X, size_t LDX, size_t Columns) const noexcept;
+    void BackSubstitute(double* X, size_t LDX, size_t Columns) const noexcept;
+
+public:
+    /// <summary>
+    /// Factors the matrix. Throws if the matrix is empty or not square. A singular matrix is factored, but IsSingular() will be true and solves will throw.
+    /// </summary>
+    explicit LUDecomposition(const Matrix& A);
+
+    [[nodiscard]] size_t Size() const noexcept { return Factors.Rows(); }
+    /// <summary>
+    /// True if one of the pivots is zero, relative to the size and largest element of the original matrix.
+    /// </summary>
+    [[nodiscard]] bool IsSingular() const noexcept { return Singular; }
+    [[nodiscard]] const Matrix& PackedFactors() const noexcept { return Factors; }
+    [[nodiscard]] const std::vector<size_t>& RowPermutation() const noexcept { return Permutation; }
+
+    [[nodiscard]] Matrix L() const;
+    [[nodiscard]] Matrix U() const;
+
+    [[nodiscard]] double Determinant() const noexcept;
+    [[nodiscard]] Matrix Inverse() const;
+
+    /// <summary>
+    /// Solves Ax = b for x.
+    /// </summary>
+    [[nodiscard]] MathVector Solve(const MathVector& b) const;
+    /// <summary>
+    /// Solves AX = B for X, treating every column of B as its own right hand side.
+    /// </summary>
+    [[nodiscard]] Matrix Solve(const Matrix& B) const;
+};
+
+#endif //JASON_LUDECOMPOSITION_H
@@ -1,4 +1,6 @@
 #include "MathVector.h"
+#include "FixedMatrix.h"
+#include "SimdKernels.h"
 
 #include <utility>
 #include <ranges>
@@ -9,13 +11,7 @@ MathVector::MathVector() : Data()
 }
 MathVector::MathVector(size_t Dim, double Val) : MathVector()
 {
-    if (Dim == 0)
-        return; //No allocations take place.
-
-    Data.resize(Dim);
-
-    for (unsigned int i = 0; i < Dim; i++)
-        Data[i] = Val;
+    Data.assign(Dim, Val); //Only allocates past InlineDimensions.
 }
 MathVector::MathVector(const MathVector& Obj) noexcept : Data(Obj.Data)
 {
@@ -72,11 +68,7 @@ double MathVector::Magnitude() const
     if (!IsValid())
         throw std::logic_error("A magnitude cannot be measured on a dimensionless object.");
 
-    double Sum = 0;
-    for (const auto& slice : Data)
-        Sum += pow(slice, 2);
-
-    return sqrt(Sum);
+    return sqrt(SimdKernels().Dot(Data.data(), Data.data(), Data.size()));
 }
 double MathVector::Angle() const
 {
@@ -128,90 +120,53 @@ void MathVector::str_deserialize(std::istream &in)
     if (i != dim)
         throw FormatError("not enough arguments");
 }
+size_t MathVector::bin_size() const noexcept
+{
+    return sizeof(uint64_t) + this->Dim() * sizeof(double);
+}
+void MathVector::bin_serialize(BinaryWriter& out) const
+{
+    out.Write<uint64_t>(this->Dim());
+    out.WriteDoubles(this->Data.data(), this->Dim());
+}
+void MathVector::bin_deserialize(BinaryReader& in)
+{
+    auto dim = in.Read<uint64_t>();
+    if (dim > in.Remaining() / sizeof(double)) //Checked before allocating, so corrupt data cannot request a huge vector
+        throw FormatError("binary data", "not enough components provided");
+
+    this->Data.resize(dim);
+    in.ReadDoubles(this->Data.data(), dim);
+}
 
 MathVector MathVector::CrossProduct(const MathVector& One, const MathVector& Two)
 {
     if (Two.Dim() != One.Dim())
         throw OperatorError('X', One, Two, "cannot cross vectors with different dimensions");
 
-    MathVector A, B;
+    FixedVector3 A, B;
     switch (One.Dim())
     {
     case 2:
-        A = MathVector::FromList(One[0], One[1], 0);
-        B = MathVector::FromList(Two[0], Two[1], 0);
+        A = { One[0], One[1], 0 };
+        B = { Two[0], Two[1], 0 };
         break;
     case 3:
-        A = One;
-        B = Two;
+        A = FixedVector3::FromMathVector(One);
+        B = FixedVector3::FromMathVector(Two);
         break;
     default:
         throw OperatorError('X', One, Two, "cross is only defined for d={2,3}");
     }
 
-    return MathVector::FromList((A[1] * B[2]) - (A[2] * B[1]), (A[2] * B[0]) - (A[0] * B[2]), (A[0] * B[1]) - (A[1] * B[0])); //Uses the cross product equation.
+    return A.Cross(B).ToMathVector();
 }
 double MathVector::DotProduct(const MathVector& One, const MathVector& Two)
 {
     if (One.Dim() != Two.Dim())
         throw OperatorError("dot", One, Two, "dimension mismatch");
     
-    double Return = 0.0;
-    for (auto i = One.Data.begin(), j = Two.Data.begin(); i != One.Data.end() && j != Two.Data.end(); i++, j++)
-        Return += (*i) * (*j);
-
-    return Return;
-}
-
-MathVector MathVector::operator+(const MathVector& in) const
-{
-    //Because our vectors can be added with different dimensions, we cannot call +=.
-    
-    if (this->Dim() == in.Dim())
-    {
-        MathVector result(*this);
-        result += in;
-        return result;
-    }
-    else
-    {
-        MathVector result(this->Dim() >= in.Dim() ? *this : in);
-        const MathVector& lesser = (this->Dim() < in.Dim() ? *this : in);
-        
-        auto result_iter = result.Data.begin();
-        for (const auto& item : lesser.Data)
-        {
-            *result_iter += item;
-            result_iter++;
-        }
-        
-        return result;
-    }
-}
-MathVector MathVector::operator-(const MathVector& in) const
-{
-    //Because our vectors can be added with different dimensions, we cannot call -=.
-    
-    if (this->Dim() == in.Dim())
-    {
-        MathVector result(*this);
-        result -= in;
-        return result;
-    }
-    else
-    {
-        MathVector result(this->Dim() >= in.Dim() ? *this : in);
-        const MathVector& lesser = (this->Dim() < in.Dim() ? *this : in);
-        
-        auto result_iter = result.Data.begin();
-        for (const auto& item : lesser.Data)
-        {
-            *result_iter -= item;
-            result_iter++;
-        }
-        
-        return result;
-    }
+    return SimdKernels().Dot(One.Data.data(), Two.Data.data(), One.Dim());
 }
 
 MathVector& MathVector::operator+=(const MathVector& in)
@@ -222,11 +177,7 @@ MathVector& MathVector::operator+=(const MathVector& in)
     if (this->Dim() != in.Dim())
         throw OperatorError('+', *this, in, "dimension mismatch");
 
-    auto i = this->Data.begin();
-    auto j = in.Data.begin();
-
-    for (; i != this->Data.end() && j != in.Data.end(); i++, j++)
-        *i += *j;
+    SimdKernels().Add(this->Data.data(), in.Data.data(), this->Dim());
 
     return *this;
 }
@@ -238,11 +189,19 @@ MathVector& MathVector::operator-=(const MathVector& in)
     if (this->Dim() != in.Dim())
         throw OperatorError('-', *this, in, "dimension mismatch");
 
-    auto i = this->Data.begin();
-    auto j = in.Data.begin();
+    SimdKernels().Subtract(this->Data.data(), in.Data.data(), this->Dim());
 
-    for (; i != this->Data.end() && j != in.Data.end(); i++, j++)
-        *i -= *j;
+    return *this;
+}
+MathVector& MathVector::AddScaled(const MathVector& in, double Fac)
+{
+    if (!this->IsValid() || !in.IsValid())
+        throw OperatorError('+', *this, in, "cannot combine error vectors");
+
+    if (this->Dim() != in.Dim())
+        throw OperatorError('+', *this, in, "dimension mismatch");
+
+    SimdKernels().Axpy(this->Data.data(), Fac, in.Data.data(), this->Dim());
 
     return *this;
 }
@@ -7,26 +7,44 @@
 
 #include "Constraints.h"
 #include "VariableType.h"
+#include "SmallBuffer.h"
 #include "../Core/Errors.h"
 
+#include <cmath>
 #include <iostream>
 #include <vector>
 #include <string>
 #include <sstream>
 
+template<typename Derived>
+class VectorExpression;
+
 class MathVector : public VariableType
 {
+public:
+    /// @brief The largest dimension stored inside the object, without a heap allocation. Covers scalar function results, and 2D to 4D geometry.
+    static constexpr size_t InlineDimensions = 4;
+
 private:
-    std::vector<double> Data;
+    SmallBuffer<double, InlineDimensions> Data;
+
+    /// @brief Writes Op(this[i], Expr[i]) to every element, in one pass. The dimensions must already match.
+    template<typename E, typename Op>
+    void Assign(const VectorExpression<E>& Expr, Op);
 
 public:
     MathVector();
     explicit MathVector(size_t Dim, double Val = 0.0);
     MathVector(const MathVector &Obj) noexcept;
     MathVector(MathVector &&Obj) noexcept;
+    /// @brief Evaluates a lazy expression, such as a + b * 2, in a single pass with no intermediate vectors.
+    template<typename E>
+    MathVector(const VectorExpression<E>& Expr);
 
     MathVector& operator=(const MathVector &Obj) noexcept;
     MathVector& operator=(MathVector &&Obj) noexcept;
+    template<typename E>
+    MathVector& operator=(const VectorExpression<E>& Expr);
     
     [[nodiscard]] static MathVector ErrorVector();
     template<std::convertible_to<double>... Args>
@@ -42,31 +60,39 @@ public:
     
     void str_serialize(std::ostream& out) const noexcept override;
     void str_deserialize(std::istream& in) override;
+    [[nodiscard]] size_t bin_size() const noexcept override;
+    void bin_serialize(BinaryWriter& out) const override;
+    void bin_deserialize(BinaryReader& in) override;
     
     [[nodiscard]] constexpr VariableTypes GetType() const noexcept override { return VariableTypes::VT_Vector; }
     void dsp_fmt(std::ostream& out) const noexcept override;
     void dbg_fmt(std::ostream& out) const noexcept override;
     
     [[nodiscard]] size_t Dim() const { return Data.size(); }
+    /// @brief The elements as a contiguous array of Dim() doubles, for kernels that work on raw storage. Unchecked.
+    [[nodiscard]] const double* data() const noexcept { return Data.data(); }
+    [[nodiscard]] double* data() noexcept { return Data.data(); }
     [[nodiscard]] bool IsValid() const { return !Data.empty(); }
 
     [[maybe_unused]] [[nodiscard]] static MathVector CrossProduct(const MathVector &One, const MathVector &Two);
     [[maybe_unused]] [[nodiscard]] static double DotProduct(const MathVector &One, const MathVector &Two);
 
-    MathVector operator+(const MathVector& in) const;
-    MathVector operator-(const MathVector& in) const;
-    template<typename T> requires IsScalarOrDouble<T>
-    MathVector operator*(const T& in) const;
-    template<typename T> requires IsScalarOrDouble<T>
-    MathVector operator/(const T& in) const;
+    //Sums, differences, and scaling are lazy, and build the expressions declared in VectorExpression.h.
 
     MathVector& operator+=(const MathVector& in);
     MathVector& operator-=(const MathVector& in);
+    template<typename E>
+    MathVector& operator+=(const VectorExpression<E>& Expr);
+    template<typename E>
+    MathVector& operator-=(const VectorExpression<E>& Expr);
     template<typename T> requires IsScalarOrDouble<T>
     MathVector& operator*=(const T& in);
     template<typename T> requires IsScalarOrDouble<T>
     MathVector& operator/=(const T& in);
 
+    /// @brief Computes this += Fac * in in a single pass, without forming the scaled copy of in.
+    MathVector& AddScaled(const MathVector& in, double Fac);
+
     bool operator==(const VariableType& in) const noexcept override;
     bool operator!=(const VariableType& in) const noexcept override;
     bool operator==(const MathVector& in) const noexcept;
@@ -74,5 +100,6 @@ public:
 };
 
 #include "MathVectorT.tpp"
+#include "VectorExpression.h"
 
 #endif //JASON_MATHVECTOR_H
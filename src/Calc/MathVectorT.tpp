@@ -4,12 +4,13 @@
 
 #include "../Core/Errors.h"
 #include "Scalar.h"
+#include "SimdKernels.h"
 
 template<std::convertible_to<double>... Args>
 MathVector MathVector::FromList(Args... Value) noexcept
 {
     MathVector result;
-    result.Data = std::vector<double>(
+    result.Data = SmallBuffer<double, InlineDimensions>(
         {
             static_cast<double>(Value)...
         }
@@ -18,30 +19,13 @@ MathVector MathVector::FromList(Args... Value) noexcept
     return result;
 }
 
-template<typename T> requires IsScalarOrDouble<T>
-MathVector MathVector::operator*(const T& in) const
-{
-    MathVector result(*this);
-    result.operator*=<T>(in);
-    return result;
-}
-template<typename T> requires IsScalarOrDouble<T>
-MathVector MathVector::operator/(const T& in) const
-{
-    MathVector result(*this);
-    result.operator/=<T>(in);
-    return result;
-}
-
 template<typename T> requires IsScalarOrDouble<T>
 MathVector& MathVector::operator*=(const T& in)
 {
     if (!this->IsValid())
         throw OperatorError('*', *this, Scalar(in), "cannot multiply an error vector.");
 
-    auto fac = static_cast<double>(in);
-    for (auto& elem : this->Data)
-        elem *= fac;
+    SimdKernels().Scale(this->Data.data(), static_cast<double>(in), this->Dim());
 
     return *this;
 }
@@ -55,8 +39,7 @@ MathVector& MathVector::operator/=(const T& in)
     if (fac == 0)
         throw OperatorError('*', *this, Scalar(0), "cannot divide by zero");
     
-    for (auto& elem : this->Data)
-        elem /= fac;
+    SimdKernels().Divide(this->Data.data(), fac, this->Dim());
 
     return *this;
 }
\ No newline at end of file
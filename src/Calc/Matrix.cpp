@@ -2,15 +2,25 @@
 
 #include "MathVector.h"
 #include "Scalar.h"
-
+#include "LUDecomposition.h"
+#include "QRDecomposition.h"
+#include "CholeskyDecomposition.h"
+#include "SymmetricEigen.h"
+#include "SingularValueDecomposition.h"
+#include "SimdKernels.h"
+#include "Transpose.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
 #include <random>
 #include <utility>
 
-Matrix::Matrix() : rows(0), cols(0)
+Matrix::Matrix() : rows(0), cols(0), stride(0)
 {
 
 }
-Matrix::Matrix(size_t Rows, size_t Columns) noexcept : rows(Rows), cols(Columns)
+Matrix::Matrix(size_t Rows, size_t Columns) noexcept : rows(0), cols(0), stride(0)
 {
     Allocate(Rows, Columns, 0);
 }
@@ -22,14 +32,22 @@ Matrix::Matrix(const MathVector& in) : Matrix()
     {
         Allocate(in.Dim(), 1);
         for (unsigned i = 0; i < this->rows; i++)
-            this->Data[i][0] = in[i];
+            this->RowData(i)[0] = in[i];
     }
 }
-Matrix::Matrix(const Matrix& Other) noexcept  : cols(Other.cols), rows(Other.rows), Data(Other.Data)
+Matrix::Matrix(ConstMatrixView View) : Matrix()
+{
+    if (!View.IsValid())
+        return;
+
+    Allocate(View.Rows(), View.Columns());
+    ViewCopy(this->View(), View);
+}
+Matrix::Matrix(const Matrix& Other) noexcept : Data(Other.Data), rows(Other.rows), cols(Other.cols), stride(Other.stride)
 {
 
 }
-Matrix::Matrix(Matrix&& Other) noexcept : cols(std::exchange(Other.cols, 0)), rows(std::exchange(Other.rows, 0)), Data(std::move(Other.Data))
+Matrix::Matrix(Matrix&& Other) noexcept : Data(std::move(Other.Data)), rows(std::exchange(Other.rows, 0)), cols(std::exchange(Other.cols, 0)), stride(std::exchange(Other.stride, 0))
 {
 
 }
@@ -42,6 +60,7 @@ Matrix& Matrix::operator=(const Matrix& Other) noexcept
     this->Data = Other.Data;
     this->cols = Other.cols;
     this->rows = Other.rows;
+    this->stride = Other.stride;
 
     return *this;
 }
@@ -50,36 +69,42 @@ Matrix& Matrix::operator=(Matrix&& Other) noexcept
     this->Data = std::move(Other.Data);
     this->cols = std::exchange(Other.cols, 0);
     this->rows = std::exchange(Other.rows, 0);
+    this->stride = std::exchange(Other.stride, 0);
 
     return *this;
 }
 
-void Matrix::Allocate(size_t NewRows, size_t NewColumns, double Value) noexcept
+size_t Matrix::PaddedStride(size_t Columns) noexcept
 {
-    size_t currRows = this->Rows(), currCols = this->Columns();
+    /*
+     * Rows are padded so that each one starts on a NumericAlignment boundary. Small matrices (less than one
+     * alignment block wide) are left unpadded, since the padding would be larger than the data itself.
+     */
+    constexpr size_t block = NumericAlignment / sizeof(double);
+    if (Columns < block)
+        return Columns;
 
-    if (rows == NewRows && cols == NewColumns && rows == currRows && cols == currCols) //Already that size, just set value
+    return (Columns + block - 1) / block * block;
+}
+void Matrix::Allocate(size_t NewRows, size_t NewColumns, double Value) noexcept
+{
+    if (NewRows == 0 || NewColumns == 0)
     {
-        for (auto& row : Data)
-            for (auto& element : row)
-                element = Value;
-
+        this->Data.clear();
+        rows = cols = stride = 0;
         return;
     }
 
-    this->Data.clear();
-
-    if (NewRows > 0 && NewColumns > 0)
+    if (rows != NewRows || cols != NewColumns) //Only touch the buffer size if the shape is changing.
     {
         rows = NewRows;
         cols = NewColumns;
-
-        Data.resize(cols);
-        for (auto& row : Data)
-            row.resize(cols, Value);
+        stride = PaddedStride(NewColumns);
+        Data.assign(rows * stride, 0);
     }
-    else
-        cols = rows = 0;
+
+    for (size_t i = 0; i < rows; i++)
+        std::fill_n(RowData(i), cols, Value);
 }
 
 Matrix Matrix::ErrorMatrix()
@@ -113,7 +138,7 @@ Matrix Matrix::RandomMatrix(size_t Rows, size_t Columns, bool Integers)
 
         for (unsigned int i = 0; i < Rows; i++)
             for (unsigned int j = 0; j < Columns; j++)
-                result.Data[i][j] = dist(engine);
+                result.RowData(i)[j] = dist(engine);
     }
     else
     {
@@ -121,7 +146,7 @@ Matrix Matrix::RandomMatrix(size_t Rows, size_t Columns, bool Integers)
 
         for (unsigned int i = 0; i < Rows; i++)
             for (unsigned int j = 0; j < Columns; j++)
-                result.Data[i][j] = dist(engine);
+                result.RowData(i)[j] = dist(engine);
     }
 
     return result;
@@ -132,19 +157,26 @@ std::unique_ptr<VariableType> Matrix::Clone() const noexcept
     return std::make_unique<Matrix>(*this);
 }
 
-const std::vector<double>& Matrix::operator[](size_t Row) const
+ConstMatrixRow Matrix::operator[](size_t Row) const
+{
+    if (Row >= rows)
+        throw std::logic_error("Out of bounds");
+
+    return { RowData(Row), cols };
+}
+MatrixRow Matrix::operator[](size_t Row)
 {
-    if (Row > rows)
+    if (Row >= rows)
         throw std::logic_error("Out of bounds");
 
-    return Data[Row];
+    return { RowData(Row), cols };
 }
 const double& Matrix::Access(size_t i, size_t j) const
 {
     if (i >= rows || j >= cols) //Out of range
         throw std::logic_error("Out of range");
 
-    return this->Data[i][j];
+    return this->RowData(i)[j];
 }
 double& Matrix::Access(size_t i, size_t j)
 {
@@ -156,57 +188,54 @@ VariableTypes Matrix::GetType() const noexcept
     return VariableTypes::VT_Matrix;
 }
 
-Matrix Matrix::Extract(size_t StartI, size_t StartJ, size_t RowCount, size_t ColumnCount)
+Matrix Matrix::Extract(size_t StartI, size_t StartJ, size_t RowCount, size_t ColumnCount) const
 {
-    /*
-     * I want to split this in two parts. This function will return a MatrixExtrusion, and then the other part will
-     * return a MatrixMinor.
-     */
-
     if (RowCount == 0 || ColumnCount == 0)
         return Matrix::ErrorMatrix();
 
-    if ((StartI + RowCount - 1) > rows || (StartJ + ColumnCount - 1) > cols)
-        throw std::logic_error("The index was out of range for that size.");
-
-    Matrix Return(RowCount, ColumnCount);
-    if (!Return.IsValid())
-        return Matrix::ErrorMatrix();
-
-    for (size_t i = StartI, ip = 0; i < StartI + RowCount - 1; i++, ip++)
-        for (size_t j = StartJ, jp = 0; j < StartJ + ColumnCount - 1; j++, jp++)
-            Return.Data[ip][jp] = Data[i][j];
-
-    return Return;
+    return Matrix(this->Block(StartI, StartJ, RowCount, ColumnCount));
 }
 
 void Matrix::RowSwap(size_t OrigRow, size_t NewRow)
 {
-    if (OrigRow == NewRow || OrigRow > rows || NewRow > rows)
+    if (OrigRow == NewRow || OrigRow >= rows || NewRow >= rows)
         return;
 
-    std::swap(Data[OrigRow], Data[NewRow]);
+    std::swap_ranges(RowData(OrigRow), RowData(OrigRow) + cols, RowData(NewRow));
 }
 void Matrix::RowAdd(size_t OrigRow, double Fac, size_t TargetRow)
 {
     if (Fac == 0)
         throw std::logic_error("The factor of multiplication cannot be zero.");
 
+    const double* orig = RowData(OrigRow);
+    double* target = RowData(TargetRow);
     for (unsigned int j = 0; j < cols; j++)
-        Data[TargetRow][j] += Data[OrigRow][j] * Fac;
+        target[j] += orig[j] * Fac;
 }
 
+LUDecomposition Matrix::LU() const
+{
+    return LUDecomposition(*this);
+}
+QRDecomposition Matrix::QR() const
+{
+    return QRDecomposition(*this);
+}
+CholeskyDecomposition Matrix::Cholesky() const
+{
+    return CholeskyDecomposition(*this);
+}
+SingularValueDecomposition Matrix::SVD(const SpectralOptions& Options) const
+{
+    return SingularValueDecomposition(*this, Options);
+}
 double Matrix::Determinant() const
 {
     if (this->rows != this->cols)
         throw std::logic_error("The matrix must be square");
 
-    throw std::logic_error("Not implemented");
-
-    /*
-     * To do the determinant, we will have to get the minors of the matrix, and therefore requires the MatrixMinor.
-     * Will be done with the addition of the matrix branch.
-     */
+    return LUDecomposition(*this).Determinant();
 }
 
 Matrix Matrix::Invert() const
@@ -214,137 +243,100 @@ Matrix Matrix::Invert() const
     if (rows != cols)
         throw std::logic_error("The matrix must be square");
 
-    Matrix Id = Identity(rows);
-    Matrix Aug = Id | *this;
-    Aug.ReducedRowEchelonForm();
-
-    Matrix Left = Aug.Extract(0, 0, rows, rows), Right = Aug.Extract(0, 4, rows, rows);
-    if (Right != Id)
+    LUDecomposition factors(*this);
+    if (factors.IsSingular())
         return ErrorMatrix();
     else
-        return Left;
+        return factors.Inverse();
+}
+MathVector Matrix::Solve(const MathVector& b) const
+{
+    return LUDecomposition(*this).Solve(b);
+}
+Matrix Matrix::Solve(const Matrix& B) const
+{
+    return LUDecomposition(*this).Solve(B);
+}
+MathVector Matrix::SolveLeastSquares(const MathVector& b) const
+{
+    return QRDecomposition(*this).SolveLeastSquares(b);
+}
+Matrix Matrix::SolveLeastSquares(const Matrix& B) const
+{
+    return QRDecomposition(*this).SolveLeastSquares(B);
 }
 Matrix Matrix::Transpose() const
 {
-    Matrix result(*this);
-    result.TransposeInplace();
+    if (!this->IsValid())
+        return ErrorMatrix();
+
+    Matrix result(cols, rows);
+    ViewTranspose(result.View(), this->View());
 
     return result;
 }
 void Matrix::TransposeInplace()
-{
-    for (unsigned i = 0; i < rows; i++)
-        for (unsigned j = 0; j < cols; j++)
-            std::swap(Data[i][j], Data[j][i]);
-}
-void Matrix::RowEchelonForm()
 {
     if (!this->IsValid())
         return;
 
-    unsigned currentRow = 0;
-
-    for (unsigned current_col = 0; current_col < cols; current_col++)
+    if (rows == cols)
     {
-        unsigned pivot_row = current_col;
-        while (pivot_row < rows && this->Data[pivot_row][current_col] == 0)
-            pivot_row++;
+        TransposeSquareInPlace(Data.data(), stride, rows);
+        return;
+    }
 
-        if (pivot_row < rows)
-        {
-            this->RowSwap(currentRow, pivot_row);
+    /*
+     * A rectangular transpose changes the row length, and so (possibly) the stride. The rows are first packed
+     * together, the packed block is transposed in place, and then the new rows are spread back out to the new stride.
+     */
+    for (size_t i = 1; i < rows; i++)
+        std::copy_n(RowData(i), cols, Data.data() + i * cols);
 
-            double pivot_value = this->Data[currentRow][current_col];
-            for (unsigned col = current_col; col < cols; col++)
-                this->Data[currentRow][col] /= pivot_value;
+    TransposePackedInPlace(Data.data(), rows, cols);
 
-            for (unsigned row = currentRow + 1; row < rows; row++)
-            {
-                double mul = this->Data[row][current_col];
-                for (unsigned col = current_col; col < cols; col++)
-                    this->Data[row][col] -= mul * this->Data[currentRow][col];
-            }
+    std::swap(rows, cols);
+    stride = PaddedStride(cols);
+    Data.resize(rows * stride);
 
-            currentRow++;
-        }
+    if (stride != cols)
+    {
+        for (size_t i = rows; i-- > 1; )
+            std::copy_backward(Data.data() + i * cols, Data.data() + (i + 1) * cols, RowData(i) + cols);
+        for (size_t i = 0; i < rows; i++)
+            std::fill(RowData(i) + cols, RowData(i) + stride, 0.0);
     }
 }
-void Matrix::ReducedRowEchelonForm()
+EliminationResult Matrix::RowEchelonForm(double Tolerance)
 {
-    this->RowEchelonForm();
-
-    unsigned lead = 0;
-
-    for (unsigned r = 0; r < cols; r++)
-    {
-        if (lead >= cols)
-            break;
-
-        unsigned i = r;
-        while (this->Data[i][lead] == 0)
-        {
-            i++;
-            if (i == rows)
-            {
-                i = r;
-                lead++;
-                if (lead == cols)
-                    break;
-            }
-        }
-
-        if (lead < cols)
-        {
-            this->RowSwap(i, r);
-            double divisor = this->Data[r][lead];
-            if (divisor == 0)
-            {
-                for (unsigned j = 0; j < cols; j++)
-                    this->Data[r][j] /= divisor;
-            }
-
-            for (unsigned k = 0; k < rows; k++)
-            {
-                if (k != r)
-                {
-                    double factor = this->Data[k][lead];
-                    for (unsigned j = 0; j < cols; j++)
-                        this->Data[k][j] = factor * this->Data[r][j];
-                }
-            }
-        }
-
-        lead++;
-    }
-
-    size_t Lead = 0;
-    size_t Rows = this->rows, Columns = this->cols;
-    for (unsigned int r = 0; r < Rows; r++)
-    {
-        if (Columns < Lead)
-            return;
-        unsigned i = r;
-        while (Data[i][Lead] == 0)
-        {
-            i++;
-            Lead++;
-            if (Columns == Lead)
-                return;
-        }
-
-        if (i != r)
-            RowSwap(i, r);
+    return RowReduce(View(), RRF_Echelon, Tolerance);
+}
+EliminationResult Matrix::ReducedRowEchelonForm(double Tolerance)
+{
+    return RowReduce(View(), RRF_Reduced, Tolerance);
+}
+size_t Matrix::Rank(double Tolerance) const
+{
+    Matrix copy(*this);
+    return copy.RowEchelonForm(Tolerance).Rank;
+}
 
-        for (unsigned int j = 0; j < Columns; j++)
-            Data[r][j] /= Data[r][Lead];
+double Matrix::FrobeniusNorm() const noexcept
+{
+    const auto& simd = SimdKernels();
+    double sum = 0;
+    for (size_t i = 0; i < rows; i++)
+        sum += simd.Dot(RowData(i), RowData(i), cols);
 
-        for (unsigned int j = 0; j < Rows; j++)
-        {
-            if (j != r)
-                RowAdd(r, -Data[j][Lead], j);
-        }
-        Lead++;
-    }
+    return std::sqrt(sum);
+}
+double Matrix::SpectralNorm() const
+{
+    return SingularValueDecomposition(*this, { .ComputeVectors = false, .Count = 1 }).Norm();
+}
+double Matrix::ConditionNumber() const
+{
+    return SingularValueDecomposition(*this, { .ComputeVectors = false }).ConditionNumber();
 }
 
 bool Matrix::operator==(const VariableType& two) const noexcept
@@ -380,143 +372,9 @@ bool Matrix::operator!=(const Matrix& two) const noexcept
     return !(*this == two);
 }
 
-Matrix::ColumnSchema Matrix::GetColumnWidthSchematic() const noexcept
-{
-    /*
-        This algorithm will find the largest width of each column, and store the result in the result value.
-
-        For instance:
-
-        [4 3 1 2]
-        [33 4 1 -2]
-        [5 -44.3 2 1]
-
-        Which evaluates to:
-        [(false, 2), (true, 5), (false, 1), (true, 2)]
-
-        Which can be used to re-format the matrix when printing to be:
-        [4   3    1  2]
-        [33  4    1 -2]
-        [5  -44.3 2  1]
-    */
-    ColumnSchema result;
-
-    for (unsigned j = 0; j < this->cols; j++)
-    {
-        bool negative_found = false;
-        unsigned long largest_num = 0;
-        for (unsigned i = 0; i < this->rows; i++)
-        {
-            const double& curr = this->Data[i][j];
-            if (curr < 0)
-                negative_found = true;
-
-            unsigned long as_str_l;
-            {
-                std::stringstream temp;
-                temp << curr;
-                as_str_l = static_cast<unsigned long>(temp.str().length());
-
-                if (curr < 0) //Removes negative from the computation.
-                    as_str_l--;
-            }
-
-            largest_num = std::max(as_str_l, largest_num);
-        }
-
-        result.emplace_back(negative_found, largest_num);
-    }
-
-    return result;
-}
-bool Matrix::GetRowString(std::ostream& out, unsigned row, Matrix::ColumnSchema& schema, char open, char close) const
-{
-    if (row > this->rows)
-        return false;
-
-    /*
-        Convert the number to a string
-        If the length of that string is less than the maximum of the column, then add extra spaces to the end till it meets the maximum.
-        If there is a negative in that column, and the current number is not negative, add one to the beginning of the string, and remove one from the end. If it is negative, do not add any extra spaces.
-        Repeat this for each number for each column and row, and put a space between columns.
-    */
-
-    out << open << ' ';
-    const auto& host = this->Data[row];
-    for (unsigned i = 0; i < this->cols; i++)
-    {
-        const auto&[has_negative, width] = schema[i];
-
-        double curr = host[i];
-        if (curr >= 0 && has_negative)
-            out << ' ';
-
-        std::string curr_str;
-        {
-            std::stringstream temp;
-            temp << curr;
-            curr_str = temp.str();
-        }
-
-
-        if (((has_negative && curr_str.length() < width + 1) || curr_str.length() < width))
-        {
-            unsigned long diff = width - (curr_str.length()) + (curr < 0 ? 1 : 0);
-            std::string space_str;
-            //if (has_negative && i != this->cols - 1) //If not in last row
-            //   diff += (curr < 0 ? 1 : 0); //If negative, add one extra space after.
-
-            for (unsigned t = 0; t < diff; t++)
-                space_str += ' ';
-
-            curr_str += space_str;
-        }
-        out << curr_str << ' ';
-    }
-
-    out << close;
-    return out.good(); //If out.bad(), this returns false.
-}
 void Matrix::ui_dsp_fmt(std::ostream& out) const noexcept
 {
-    if (!this->IsValid())
-    {
-        out << "[ ]";
-        return;
-    }
-
-    auto schema = this->GetColumnWidthSchematic();
-
-    if (this->rows == 1)
-    {
-        if (!this->GetRowString(out, 0, schema, '[', ']'))
-            std::cerr << "FAILED TO PRINT LINE 0" << std::endl;
-        else
-            out << '\n';
-    }
-    else
-    {
-        // ⌊ ⌋ ⌈ ⌉ |
-
-        for (unsigned i = 0; i < rows; i++)
-        {
-            char open, close;
-            if (i == 0 || i == rows - 1) //First and last rows
-            {
-                open = '[';
-                close = ']';
-            }
-            else
-                open = close = '|';
-
-            if (!this->GetRowString(out, i, schema, open, close)) //Returns false if could not print properly.
-                std::cerr << "FAILED TO PRINT LINE " << i << std::endl;
-            else
-                out << '\n';
-        }
-    }
-
-
+    ViewPrint(out, this->View());
 }
 void Matrix::dbg_fmt(std::ostream& out) const noexcept
 {
@@ -529,9 +387,9 @@ void Matrix::dsp_fmt(std::ostream& out) const noexcept
     else
     {
         out << "[ ";
-        for (const auto& row : this->Data)
+        for (size_t i = 0; i < this->rows; i++)
         {
-            for (const auto& item : row)
+            for (const auto& item : (*this)[i])
                 out << ' ' << item;
             out << ";";
         }
@@ -542,8 +400,8 @@ void Matrix::dsp_fmt(std::ostream& out) const noexcept
 void Matrix::str_serialize(std::ostream &out) const noexcept
 {
     out << VariableTypes::VT_Matrix << ' ' << this->rows << ' ' << this->cols;
-    for (const auto& rows : this->Data)
-        for (const auto& item : rows)
+    for (size_t i = 0; i < this->rows; i++)
+        for (const auto& item : (*this)[i])
             out << ' ' << item;
 }
 void Matrix::str_deserialize(std::istream &in)
@@ -561,13 +419,14 @@ void Matrix::str_deserialize(std::istream &in)
         return;
     }
     
-    this->Data.resize(rows, std::vector<double>(cols));
+    this->Allocate(rows, cols);
     size_t count = 0;
-    for (auto& row : this->Data)
+    for (size_t i = 0; i < rows && in; i++)
     {
-        for (auto& element : row)
+        for (auto& element : (*this)[i])
         {
-            in >> element;
+            if (!(in >> element))
+                break;
             count++;
         }
     }
@@ -575,6 +434,32 @@ void Matrix::str_deserialize(std::istream &in)
     if (count != rows * cols)
         throw FormatError("not enough elements provided");
 }
+size_t Matrix::bin_size() const noexcept
+{
+    return 2 * sizeof(uint64_t) + this->rows * this->cols * sizeof(double);
+}
+void Matrix::bin_serialize(BinaryWriter& out) const
+{
+    out.Write<uint64_t>(this->rows);
+    out.Write<uint64_t>(this->cols);
+    for (size_t i = 0; i < this->rows; i++)
+        out.WriteDoubles(this->RowData(i), this->cols);
+}
+void Matrix::bin_deserialize(BinaryReader& in)
+{
+    auto rows = in.Read<uint64_t>(), cols = in.Read<uint64_t>();
+    if (rows == 0 || cols == 0)
+    {
+        *this = Matrix();
+        return;
+    }
+    if (cols > in.Remaining() / sizeof(double) || rows > in.Remaining() / sizeof(double) / cols)
+        throw FormatError("binary data", "not enough elements provided");
+
+    this->Allocate(rows, cols);
+    for (size_t i = 0; i < rows; i++)
+        in.ReadDoubles(this->RowData(i), cols);
+}
 
 Matrix Matrix::operator|(const Matrix& Two) const
 {
@@ -590,38 +475,23 @@ Matrix Matrix::operator|(const Matrix& Two) const
     if (!Return.IsValid())
         throw std::exception(); //Not supposed to happen, just in case though.
 
-    unsigned i = 0;
-    for (auto& resultRow : Return.Data)
-    {
-        unsigned int j = 0;
-        auto currElem = resultRow.begin(), end = resultRow.end();
-        for (; j < OneColumns && currElem != end; j++, currElem++)
-            *currElem = this->Data[i][j];
-        for (j = 0; j < TwoColumns && currElem != end; j++, currElem++)
-            *currElem = Two.Data[i][j];
-
-        i++;
-    }
+    ViewCopy(Return.Block(0, 0, OneRows, OneColumns), this->View());
+    ViewCopy(Return.Block(0, OneColumns, OneRows, TwoColumns), Two.View());
 
     return Return;
 }
 
-Matrix Matrix::operator+(const Matrix& Two) const
-{
-    Matrix result(*this);
-    result += Two;
-    return result;
-}
-Matrix Matrix::operator-(const Matrix& Two) const
-{
-    Matrix result(*this);
-    result -= Two;
-    return result;
-}
 Matrix Matrix::operator*(const Matrix& Two) const
 {
-    Matrix result(*this);
-    result.operator*=(Two);
+    if (!this->IsValid() || !Two.IsValid())
+        throw OperatorError('*', *this, Two, "empty matrix");
+
+    if (this->cols != Two.rows)
+        throw OperatorError('*', this->GetTypeString(), Two.GetTypeString(), "dimension mismatch");
+
+    Matrix result(this->rows, Two.cols);
+    ViewMultiply(result.View(), this->View(), Two.View());
+
     return result;
 }
 
@@ -633,9 +503,8 @@ Matrix& Matrix::operator+=(const Matrix& Two)
     if (this->rows != Two.rows || this->cols != Two.cols)
         throw OperatorError('+', this->GetTypeString(), Two.GetTypeString(), "dimension mismatch");
 
-    for (unsigned i = 0; i < this->rows; i++)
-        for (unsigned j = 0; j < this->cols; j++)
-            this->Data[i][j] += Two.Data[i][j];
+    //Both matrices share the same stride, and the padding is zero on both, so the whole buffer can be processed at once.
+    SimdKernels().Add(this->Data.data(), Two.Data.data(), this->Data.size());
 
     return *this;
 }
@@ -647,38 +516,35 @@ Matrix& Matrix::operator-=(const Matrix& Two)
     if (this->rows != Two.rows || this->cols != Two.cols)
         throw OperatorError('-', this->GetTypeString(), Two.GetTypeString(), "dimension mismatch");
 
-    for (unsigned i = 0; i < this->rows; i++)
-        for (unsigned j = 0; j < this->cols; j++)
-            this->Data[i][j] -= Two.Data[i][j];
+    SimdKernels().Subtract(this->Data.data(), Two.Data.data(), this->Data.size());
 
     return *this;
 }
-Matrix& Matrix::operator*=(const Matrix& Two)
+Matrix& Matrix::AddScaled(const Matrix& Two, double Fac)
 {
     if (!this->IsValid() || !Two.IsValid())
-        throw OperatorError('*', *this, Two, "empty matrix");
+        throw OperatorError('+', *this, Two, "empty matrix");
 
     if (this->rows != Two.rows || this->cols != Two.cols)
-        throw OperatorError('*', this->GetTypeString(), Two.GetTypeString(), "dimension mismatch");
-
-    auto r = this->rows, c = Two.cols;
-
-    for (unsigned i = 0; i < r; i++)
-    {
-        for (unsigned j = 0; j < c; j++)
-        {
-            double calc = 0; //Since this is a matrix multiplication, I cannot reset the value at Data[i][j] since it will interfere with the calculation.
-            for (unsigned k = 0; k < Two.rows; k++)
-                calc += this->Data[i][k] * Two.Data[k][j];
+        throw OperatorError('+', this->GetTypeString(), Two.GetTypeString(), "dimension mismatch");
 
-            this->Data[i][j] = calc;
-        }
-    }
+    const auto& simd = SimdKernels();
+    if (this->stride == this->cols)
+        simd.Axpy(this->Data.data(), Fac, Two.Data.data(), this->Data.size());
+    else
+        for (size_t i = 0; i < this->rows; i++)
+            simd.Axpy(this->RowData(i), Fac, Two.RowData(i), this->cols);
 
     return *this;
 }
+Matrix& Matrix::operator*=(const Matrix& Two)
+{
+    //The product cannot be formed in place, since every element of the result depends on a full row of this matrix.
+    *this = *this * Two;
+    return *this;
+}
 
-Matrix Matrix::Pow(unsigned long long Two) const
+Matrix Matrix::Pow(unsigned long long Two, MatrixPowMode Mode) const
 {
     if (!this->IsValid())
         throw OperatorError('^', this->GetTypeString(), "(Scalar:" + std::to_string(Two) + ")", "Empty Matrix");
@@ -687,15 +553,119 @@ Matrix Matrix::Pow(unsigned long long Two) const
         return Matrix::Identity(this->rows, this->cols);
     else if (Two == 1)
         return *this;
-    else
-    {
-        if (!this->IsSquare())
-            throw OperatorError('^', this->GetTypeString(), "(Scalar:" + std::to_string(Two) + ")", "Non-square matrix does not support powers greater than 1");
 
-        Matrix result(*this);
-        for (unsigned long long i = 1; i < Two; i++)
-            result *= *this;
+    if (!this->IsSquare())
+        throw OperatorError('^', this->GetTypeString(), "(Scalar:" + std::to_string(Two) + ")", "Non-square matrix does not support powers greater than 1");
+
+    if (this->IsDiagonal())
+    {
+        Matrix result(rows, cols);
+        for (size_t i = 0; i < rows; i++)
+            result.RowData(i)[i] = std::pow(this->RowData(i)[i], static_cast<double>(Two));
 
         return result;
     }
+
+    if (Mode == MPM_Spectral && this->IsSymmetric())
+        return SymmetricEigen(*this).Pow(Two);
+
+    /*
+     * Exponentiation by squaring: walk the bits of the power from the lowest, squaring the base each step and
+     * multiplying it into the result when the bit is set. This takes O(log Two) products instead of Two - 1.
+     * Triangular inputs stay triangular under multiplication, so they use a product that skips the zero half.
+     */
+    bool upper = this->IsUpperTriangular(), lower = !upper && this->IsLowerTriangular();
+    auto multiply = [upper, lower](const Matrix& One, const Matrix& Two) -> Matrix
+    {
+        if (upper)
+            return TriangularProduct(One, Two, true);
+        else if (lower)
+            return TriangularProduct(One, Two, false);
+        else
+            return One * Two;
+    };
+
+    Matrix base(*this);
+    std::optional<Matrix> result;
+    while (true)
+    {
+        if (Two & 1)
+            result = result ? multiply(*result, base) : base;
+
+        Two >>= 1;
+        if (Two == 0)
+            break;
+
+        base = multiply(base, base);
+    }
+
+    return std::move(*result);
+}
+Matrix Matrix::TriangularProduct(const Matrix& One, const Matrix& Two, bool Upper)
+{
+    //Row i of the result is the sum of One[i][k] * Two[k], where k only runs over the nonzero part of row i, and only the nonzero part of Two[k] is added.
+    size_t n = One.rows;
+    const auto& simd = SimdKernels();
+    Matrix result(n, n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const double* a = One.RowData(i);
+        double* c = result.RowData(i);
+        if (Upper)
+        {
+            for (size_t k = i; k < n; k++)
+                if (a[k] != 0)
+                    simd.Axpy(c + k, a[k], Two.RowData(k) + k, n - k);
+        }
+        else
+        {
+            for (size_t k = 0; k <= i; k++)
+                if (a[k] != 0)
+                    simd.Axpy(c, a[k], Two.RowData(k), k + 1);
+        }
+    }
+
+    return result;
+}
+
+bool Matrix::IsSymmetric() const noexcept
+{
+    if (!IsSquare())
+        return false;
+
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = i + 1; j < cols; j++)
+            if (RowData(i)[j] != RowData(j)[i])
+                return false;
+
+    return true;
+}
+bool Matrix::IsDiagonal() const noexcept
+{
+    return IsUpperTriangular() && IsLowerTriangular();
+}
+bool Matrix::IsUpperTriangular() const noexcept
+{
+    if (!IsSquare())
+        return false;
+
+    for (size_t i = 1; i < rows; i++)
+        for (size_t j = 0; j < i; j++)
+            if (RowData(i)[j] != 0)
+                return false;
+
+    return true;
+}
+bool Matrix::IsLowerTriangular() const noexcept
+{
+    if (!IsSquare())
+        return false;
+
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = i + 1; j < cols; j++)
+            if (RowData(i)[j] != 0)
+                return false;
+
+    return true;
 }
@@ -7,11 +7,74 @@
 
 #include "Constraints.h"
 #include "VariableType.h"
+#include "AlignedAllocator.h"
+#include "MatrixView.h"
+#include "RowReduction.h"
 #include "../Core/Errors.h"
 
 #include <vector>
 
 class MathVector;
+class LUDecomposition;
+class QRDecomposition;
+class CholeskyDecomposition;
+class SingularValueDecomposition;
+template<typename Derived>
+class MatrixExpression;
+
+/// <summary>
+/// Selects how Matrix::Pow computes its result.
+/// </summary>
+enum MatrixPowMode
+{
+    MPM_Squaring = 0, //Exponentiation by squaring. Exact up to rounding in each product.
+    MPM_Spectral = 1, //For symmetric matrices, uses V * diag(l^n) * V^T from a SymmetricEigen. Falls back to squaring otherwise.
+};
+
+/// <summary>
+/// Limits how much of a spectral decomposition (SymmetricEigen or SingularValueDecomposition) is computed.
+/// </summary>
+struct SpectralOptions
+{
+    /// <summary>
+    /// When false, only the values are computed, which skips the most expensive part of the decomposition.
+    /// </summary>
+    bool ComputeVectors = true;
+    /// <summary>
+    /// The number of values (and vectors) to compute, starting from the largest. Zero computes all of them.
+    /// </summary>
+    size_t Count = 0;
+};
+
+/// <summary>
+/// A non-owning view over a single row of a Matrix. The view is invalidated if the matrix is resized or destroyed.
+/// </summary>
+template<typename T>
+class MatrixRowView
+{
+private:
+    T* Start;
+    size_t Length;
+
+public:
+    MatrixRowView(T* Start, size_t Length) noexcept : Start(Start), Length(Length) { }
+
+    [[nodiscard]] T& operator[](size_t j) const
+    {
+        if (j >= Length)
+            throw std::logic_error("Out of range");
+
+        return Start[j];
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return Length; }
+    [[nodiscard]] T* data() const noexcept { return Start; }
+    [[nodiscard]] T* begin() const noexcept { return Start; }
+    [[nodiscard]] T* end() const noexcept { return Start + Length; }
+};
+
+using MatrixRow = MatrixRowView<double>;
+using ConstMatrixRow = MatrixRowView<const double>;
 
 /// <summary>
 /// Represents a rectangular arrangement of numbers for calculations, given some row and column definition.
@@ -20,44 +83,71 @@ class Matrix : public VariableType, public UIDisplayPrint
 {
 private:
     /// <summary>
-    /// The data stored in the matrix.
+    /// The data stored in the matrix, in one contiguous row-major block. Row i starts at Data[i * stride].
     /// </summary>
-    std::vector<std::vector<double>> Data;
+    std::vector<double, AlignedAllocator<double>> Data;
     size_t rows;
     size_t cols;
+    /// <summary>
+    /// The leading dimension, or the distance (in elements) between the start of two rows. Always >= cols, with the padding kept at zero.
+    /// </summary>
+    size_t stride;
 
     void Allocate(size_t NewRows, size_t NewColumns, double Value = 0) noexcept;
-
-    using ColumnSchema = std::vector<std::pair<bool, unsigned long>>;
-    [[nodiscard]] ColumnSchema GetColumnWidthSchematic() const noexcept;
-    [[nodiscard]] bool GetRowString(std::ostream& out, unsigned row, ColumnSchema& schema, char open, char close) const;
+    [[nodiscard]] static size_t PaddedStride(size_t Columns) noexcept;
+    [[nodiscard]] static Matrix TriangularProduct(const Matrix& One, const Matrix& Two, bool Upper);
 
     Matrix();
 
+    /// <summary>
+    /// Writes Op(this[i][j], Expr[i][j]) to every element, in one pass. The shapes must already match.
+    /// </summary>
+    template<typename E, typename Op>
+    void Assign(const MatrixExpression<E>& Expr, Op);
+
 public:
     Matrix(size_t Rows, size_t Columns) noexcept;
     [[maybe_unused]] explicit Matrix(const MathVector& in);
+    /// <summary>
+    /// Copies the contents of a view into a new, owning matrix.
+    /// </summary>
+    explicit Matrix(ConstMatrixView View);
     Matrix(const Matrix& Other) noexcept;
     Matrix(Matrix&& Other) noexcept;
+    /// <summary>
+    /// Evaluates a lazy expression, such as A + B - C * 2, in a single pass with no intermediate matrices.
+    /// </summary>
+    template<typename E>
+    Matrix(const MatrixExpression<E>& Expr);
 
     template<std::convertible_to<double>... args>
     [[nodiscard]] static Matrix FromList(size_t Rows, size_t Columns, args... vals);
 
     Matrix& operator=(const Matrix& Other) noexcept;
     Matrix& operator=(Matrix&& Other) noexcept;
+    template<typename E>
+    Matrix& operator=(const MatrixExpression<E>& Expr);
 
     friend std::ostream& operator<<(std::ostream&, const struct MatrixSingleLinePrint&);
 
-    [[nodiscard]] size_t Rows() const { return Data.size(); }
-    [[nodiscard]] size_t Columns() const { return Data.empty() ? 0 : Data[0].size(); }
+    [[nodiscard]] size_t Rows() const { return rows; }
+    [[nodiscard]] size_t Columns() const { return cols; }
+    [[nodiscard]] size_t LeadingDimension() const { return stride; }
     [[nodiscard]] bool IsValid() const { return rows != 0 && cols != 0; }
     [[nodiscard]] bool IsSquare() const { return IsValid() && rows == cols; }
+    [[nodiscard]] bool IsSymmetric() const noexcept;
+    [[nodiscard]] bool IsDiagonal() const noexcept;
+    [[nodiscard]] bool IsUpperTriangular() const noexcept;
+    [[nodiscard]] bool IsLowerTriangular() const noexcept;
 
     [[nodiscard]] std::unique_ptr<VariableType> Clone() const noexcept override;
     [[nodiscard]] VariableTypes GetType() const noexcept override;
 
     void str_serialize(std::ostream& out) const noexcept override;
     void str_deserialize(std::istream& in) override;
+    [[nodiscard]] size_t bin_size() const noexcept override;
+    void bin_serialize(BinaryWriter& out) const override;
+    void bin_deserialize(BinaryReader& in) override;
 
     void dbg_fmt(std::ostream& out) const noexcept override;
     void dsp_fmt(std::ostream& out) const noexcept override;
@@ -68,43 +158,110 @@ public:
     [[nodiscard]] static Matrix Identity(size_t Rows, size_t Cols);
     [[nodiscard]] [[maybe_unused]] static Matrix RandomMatrix(size_t Rows, size_t Columns, bool Integers);
 
-    [[nodiscard]] const std::vector<double>& operator[](size_t Row) const;
+    [[nodiscard]] ConstMatrixRow operator[](size_t Row) const;
+    [[nodiscard]] MatrixRow operator[](size_t Row);
     [[nodiscard]] const double& Access(size_t i, size_t j) const;
     [[nodiscard]] double& Access(size_t i, size_t j);
 
-    [[nodiscard]] Matrix Extract(size_t StartI, size_t StartJ, size_t RowCount, size_t ColumnCount);
+    /// <summary>
+    /// Returns a pointer to the first element of the row. No bounds checking is done, and the row is LeadingDimension() elements apart from the next one.
+    /// </summary>
+    [[nodiscard]] const double* RowData(size_t Row) const noexcept { return Data.data() + Row * stride; }
+    [[nodiscard]] double* RowData(size_t Row) noexcept { return Data.data() + Row * stride; }
+
+    /// <summary>
+    /// Views over the whole matrix, a sub-block, or a single column. None of these copy; they are invalidated if the matrix is resized or destroyed.
+    /// </summary>
+    [[nodiscard]] ConstMatrixView View() const noexcept { return { Data.data(), rows, cols, stride }; }
+    [[nodiscard]] MatrixView View() noexcept { return { Data.data(), rows, cols, stride }; }
+    [[nodiscard]] ConstMatrixView Block(size_t StartI, size_t StartJ, size_t RowCount, size_t ColumnCount) const { return View().Block(StartI, StartJ, RowCount, ColumnCount); }
+    [[nodiscard]] MatrixView Block(size_t StartI, size_t StartJ, size_t RowCount, size_t ColumnCount) { return View().Block(StartI, StartJ, RowCount, ColumnCount); }
+    [[nodiscard]] ConstMatrixView Column(size_t j) const { return View().Column(j); }
+    [[nodiscard]] MatrixView Column(size_t j) { return View().Column(j); }
+
+    /// <summary>
+    /// Copies a sub-block into a new matrix. Use Block() to work on the sub-block without copying.
+    /// </summary>
+    [[nodiscard]] Matrix Extract(size_t StartI, size_t StartJ, size_t RowCount, size_t ColumnCount) const;
 
     void RowSwap(size_t OrigRow, size_t NewRow);
     void RowAdd(size_t OrigRow, double Fac, size_t TargetRow);
 
+    /// <summary>
+    /// Computes the LU factorization of this (square) matrix. Keep the result around to reuse it for several solves.
+    /// </summary>
+    [[nodiscard]] LUDecomposition LU() const;
+    /// <summary>
+    /// Computes the Householder QR factorization of this matrix, which may be rectangular.
+    /// </summary>
+    [[nodiscard]] QRDecomposition QR() const;
+    /// <summary>
+    /// Computes the Cholesky factorization of this (symmetric positive definite) matrix. Throws if it is not positive definite.
+    /// </summary>
+    [[nodiscard]] CholeskyDecomposition Cholesky() const;
+    /// <summary>
+    /// Computes the singular value decomposition of this matrix, which may be rectangular.
+    /// </summary>
+    [[nodiscard]] SingularValueDecomposition SVD(const SpectralOptions& Options = {}) const;
     [[maybe_unused]] [[nodiscard]] double Determinant() const;
     [[maybe_unused]] [[nodiscard]] Matrix Invert() const;
+    /// <summary>
+    /// Solves this * x = b. For repeated solves against the same matrix, use LU() once and solve through that instead.
+    /// </summary>
+    [[nodiscard]] MathVector Solve(const MathVector& b) const;
+    [[nodiscard]] Matrix Solve(const Matrix& B) const;
+    /// <summary>
+    /// Finds the x minimizing ||this * x - b|| through QR, for a tall matrix with full column rank.
+    /// </summary>
+    [[nodiscard]] MathVector SolveLeastSquares(const MathVector& b) const;
+    [[nodiscard]] Matrix SolveLeastSquares(const Matrix& B) const;
     [[maybe_unused]] [[nodiscard]] Matrix Transpose() const;
     void TransposeInplace();
 
-    void RowEchelonForm();
-    void ReducedRowEchelonForm();
+    /// <summary>
+    /// Row reduces this matrix in place, with partial pivoting. Any candidate pivot at or below Tolerance (in absolute value) is treated as zero; the default picks one scaled to the matrix.
+    /// Returns the rank and the column of each pivot.
+    /// </summary>
+    EliminationResult RowEchelonForm(double Tolerance = AutomaticTolerance);
+    EliminationResult ReducedRowEchelonForm(double Tolerance = AutomaticTolerance);
+    [[nodiscard]] size_t Rank(double Tolerance = AutomaticTolerance) const;
+
+    /// <summary>
+    /// The square root of the sum of the squares of every element.
+    /// </summary>
+    [[nodiscard]] double FrobeniusNorm() const noexcept;
+    /// <summary>
+    /// The largest singular value. Only that value is computed, but the matrix is still reduced to bidiagonal form, so this costs O(mn min(m, n)).
+    /// </summary>
+    [[nodiscard]] double SpectralNorm() const;
+    /// <summary>
+    /// The ratio of the largest to the smallest singular value (infinite if the matrix is rank deficient), from a values only SVD.
+    /// </summary>
+    [[nodiscard]] double ConditionNumber() const;
 
     Matrix operator|(const Matrix& Two) const;
 
-    Matrix operator+(const Matrix& Two) const;
-    Matrix operator-(const Matrix& Two) const;
+    //Sums, differences, and scaling are lazy, and build the expressions declared in MatrixExpression.h. The product is computed immediately.
     Matrix operator*(const Matrix& Two) const;
 
-    template<typename T> requires IsScalarOrDouble<T>
-    Matrix operator*(const T& Two) const;
-    template<typename T> requires IsScalarOrDouble<T>
-    Matrix operator/(const T& Two) const;
-
     Matrix& operator+=(const Matrix& Two);
     Matrix& operator-=(const Matrix& Two);
+    template<typename E>
+    Matrix& operator+=(const MatrixExpression<E>& Expr);
+    template<typename E>
+    Matrix& operator-=(const MatrixExpression<E>& Expr);
     Matrix& operator*=(const Matrix& Two);
     template<typename T> requires IsScalarOrDouble<T>
     Matrix& operator*=(const T& Two);
     template<typename T> requires IsScalarOrDouble<T>
     Matrix& operator/=(const T& Two);
 
-    [[nodiscard]] Matrix Pow(unsigned long long Two) const;
+    /// <summary>
+    /// Computes this += Fac * Two in a single pass, without forming the scaled copy of Two.
+    /// </summary>
+    Matrix& AddScaled(const Matrix& Two, double Fac);
+
+    [[nodiscard]] Matrix Pow(unsigned long long Two, MatrixPowMode Mode = MPM_Squaring) const;
 
     bool operator==(const VariableType& two) const noexcept override;
     bool operator!=(const VariableType& two) const noexcept override;
@@ -113,5 +270,6 @@ public:
 };
 
 #include "MatrixT.tpp"
+#include "MatrixExpression.h"
 
 #endif //JASON_MATRIX_H
@@ -0,0 +1,263 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_MATRIXEXPRESSION_H
+#define JASON_MATRIXEXPRESSION_H
+
+#include "Matrix.h"
+#include "ExpressionOperators.h"
+#include "../Core/Errors.h"
+
+#include <concepts>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Lazy element-wise arithmetic for Matrix.
+ *
+ * A + B - C * 2 does not compute anything by itself. Each operator returns a small node that records its operands, so the full tree is known
+ * at compile time. When the tree is assigned to (or used to construct) a Matrix, every element of the result is computed in one loop,
+ * with one pass over memory and no intermediate matrices.
+ *
+ * Operands that are lvalues are held by reference, and temporaries are moved into the node that uses them, so an expression never refers to a
+ * matrix that has already been destroyed. Shapes are checked when each node is built, so errors still surface at the operator that caused them.
+ * Matrix products are not element-wise, and are computed immediately through ViewMultiply, with the result entering the tree as a temporary.
+ */
+
+/// <summary>
+/// The base of every lazy matrix expression. Derived types provide Rows(), Columns(), and Row(i), which returns something indexable by column, valid for the lifetime of the expression.
+/// </summary>
+template<typename Derived>
+class MatrixExpression
+{
+public:
+    [[nodiscard]] const Derived& Self() const noexcept { return static_cast<const Derived&>(*this); }
+
+    [[nodiscard]] bool IsValid() const noexcept { return Self().Rows() != 0 && Self().Columns() != 0; }
+    [[nodiscard]] std::string GetTypeString() const { return "(Matrix:" + std::to_string(Self().Rows()) + "x" + std::to_string(Self().Columns()) + ")"; }
+
+    /// <summary>
+    /// Computes the expression into a new matrix.
+    /// </summary>
+    [[nodiscard]] Matrix Evaluate() const { return Matrix(*this); }
+};
+
+/// <summary>
+/// A leaf referring to a matrix owned elsewhere.
+/// </summary>
+class MatrixReference : public MatrixExpression<MatrixReference>
+{
+private:
+    const Matrix& Target;
+
+public:
+    explicit MatrixReference(const Matrix& Target) noexcept : Target(Target) { }
+
+    [[nodiscard]] size_t Rows() const noexcept { return Target.Rows(); }
+    [[nodiscard]] size_t Columns() const noexcept { return Target.Columns(); }
+    [[nodiscard]] const double* Row(size_t i) const noexcept { return Target.RowData(i); }
+};
+/// <summary>
+/// A leaf owning a temporary matrix, such as the result of a product.
+/// </summary>
+class MatrixValue : public MatrixExpression<MatrixValue>
+{
+private:
+    Matrix Target;
+
+public:
+    explicit MatrixValue(Matrix&& Target) noexcept : Target(std::move(Target)) { }
+
+    [[nodiscard]] size_t Rows() const noexcept { return Target.Rows(); }
+    [[nodiscard]] size_t Columns() const noexcept { return Target.Columns(); }
+    [[nodiscard]] const double* Row(size_t i) const noexcept { return Target.RowData(i); }
+};
+
+template<typename T>
+concept IsMatrix = std::same_as<std::remove_cvref_t<T>, Matrix>;
+template<typename T>
+concept MatrixOperand = IsMatrix<T> || std::derived_from<std::remove_cvref_t<T>, MatrixExpression<std::remove_cvref_t<T>>>;
+
+/// <summary>
+/// Turns an operator argument into a node: a reference for matrix lvalues, an owning leaf for matrix temporaries, and the expression itself otherwise.
+/// </summary>
+template<MatrixOperand T>
+[[nodiscard]] auto AsMatrixNode(T&& Value)
+{
+    if constexpr (IsMatrix<T> && std::is_lvalue_reference_v<T>)
+        return MatrixReference(Value);
+    else if constexpr (IsMatrix<T>)
+        return MatrixValue(std::move(Value));
+    else
+        return std::remove_cvref_t<T>(std::forward<T>(Value));
+}
+template<typename T>
+using MatrixNode = decltype(AsMatrixNode(std::declval<T>()));
+
+/// <summary>
+/// One + Two or One - Two, element by element.
+/// </summary>
+template<typename L, typename R, typename Op>
+class MatrixBinaryExpression : public MatrixExpression<MatrixBinaryExpression<L, R, Op>>
+{
+private:
+    L One;
+    R Two;
+
+public:
+    MatrixBinaryExpression(L&& One, R&& Two) : One(std::move(One)), Two(std::move(Two))
+    {
+        if (!this->One.IsValid() || !this->Two.IsValid())
+            throw OperatorError(Op::Symbol, this->One.GetTypeString(), this->Two.GetTypeString(), "empty matrix");
+        if (this->One.Rows() != this->Two.Rows() || this->One.Columns() != this->Two.Columns())
+            throw OperatorError(Op::Symbol, this->One.GetTypeString(), this->Two.GetTypeString(), "dimension mismatch");
+    }
+
+    struct RowType
+    {
+        decltype(std::declval<const L&>().Row(0)) One;
+        decltype(std::declval<const R&>().Row(0)) Two;
+
+        [[nodiscard]] double operator[](size_t j) const noexcept { return Op::Apply(One[j], Two[j]); }
+    };
+
+    [[nodiscard]] size_t Rows() const noexcept { return One.Rows(); }
+    [[nodiscard]] size_t Columns() const noexcept { return One.Columns(); }
+    [[nodiscard]] RowType Row(size_t i) const noexcept { return { One.Row(i), Two.Row(i) }; }
+};
+
+/// <summary>
+/// Inner * Fac or Inner / Fac, element by element.
+/// </summary>
+template<typename E, typename Op>
+class MatrixScalarExpression : public MatrixExpression<MatrixScalarExpression<E, Op>>
+{
+private:
+    E Inner;
+    double Fac;
+
+public:
+    MatrixScalarExpression(E&& Inner, double Fac) : Inner(std::move(Inner)), Fac(Fac)
+    {
+        if (!this->Inner.IsValid())
+            throw OperatorError(Op::Symbol, this->Inner.GetTypeString(), "(Scalar:" + std::to_string(Fac) + ")", "empty matrix");
+        if (std::is_same_v<Op, ExpressionDivide> && Fac == 0)
+            throw OperatorError(Op::Symbol, this->Inner.GetTypeString(), "(Scalar:0)", "divide by zero");
+    }
+
+    struct RowType
+    {
+        decltype(std::declval<const E&>().Row(0)) Inner;
+        double Fac;
+
+        [[nodiscard]] double operator[](size_t j) const noexcept { return Op::Apply(Inner[j], Fac); }
+    };
+
+    [[nodiscard]] size_t Rows() const noexcept { return Inner.Rows(); }
+    [[nodiscard]] size_t Columns() const noexcept { return Inner.Columns(); }
+    [[nodiscard]] RowType Row(size_t i) const noexcept { return { Inner.Row(i), Fac }; }
+};
+
+template<MatrixOperand L, MatrixOperand R>
+[[nodiscard]] auto operator+(L&& One, R&& Two)
+{
+    return MatrixBinaryExpression<MatrixNode<L>, MatrixNode<R>, ExpressionAdd>(AsMatrixNode(std::forward<L>(One)), AsMatrixNode(std::forward<R>(Two)));
+}
+template<MatrixOperand L, MatrixOperand R>
+[[nodiscard]] auto operator-(L&& One, R&& Two)
+{
+    return MatrixBinaryExpression<MatrixNode<L>, MatrixNode<R>, ExpressionSubtract>(AsMatrixNode(std::forward<L>(One)), AsMatrixNode(std::forward<R>(Two)));
+}
+template<MatrixOperand L, ExpressionFactor T>
+[[nodiscard]] auto operator*(L&& One, const T& Fac)
+{
+    return MatrixScalarExpression<MatrixNode<L>, ExpressionMultiply>(AsMatrixNode(std::forward<L>(One)), static_cast<double>(Fac));
+}
+template<ExpressionFactor T, MatrixOperand R>
+[[nodiscard]] auto operator*(const T& Fac, R&& Two)
+{
+    return MatrixScalarExpression<MatrixNode<R>, ExpressionMultiply>(AsMatrixNode(std::forward<R>(Two)), static_cast<double>(Fac));
+}
+template<MatrixOperand L, ExpressionFactor T>
+[[nodiscard]] auto operator/(L&& One, const T& Fac)
+{
+    return MatrixScalarExpression<MatrixNode<L>, ExpressionDivide>(AsMatrixNode(std::forward<L>(One)), static_cast<double>(Fac));
+}
+template<MatrixOperand E>
+[[nodiscard]] auto operator-(E&& One)
+{
+    return MatrixScalarExpression<MatrixNode<E>, ExpressionMultiply>(AsMatrixNode(std::forward<E>(One)), -1.0);
+}
+
+/// <summary>
+/// A product where at least one side is an expression. The expression sides are evaluated first, then the product runs through the usual routine. Matrix * Matrix uses the member operator directly.
+/// </summary>
+template<MatrixOperand L, MatrixOperand R> requires (!(IsMatrix<L> && IsMatrix<R>))
+[[nodiscard]] Matrix operator*(L&& One, R&& Two)
+{
+    auto evaluate = [](const auto& Side) -> decltype(auto)
+    {
+        if constexpr (IsMatrix<decltype(Side)>)
+            return Side;
+        else
+            return Side.Evaluate();
+    };
+
+    decltype(auto) one = evaluate(One);
+    decltype(auto) two = evaluate(Two);
+    return one * two;
+}
+
+template<typename E>
+Matrix::Matrix(const MatrixExpression<E>& Expr) : Matrix(Expr.Self().Rows(), Expr.Self().Columns())
+{
+    Assign(Expr, ExpressionAssign());
+}
+template<typename E>
+Matrix& Matrix::operator=(const MatrixExpression<E>& Expr)
+{
+    //Every element of the result only reads the same element of each operand, so the expression can be written over one of its own operands, as in A = A + B.
+    if (this->rows != Expr.Self().Rows() || this->cols != Expr.Self().Columns())
+        return *this = Matrix(Expr);
+
+    Assign(Expr, ExpressionAssign());
+    return *this;
+}
+template<typename E>
+Matrix& Matrix::operator+=(const MatrixExpression<E>& Expr)
+{
+    if (!this->IsValid() || !Expr.IsValid())
+        throw OperatorError('+', this->GetTypeString(), Expr.GetTypeString(), "empty matrix");
+    if (this->rows != Expr.Self().Rows() || this->cols != Expr.Self().Columns())
+        throw OperatorError('+', this->GetTypeString(), Expr.GetTypeString(), "dimension mismatch");
+
+    Assign(Expr, ExpressionAdd());
+    return *this;
+}
+template<typename E>
+Matrix& Matrix::operator-=(const MatrixExpression<E>& Expr)
+{
+    if (!this->IsValid() || !Expr.IsValid())
+        throw OperatorError('-', this->GetTypeString(), Expr.GetTypeString(), "empty matrix");
+    if (this->rows != Expr.Self().Rows() || this->cols != Expr.Self().Columns())
+        throw OperatorError('-', this->GetTypeString(), Expr.GetTypeString(), "dimension mismatch");
+
+    Assign(Expr, ExpressionSubtract());
+    return *this;
+}
+template<typename E, typename Op>
+void Matrix::Assign(const MatrixExpression<E>& Expr, Op)
+{
+    const E& expr = Expr.Self();
+    for (size_t i = 0; i < this->rows; i++)
+    {
+        auto row = expr.Row(i);
+        double* out = this->RowData(i);
+        for (size_t j = 0; j < this->cols; j++)
+            out[j] = Op::Apply(out[j], row[j]);
+    }
+}
+
+#endif //JASON_MATRIXEXPRESSION_H
@@ -1,6 +1,7 @@
 #include "Matrix.h"
 
 #include "Scalar.h"
+#include "SimdKernels.h"
 #include "../Core/Errors.h"
 
 //Includes templated functions for matrix.
@@ -15,9 +16,9 @@ Matrix Matrix::FromList(size_t Rows, size_t Columns, args... vals)
     Matrix result(Rows, Columns);
     auto sCurr = conv.begin();
 
-    for (auto& row : result.Data)
+    for (size_t i = 0; i < Rows; i++)
     {
-        for (auto& element : row)
+        for (auto& element : result[i])
         {
             element = *sCurr;
             sCurr++;
@@ -27,21 +28,6 @@ Matrix Matrix::FromList(size_t Rows, size_t Columns, args... vals)
     return result;
 }
 
-template<typename T> requires IsScalarOrDouble<T>
-Matrix Matrix::operator*(const T& Two) const
-{
-    Matrix result(*this);
-    result.operator*=<T>(Two);
-    return result;
-}
-template<typename T> requires IsScalarOrDouble<T>
-Matrix Matrix::operator/(const T& Two) const
-{
-    Matrix result(*this);
-    result.operator/=<T>(Two);
-    return result;
-}
-
 template<typename T> requires IsScalarOrDouble<T>
 Matrix& Matrix::operator*=(const T& Two)
 {
@@ -49,9 +35,13 @@ Matrix& Matrix::operator*=(const T& Two)
         throw OperatorError('*', *this, Scalar(Two), "empty matrix");
 
     auto fac = static_cast<double>(Two);
-    for (auto& row : this->Data)
-        for (auto& element : row)
-            element *= fac;
+    const auto& simd = SimdKernels();
+    //Padded rows are processed one at a time, so that a non-finite factor cannot write NaN into the padding.
+    if (this->stride == this->cols)
+        simd.Scale(this->Data.data(), fac, this->Data.size());
+    else
+        for (size_t i = 0; i < this->rows; i++)
+            simd.Scale(this->RowData(i), fac, this->cols);
 
     return *this;
 }
@@ -65,9 +55,12 @@ Matrix& Matrix::operator/=(const T& Two)
     if (fac == 0)
         throw OperatorError('*', *this, Scalar(0), "divide by zero");
     
-    for (auto& row : this->Data)
-        for (auto& element : row)
-            element /= fac;
+    const auto& simd = SimdKernels();
+    if (this->stride == this->cols)
+        simd.Divide(this->Data.data(), fac, this->Data.size());
+    else
+        for (size_t i = 0; i < this->rows; i++)
+            simd.Divide(this->RowData(i), fac, this->cols);
 
     return *this;
 }
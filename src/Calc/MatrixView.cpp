@@ -0,0 +1,254 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "MatrixView.h"
+#include "Gemm.h"
+#include "SimdKernels.h"
+#include "Transpose.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    void RequireSameShape(ConstMatrixView One, ConstMatrixView Two)
+    {
+        if (One.Rows() != Two.Rows() || One.Columns() != Two.Columns())
+            throw std::logic_error("dimension mismatch");
+    }
+}
+
+void ViewCopy(MatrixView Out, ConstMatrixView In)
+{
+    RequireSameShape(Out, In);
+
+    for (size_t i = 0; i < Out.Rows(); i++)
+    {
+        if (Out.IsRowContiguous() && In.IsRowContiguous())
+            std::copy_n(In.RowData(i), In.Columns(), Out.RowData(i));
+        else
+            for (size_t j = 0; j < Out.Columns(); j++)
+                Out(i, j) = In(i, j);
+    }
+}
+void ViewAdd(MatrixView Out, ConstMatrixView In)
+{
+    RequireSameShape(Out, In);
+
+    const auto& simd = SimdKernels();
+    for (size_t i = 0; i < Out.Rows(); i++)
+    {
+        if (Out.IsRowContiguous() && In.IsRowContiguous())
+            simd.Add(Out.RowData(i), In.RowData(i), Out.Columns());
+        else
+            for (size_t j = 0; j < Out.Columns(); j++)
+                Out(i, j) += In(i, j);
+    }
+}
+void ViewSubtract(MatrixView Out, ConstMatrixView In)
+{
+    RequireSameShape(Out, In);
+
+    const auto& simd = SimdKernels();
+    for (size_t i = 0; i < Out.Rows(); i++)
+    {
+        if (Out.IsRowContiguous() && In.IsRowContiguous())
+            simd.Subtract(Out.RowData(i), In.RowData(i), Out.Columns());
+        else
+            for (size_t j = 0; j < Out.Columns(); j++)
+                Out(i, j) -= In(i, j);
+    }
+}
+void ViewAddScaled(MatrixView Out, ConstMatrixView In, double Fac)
+{
+    RequireSameShape(Out, In);
+
+    const auto& simd = SimdKernels();
+    for (size_t i = 0; i < Out.Rows(); i++)
+    {
+        if (Out.IsRowContiguous() && In.IsRowContiguous())
+            simd.Axpy(Out.RowData(i), Fac, In.RowData(i), Out.Columns());
+        else
+            for (size_t j = 0; j < Out.Columns(); j++)
+                Out(i, j) += Fac * In(i, j);
+    }
+}
+void ViewScale(MatrixView Out, double Fac)
+{
+    const auto& simd = SimdKernels();
+    for (size_t i = 0; i < Out.Rows(); i++)
+    {
+        if (Out.IsRowContiguous())
+            simd.Scale(Out.RowData(i), Fac, Out.Columns());
+        else
+            for (size_t j = 0; j < Out.Columns(); j++)
+                Out(i, j) *= Fac;
+    }
+}
+void ViewTranspose(MatrixView Out, ConstMatrixView In)
+{
+    if (Out.IsRowContiguous() && In.IsRowContiguous())
+    {
+        RequireSameShape(Out, In.Transposed());
+        TransposeCopy(In.Data(), In.RowStride(), Out.Data(), Out.RowStride(), In.Rows(), In.Columns());
+    }
+    else
+        ViewCopy(Out, In.Transposed());
+}
+void ViewMultiply(MatrixView Out, ConstMatrixView A, ConstMatrixView B, double Alpha, double Beta)
+{
+    if (A.Columns() != B.Rows() || Out.Rows() != A.Rows() || Out.Columns() != B.Columns())
+        throw std::logic_error("dimension mismatch");
+
+    GemmStrided(Out.Rows(), Out.Columns(), A.Columns(),
+                Alpha, A.Data(), A.RowStride(), A.ColumnStride(),
+                B.Data(), B.RowStride(), B.ColumnStride(),
+                Beta, Out.Data(), Out.RowStride(), Out.ColumnStride());
+}
+
+namespace
+{
+    using ColumnSchema = std::vector<std::pair<bool, unsigned long>>;
+
+    ColumnSchema GetColumnWidthSchematic(ConstMatrixView View) noexcept
+    {
+        /*
+            This algorithm will find the largest width of each column, and store the result in the result value.
+
+            For instance:
+
+            [4 3 1 2]
+            [33 4 1 -2]
+            [5 -44.3 2 1]
+
+            Which evaluates to:
+            [(false, 2), (true, 5), (false, 1), (true, 2)]
+
+            Which can be used to re-format the matrix when printing to be:
+            [4   3    1  2]
+            [33  4    1 -2]
+            [5  -44.3 2  1]
+        */
+        ColumnSchema result;
+
+        for (unsigned j = 0; j < View.Columns(); j++)
+        {
+            bool negative_found = false;
+            unsigned long largest_num = 0;
+            for (unsigned i = 0; i < View.Rows(); i++)
+            {
+                const double& curr = View(i, j);
+                if (curr < 0)
+                    negative_found = true;
+
+                unsigned long as_str_l;
+                {
+                    std::stringstream temp;
+                    temp << curr;
+                    as_str_l = static_cast<unsigned long>(temp.str().length());
+
+                    if (curr < 0) //Removes negative from the computation.
+                        as_str_l--;
+                }
+
+                largest_num = std::max(as_str_l, largest_num);
+            }
+
+            result.emplace_back(negative_found, largest_num);
+        }
+
+        return result;
+    }
+    bool GetRowString(std::ostream& out, ConstMatrixView View, unsigned row, ColumnSchema& schema, char open, char close)
+    {
+        if (row >= View.Rows())
+            return false;
+
+        /*
+            Convert the number to a string
+            If the length of that string is less than the maximum of the column, then add extra spaces to the end till it meets the maximum.
+            If there is a negative in that column, and the current number is not negative, add one to the beginning of the string, and remove one from the end. If it is negative, do not add any extra spaces.
+            Repeat this for each number for each column and row, and put a space between columns.
+        */
+
+        out << open << ' ';
+        for (unsigned i = 0; i < View.Columns(); i++)
+        {
+            const auto&[has_negative, width] = schema[i];
+
+            double curr = View(row, i);
+            if (curr >= 0 && has_negative)
+                out << ' ';
+
+            std::string curr_str;
+            {
+                std::stringstream temp;
+                temp << curr;
+                curr_str = temp.str();
+            }
+
+
+            if (((has_negative && curr_str.length() < width + 1) || curr_str.length() < width))
+            {
+                unsigned long diff = width - (curr_str.length()) + (curr < 0 ? 1 : 0);
+                std::string space_str;
+                //if (has_negative && i != this->cols - 1) //If not in last row
+                //   diff += (curr < 0 ? 1 : 0); //If negative, add one extra space after.
+
+                for (unsigned t = 0; t < diff; t++)
+                    space_str += ' ';
+
+                curr_str += space_str;
+            }
+            out << curr_str << ' ';
+        }
+
+        out << close;
+        return out.good(); //If out.bad(), this returns false.
+    }
+}
+
+void ViewPrint(std::ostream& out, ConstMatrixView View)
+{
+    if (!View.IsValid())
+    {
+        out << "[ ]";
+        return;
+    }
+
+    auto schema = GetColumnWidthSchematic(View);
+    size_t rows = View.Rows();
+
+    if (rows == 1)
+    {
+        if (!GetRowString(out, View, 0, schema, '[', ']'))
+            std::cerr << "FAILED TO PRINT LINE 0" << std::endl;
+        else
+            out << '\n';
+    }
+    else
+    {
+        // ⌊ ⌋ ⌈ ⌉ |
+
+        for (unsigned i = 0; i < rows; i++)
+        {
+            char open, close;
+            if (i == 0 || i == rows - 1) //First and last rows
+            {
+                open = '[';
+                close = ']';
+            }
+            else
+                open = close = '|';
+
+            if (!GetRowString(out, View, i, schema, open, close)) //Returns false if could not print properly.
+                std::cerr << "FAILED TO PRINT LINE " << i << std::endl;
+            else
+                out << '\n';
+        }
+    }
+}
+
@@ -0,0 +1,110 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_MATRIXVIEW_H
+#define JASON_MATRIXVIEW_H
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+/// <summary>
+/// A non-owning, rectangular window into matrix storage. Element (i, j) lives at Start[i * RowStride + j * ColumnStride], so sub-blocks, single rows and columns, and transposes are all views over the same memory, with no copying.
+/// The view is invalidated if the matrix it came from is resized or destroyed.
+/// </summary>
+template<typename T>
+class BasicMatrixView
+{
+private:
+    T* Start = nullptr;
+    size_t rows = 0;
+    size_t cols = 0;
+    size_t rowStride = 0;
+    size_t colStride = 1;
+
+public:
+    BasicMatrixView() noexcept = default;
+    BasicMatrixView(T* Start, size_t Rows, size_t Columns, size_t RowStride, size_t ColumnStride = 1) noexcept :
+        Start(Start), rows(Rows), cols(Columns), rowStride(RowStride), colStride(ColumnStride) { }
+
+    /// <summary>
+    /// Allows a mutable view to be passed wherever a const view is expected.
+    /// </summary>
+    template<typename U> requires (std::is_const_v<T> && std::is_same_v<std::remove_const_t<T>, U>)
+    BasicMatrixView(const BasicMatrixView<U>& Obj) noexcept :
+        Start(Obj.Data()), rows(Obj.Rows()), cols(Obj.Columns()), rowStride(Obj.RowStride()), colStride(Obj.ColumnStride()) { }
+
+    [[nodiscard]] T* Data() const noexcept { return Start; }
+    [[nodiscard]] size_t Rows() const noexcept { return rows; }
+    [[nodiscard]] size_t Columns() const noexcept { return cols; }
+    [[nodiscard]] size_t RowStride() const noexcept { return rowStride; }
+    [[nodiscard]] size_t ColumnStride() const noexcept { return colStride; }
+    [[nodiscard]] bool IsValid() const noexcept { return Start && rows != 0 && cols != 0; }
+    /// <summary>
+    /// True if the elements of each row are next to each other in memory, so that RowData() can be used.
+    /// </summary>
+    [[nodiscard]] bool IsRowContiguous() const noexcept { return colStride == 1; }
+
+    /// <summary>
+    /// Unchecked element access.
+    /// </summary>
+    [[nodiscard]] T& operator()(size_t i, size_t j) const noexcept { return Start[i * rowStride + j * colStride]; }
+    [[nodiscard]] T& Access(size_t i, size_t j) const
+    {
+        if (i >= rows || j >= cols)
+            throw std::logic_error("Out of range");
+
+        return (*this)(i, j);
+    }
+    /// <summary>
+    /// The first element of a row. Only meaningful as an array when IsRowContiguous() is true.
+    /// </summary>
+    [[nodiscard]] T* RowData(size_t i) const noexcept { return Start + i * rowStride; }
+
+    /// <summary>
+    /// Returns the RowCount x ColumnCount sub-block starting at (StartI, StartJ).
+    /// </summary>
+    [[nodiscard]] BasicMatrixView Block(size_t StartI, size_t StartJ, size_t RowCount, size_t ColumnCount) const
+    {
+        if (StartI + RowCount > rows || StartJ + ColumnCount > cols)
+            throw std::logic_error("The index was out of range for that size.");
+
+        return { Start + StartI * rowStride + StartJ * colStride, RowCount, ColumnCount, rowStride, colStride };
+    }
+    [[nodiscard]] BasicMatrixView Row(size_t i) const { return Block(i, 0, 1, cols); }
+    [[nodiscard]] BasicMatrixView Column(size_t j) const { return Block(0, j, rows, 1); }
+    /// <summary>
+    /// Returns the transpose of this view, by swapping the strides.
+    /// </summary>
+    [[nodiscard]] BasicMatrixView Transposed() const noexcept { return { Start, cols, rows, colStride, rowStride }; }
+};
+
+using MatrixView = BasicMatrixView<double>;
+using ConstMatrixView = BasicMatrixView<const double>;
+
+/*
+ * View kernels. Every kernel checks that the shapes agree, and throws std::logic_error if they do not.
+ * Out may be the same view as In for the element-wise kernels, but must not partially overlap it.
+ */
+
+/// @brief Out = In
+void ViewCopy(MatrixView Out, ConstMatrixView In);
+/// @brief Out += In
+void ViewAdd(MatrixView Out, ConstMatrixView In);
+/// @brief Out -= In
+void ViewSubtract(MatrixView Out, ConstMatrixView In);
+/// @brief Out += Fac * In
+void ViewAddScaled(MatrixView Out, ConstMatrixView In, double Fac);
+/// @brief Out *= Fac
+void ViewScale(MatrixView Out, double Fac);
+/// @brief Out = In^T
+void ViewTranspose(MatrixView Out, ConstMatrixView In);
+/// @brief Out = Alpha * A * B + Beta * Out. Out must not overlap A or B.
+void ViewMultiply(MatrixView Out, ConstMatrixView A, ConstMatrixView B, double Alpha = 1.0, double Beta = 0.0);
+
+/// @brief Prints the view in the same aligned, multi-line layout as Matrix::ui_dsp_fmt.
+void ViewPrint(std::ostream& out, ConstMatrixView View);
+
+#endif //JASON_MATRIXVIEW_H
@@ -6,8 +6,23 @@
 #define JASON_NUMERICS_H
 
 #include "Scalar.h"
+#include "Value.h"
 #include "Complex.h"
+#include "ComplexVector.h"
+#include "ComplexMatrix.h"
+#include "Fft.h"
 #include "MathVector.h"
+#include "VectorBatch.h"
+#include "VectorMath.h"
 #include "Matrix.h"
+#include "FixedMatrix.h"
+#include "SparseMatrix.h"
+#include "LUDecomposition.h"
+#include "QRDecomposition.h"
+#include "CholeskyDecomposition.h"
+#include "RowReduction.h"
+#include "SymmetricEigen.h"
+#include "SingularValueDecomposition.h"
+#include "IterativeSolvers.h"
 
 #endif //JASON_NUMERICS_H
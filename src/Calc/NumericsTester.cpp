@@ -5,16 +5,1954 @@
 //  Created by Hollan on 12/18/24.
 //
 
+#include "NumericsTester.h"
 #include "Scalar.h"
 #include "MathVector.h"
+#include "SmallBuffer.h"
 #include "Matrix.h"
 #include "Complex.h"
+#include "LUDecomposition.h"
+#include "RowReduction.h"
+#include "FixedMatrix.h"
+#include "SparseMatrix.h"
+#include "IterativeSolvers.h"
+#include "QRDecomposition.h"
+#include "CholeskyDecomposition.h"
+#include "SymmetricEigen.h"
+#include "SingularValueDecomposition.h"
+#include "ComplexVector.h"
+#include "ComplexMatrix.h"
+#include "Fft.h"
+#include "VectorBatch.h"
+#include "VectorMath.h"
+#include "Value.h"
 
 #include "../Core/Errors.h"
 
-bool NumericsTester()
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <tuple>
+
+namespace
 {
-    
+    bool Check(const std::string& What, bool Passed)
+    {
+        if (!Passed)
+            std::cerr << "Numerics check failed: " << What << '\n';
+
+        return Passed;
+    }
+
+    /// A Rows x Columns matrix of entries uniform over [-1, 1], the same for the same Seed.
+    Matrix Random(size_t Rows, size_t Columns, unsigned Seed)
+    {
+        std::mt19937 Gen(Seed);
+        std::uniform_real_distribution<double> Dist(-1.0, 1.0);
+        Matrix Result(Rows, Columns);
+        for (size_t i = 0; i < Rows; i++)
+            for (size_t j = 0; j < Columns; j++)
+                Result[i][j] = Dist(Gen);
+
+        return Result;
+    }
+    /// A random Rows x Columns matrix of rank Rank, as the product of two random factors.
+    Matrix RandomOfRank(size_t Rows, size_t Columns, size_t Rank, unsigned Seed)
+    {
+        return Random(Rows, Rank, Seed) * Random(Rank, Columns, Seed + 1);
+    }
+
+    /// ||Expected - Actual|| relative to ||Expected||, in the Frobenius norm.
+    double Residual(const Matrix& Expected, const Matrix& Actual)
+    {
+        Matrix Difference = Expected;
+        Difference -= Actual;
+        return Difference.FrobeniusNorm() / std::max(1.0, Expected.FrobeniusNorm());
+    }
+
+    //Backward stable factorizations reconstruct their input to a small multiple of the unit roundoff times its size.
+    constexpr double Tolerance = 1e-12;
+
+    bool TestLU()
+    {
+        bool Passed = true;
+
+        //Sizes below, at and across the block size, so that the unblocked and blocked panels are both used.
+        for (size_t n : { 1, 7, 64, 150 })
+        {
+            Matrix A = Random(n, n, static_cast<unsigned>(n));
+            LUDecomposition LU(A);
+            std::string Name = "LU " + std::to_string(n) + "x" + std::to_string(n);
+
+            Matrix PA(n, n);
+            const std::vector<size_t>& P = LU.RowPermutation();
+            for (size_t i = 0; i < n; i++)
+                for (size_t j = 0; j < n; j++)
+                    PA[i][j] = A[P[i]][j];
+
+            Passed &= Check(Name + ": ||PA - LU|| is small", Residual(PA, LU.L() * LU.U()) < Tolerance);
+            Passed &= Check(Name + ": is not singular", !LU.IsSingular());
+
+            Matrix Inverse = LU.Inverse();
+            Passed &= Check(Name + ": A^-1 A = I", Residual(Matrix::Identity(n), Inverse * A) < 1e-9);
+        }
+
+        //A rank deficient matrix still factors exactly, but is reported singular and refuses to solve.
+        Matrix A = RandomOfRank(90, 90, 60, 11);
+        LUDecomposition LU(A);
+        Matrix PA(90, 90);
+        for (size_t i = 0; i < 90; i++)
+            for (size_t j = 0; j < 90; j++)
+                PA[i][j] = A[LU.RowPermutation()[i]][j];
+
+        Passed &= Check("LU rank 60 of 90: ||PA - LU|| is small", Residual(PA, LU.L() * LU.U()) < Tolerance);
+        Passed &= Check("LU rank 60 of 90: is singular", LU.IsSingular());
+
+        bool Threw = false;
+        try
+        {
+            (void)LU.Solve(MathVector(90, 1.0));
+        }
+        catch (const OperationError&)
+        {
+            Threw = true;
+        }
+        Passed &= Check("LU rank 60 of 90: solving throws", Threw);
+
+        //LU only takes square matrices.
+        Threw = false;
+        try
+        {
+            LUDecomposition Rectangular(Random(4, 3, 5));
+        }
+        catch (const OperationError&)
+        {
+            Threw = true;
+        }
+        Passed &= Check("LU 4x3: throws", Threw);
+
+        return Passed;
+    }
+
+    /// Checks that R is in row echelon form with unit pivots in exactly the columns Pivots, and zero below its rank.
+    bool IsEchelon(const Matrix& R, const std::vector<size_t>& Pivots)
+    {
+        for (size_t i = 0; i < R.Rows(); i++)
+        {
+            size_t First = i < Pivots.size() ? Pivots[i] : R.Columns();
+            for (size_t j = 0; j < First; j++)
+                if (R[i][j] != 0)
+                    return false;
+            if (First != R.Columns() && R[i][First] != 1)
+                return false;
+        }
+
+        return true;
+    }
+
+    /// Reduces A to row echelon and reduced row echelon form, and checks both against its known rank, pivot columns and (if given) its reduced form.
+    bool CheckRowReduction(const std::string& Name, const Matrix& A, const std::vector<size_t>& Pivots, const Matrix* Reduced = nullptr)
+    {
+        bool Passed = true;
+
+        Matrix Echelon = A;
+        EliminationResult EchelonResult = Echelon.RowEchelonForm();
+        Passed &= Check(Name + ": echelon rank", EchelonResult.Rank == Pivots.size());
+        Passed &= Check(Name + ": echelon pivot columns", EchelonResult.PivotColumns == Pivots);
+        Passed &= Check(Name + ": is in row echelon form", IsEchelon(Echelon, Pivots));
+
+        Matrix R = A;
+        EliminationResult ReducedResult = R.ReducedRowEchelonForm();
+        Passed &= Check(Name + ": reduced rank", ReducedResult.Rank == Pivots.size() && A.Rank() == Pivots.size());
+        Passed &= Check(Name + ": reduced pivot columns", ReducedResult.PivotColumns == Pivots);
+
+        //Every pivot column of the reduced form is a column of the identity.
+        bool Unit = IsEchelon(R, Pivots);
+        for (size_t t = 0; t < Pivots.size(); t++)
+            for (size_t i = 0; i < R.Rows(); i++)
+                Unit &= std::fabs(R[i][Pivots[t]] - (i == t ? 1.0 : 0.0)) <= Tolerance;
+        Passed &= Check(Name + ": is in reduced row echelon form", Unit);
+
+        //The reduced form is unique, so reducing the echelon form further must give it again.
+        Matrix Again = Echelon;
+        Again.ReducedRowEchelonForm();
+        Passed &= Check(Name + ": reducing the echelon form gives the reduced form", Residual(R, Again) < 1e-10);
+
+        //The pivot columns of A are a basis of its columns, with the rows of the reduced form as the coefficients: A = A(:, Pivots) R(0:Rank, :).
+        size_t Rank = Pivots.size();
+        if (Rank != 0)
+        {
+            Matrix Basis(A.Rows(), Rank);
+            for (size_t i = 0; i < A.Rows(); i++)
+                for (size_t t = 0; t < Rank; t++)
+                    Basis[i][t] = A[i][Pivots[t]];
+
+            Passed &= Check(Name + ": A = A(:, pivots) R", Residual(A, Basis * R.Extract(0, 0, Rank, A.Columns())) < 1e-10);
+        }
+
+        if (Reduced)
+            Passed &= Check(Name + ": matches the known reduced form", Residual(*Reduced, R) < Tolerance);
+
+        return Passed;
+    }
+
+    bool TestRowReduction()
+    {
+        bool Passed = true;
+
+        //A zero leading column, a free column, and a dependent row.
+        Matrix Wide = Matrix::FromList(3, 5,
+                                       0, 1, 2, 0, 3,
+                                       0, 2, 4, 1, 7,
+                                       0, 3, 6, 2, 11);
+        Matrix WideReduced = Matrix::FromList(3, 5,
+                                              0, 1, 2, 0, 3,
+                                              0, 0, 0, 1, 1,
+                                              0, 0, 0, 0, 0);
+        Passed &= CheckRowReduction("RREF 3x5 with a zero column", Wide, { 1, 3 }, &WideReduced);
+
+        //The second column is twice the first.
+        Matrix Tall = Matrix::FromList(4, 3,
+                                       1, 2, 3,
+                                       2, 4, 7,
+                                       3, 6, 10,
+                                       1, 2, 4);
+        Matrix TallReduced = Matrix::FromList(4, 3,
+                                              1, 2, 0,
+                                              0, 0, 1,
+                                              0, 0, 0,
+                                              0, 0, 0);
+        Passed &= CheckRowReduction("RREF 4x3 of rank 2", Tall, { 0, 2 }, &TallReduced);
+
+        Matrix Square = Matrix::FromList(3, 3,
+                                         2, 1, -1,
+                                         -3, -1, 2,
+                                         -2, 1, 2);
+        Matrix Identity = Matrix::Identity(3);
+        Passed &= CheckRowReduction("RREF 3x3 invertible", Square, { 0, 1, 2 }, &Identity);
+
+        Matrix Zero(4, 6);
+        Passed &= CheckRowReduction("RREF 4x6 zero", Zero, { }, &Zero);
+
+        //Sizes across the block size, so that the GEMM updates of both passes are used.
+        Matrix Full = Random(150, 150, 29);
+        Matrix FullIdentity = Matrix::Identity(150);
+        std::vector<size_t> All(150);
+        for (size_t i = 0; i < All.size(); i++)
+            All[i] = i;
+        Passed &= CheckRowReduction("RREF 150x150 invertible", Full, All, &FullIdentity);
+
+        //Generic factors make the first Rank columns independent, so they are the pivot columns.
+        const size_t Shapes[][3] = { { 200, 150, 90 }, { 90, 200, 60 }, { 130, 90, 40 } };
+        for (const auto& Shape : Shapes)
+        {
+            std::vector<size_t> First(Shape[2]);
+            for (size_t i = 0; i < First.size(); i++)
+                First[i] = i;
+
+            std::string Name = "RREF " + std::to_string(Shape[0]) + "x" + std::to_string(Shape[1]) + " of rank " + std::to_string(Shape[2]);
+            Passed &= CheckRowReduction(Name, RandomOfRank(Shape[0], Shape[1], Shape[2], 31), First);
+        }
+
+        //The rounding left by elimination grows with U, so the automatic tolerance must too. Elimination and SVD agree on every seed.
+        size_t RankFailures = 0;
+        for (unsigned Seed = 0; Seed < 60; Seed++)
+        {
+            Matrix A = RandomOfRank(130, 130, 70, 2 * Seed + 1);
+            RankFailures += A.Rank() != 70 || SingularValueDecomposition(A).Rank() != 70;
+        }
+        Passed &= Check("RREF 130x130 of rank 70: elimination and SVD find the rank over 60 seeds", RankFailures == 0);
+
+        //An explicit tolerance treats a small enough pivot as zero.
+        Matrix Nearly = Matrix::FromList(2, 2,
+                                         1, 1,
+                                         1, 1 + 1e-9);
+        Passed &= Check("RREF tolerance: a pivot of 1e-9 counts at 1e-12", Nearly.Rank(1e-12) == 2);
+        Passed &= Check("RREF tolerance: a pivot of 1e-9 is dropped at 1e-6", Nearly.Rank(1e-6) == 1);
+
+        return Passed;
+    }
+
+    /// True if Actual is exactly the transpose of Expected, element by element.
+    bool IsTransposeOf(const Matrix& Expected, const Matrix& Actual)
+    {
+        if (Actual.Rows() != Expected.Columns() || Actual.Columns() != Expected.Rows())
+            return false;
+
+        for (size_t i = 0; i < Expected.Rows(); i++)
+            for (size_t j = 0; j < Expected.Columns(); j++)
+                if (Actual[j][i] != Expected[i][j])
+                    return false;
+
+        return true;
+    }
+
+    bool TestTranspose()
+    {
+        bool Passed = true;
+
+        //Square, single row and column, and odd rectangular shapes, with and without padded strides, below and above the kernels' tile sizes.
+        const std::pair<size_t, size_t> Shapes[] = {
+            { 1, 1 }, { 9, 9 }, { 64, 64 }, { 130, 130 }, { 1, 53 }, { 53, 1 }, { 37, 53 }, { 53, 37 }, { 3, 200 }, { 200, 3 }, { 129, 65 }
+        };
+        for (auto [Rows, Columns] : Shapes)
+        {
+            std::string Name = "Transpose " + std::to_string(Rows) + "x" + std::to_string(Columns);
+            Matrix A = Random(Rows, Columns, static_cast<unsigned>(Rows * 1000 + Columns));
+
+            Matrix Copy = A.Transpose();
+            Passed &= Check(Name + ": Transpose matches the element-wise reference", IsTransposeOf(A, Copy));
+
+            Matrix InPlace = A;
+            InPlace.TransposeInplace();
+            Passed &= Check(Name + ": TransposeInplace matches the element-wise reference", IsTransposeOf(A, InPlace));
+            Passed &= Check(Name + ": TransposeInplace pads its new rows", InPlace.LeadingDimension() == Copy.LeadingDimension() && InPlace == Copy);
+
+            InPlace.TransposeInplace();
+            Passed &= Check(Name + ": transposing twice in place gives the original", InPlace == A);
+        }
+
+        //A block in the middle of a larger matrix, so that neither its start nor its stride matches its shape.
+        Matrix Outer = Random(60, 70, 107);
+        ConstMatrixView Block = Outer.Block(5, 9, 37, 53);
+        Matrix Expected(Block);
+        Matrix FromView(53, 37);
+        ViewTranspose(FromView.View(), Block);
+        Passed &= Check("Transpose of a view: ViewTranspose matches the element-wise reference", IsTransposeOf(Expected, FromView));
+        Passed &= Check("Transpose of a view: the transposed view matches the element-wise reference", IsTransposeOf(Expected, Matrix(Block.Transposed())));
+        Passed &= Check("Transpose of a view: Transpose of the copied block matches", Matrix(Block).Transpose() == FromView);
+
+        //Writing into a view transposes into the block only, leaving the rest of the matrix.
+        Matrix Target = Matrix::Identity(60, 70), Before = Target;
+        ViewTranspose(Target.Block(3, 4, 53, 37), Block);
+        bool Outside = true;
+        for (size_t i = 0; i < 60; i++)
+            for (size_t j = 0; j < 70; j++)
+                if (i < 3 || i >= 56 || j < 4 || j >= 41)
+                    Outside &= Target[i][j] == Before[i][j];
+        Passed &= Check("Transpose into a view: matches the element-wise reference", IsTransposeOf(Expected, Target.Extract(3, 4, 53, 37)));
+        Passed &= Check("Transpose into a view: leaves the rest of the matrix", Outside);
+
+        return Passed;
+    }
+
+    /// Checks the closed form inverse and determinant of N x N fixed matrices against the identity and against LU.
+    template<size_t N>
+    bool TestFixedInverse()
+    {
+        bool Passed = true;
+        std::string Name = "FixedMatrix " + std::to_string(N) + "x" + std::to_string(N);
+
+        size_t Failures = 0;
+        for (unsigned Trial = 0; Trial < 200; Trial++)
+        {
+            Matrix Source = Random(N, N, 1000 * N + Trial);
+            FixedMatrix<N, N> A;
+            for (size_t i = 0; i < N; i++)
+                for (size_t j = 0; j < N; j++)
+                    A(i, j) = Source[i][j];
+
+            FixedMatrix<N, N> Inverse = A.Inverse();
+            FixedMatrix<N, N> Left = Inverse * A, Right = A * Inverse;
+
+            //The error of an inverse grows with the condition number, ||A|| ||A^-1||.
+            double NormA = 0, NormInverse = 0, Error = 0;
+            for (size_t i = 0; i < N; i++)
+                for (size_t j = 0; j < N; j++)
+                {
+                    NormA += A(i, j) * A(i, j);
+                    NormInverse += Inverse(i, j) * Inverse(i, j);
+                    double Expected = i == j ? 1.0 : 0.0;
+                    Error = std::max({ Error, std::fabs(Left(i, j) - Expected), std::fabs(Right(i, j) - Expected) });
+                }
+
+            double Bound = 1e-13 * std::sqrt(NormA * NormInverse);
+            double Determinant = LUDecomposition(Source).Determinant();
+            if (Error > Bound || std::fabs(A.Determinant() - Determinant) > 1e-13 * std::max(1.0, std::fabs(Determinant)))
+                Failures++;
+        }
+        Passed &= Check(Name + ": A^-1 A = A A^-1 = I, and the determinant matches LU", Failures == 0);
+
+        //A matrix with a repeated row has a determinant of exactly zero, and cannot be inverted.
+        if constexpr (N > 1)
+        {
+            FixedMatrix<N, N> Singular;
+            for (size_t i = 0; i < N; i++)
+                for (size_t j = 0; j < N; j++)
+                    Singular(i, j) = static_cast<double>(std::min(i, N - 2) * N + j + 1);
+
+            bool Threw = false;
+            try
+            {
+                (void)Singular.Inverse();
+            }
+            catch (const OperationError&)
+            {
+                Threw = true;
+            }
+            Passed &= Check(Name + ": inverting a singular matrix throws", Singular.Determinant() == 0 && Threw);
+        }
+
+        return Passed;
+    }
+
+    /// The largest magnitude of the entries of A below its diagonal, which is zero for an upper triangular matrix.
+    double BelowDiagonal(const Matrix& A)
+    {
+        double Result = 0;
+        for (size_t i = 0; i < A.Rows(); i++)
+            for (size_t j = 0; j < std::min(i, A.Columns()); j++)
+                Result = std::max(Result, std::fabs(A[i][j]));
+
+        return Result;
+    }
+
+    template<typename T>
+    bool Throws(T&& Action)
+    {
+        try
+        {
+            Action();
+        }
+        catch (const OperationError&)
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+    bool TestQR()
+    {
+        bool Passed = true;
+
+        //Tall, square and wide, each across the block size, and one rank deficient.
+        struct Shape
+        {
+            size_t Rows, Columns, Rank;
+        };
+        const Shape Shapes[] = { { 5, 3, 3 }, { 150, 70, 70 }, { 100, 100, 100 }, { 60, 130, 60 }, { 120, 50, 30 } };
+        for (const Shape& S : Shapes)
+        {
+            Matrix A = S.Rank == std::min(S.Rows, S.Columns) ? Random(S.Rows, S.Columns, 31 + S.Rows) : RandomOfRank(S.Rows, S.Columns, S.Rank, 31 + S.Rows);
+            QRDecomposition QR(A);
+            std::string Name = "QR " + std::to_string(S.Rows) + "x" + std::to_string(S.Columns) + " of rank " + std::to_string(S.Rank);
+
+            Matrix Q = QR.Q(), R = QR.R();
+            size_t k = std::min(S.Rows, S.Columns);
+            Passed &= Check(Name + ": thin factors have the right shape", Q.Rows() == S.Rows && Q.Columns() == k && R.Rows() == k && R.Columns() == S.Columns);
+            Passed &= Check(Name + ": ||A - QR|| is small", Residual(A, Q * R) < Tolerance);
+            Passed &= Check(Name + ": Q^T Q = I", Residual(Matrix::Identity(k), Q.Transpose() * Q) < Tolerance);
+            Passed &= Check(Name + ": R is upper triangular", BelowDiagonal(R) == 0);
+
+            Matrix B = Random(S.Rows, 3, 41), Round = B;
+            QR.ApplyQ(Round);
+            QR.ApplyQTranspose(Round);
+            Passed &= Check(Name + ": Q^T Q B = B", Residual(B, Round) < Tolerance);
+
+            bool FullRank = S.Rank == S.Columns;
+            Passed &= Check(Name + ": full rank is detected", QR.IsFullRank() == FullRank);
+            if (!FullRank)
+            {
+                Passed &= Check(Name + ": least squares throws", Throws([&] { (void)QR.SolveLeastSquares(MathVector(S.Rows, 1.0)); }));
+                continue;
+            }
+
+            //The least squares residual is orthogonal to the columns of A.
+            MathVector b(S.Rows);
+            for (size_t i = 0; i < S.Rows; i++)
+                b[i] = std::cos(static_cast<double>(i));
+
+            Matrix x(QR.SolveLeastSquares(b));
+            Matrix r = Matrix(b);
+            r -= A * x;
+            Passed &= Check(Name + ": A^T (b - Ax) = 0", (A.Transpose() * r).FrobeniusNorm() < Tolerance * A.FrobeniusNorm() * Matrix(b).FrobeniusNorm());
+        }
+
+        return Passed;
+    }
+
+    bool TestCholesky()
+    {
+        bool Passed = true;
+        for (size_t n : { 1, 50, 64, 150 })
+        {
+            //B^T B + n I is symmetric positive definite, and well conditioned.
+            Matrix B = Random(n, n, 51 + static_cast<unsigned>(n));
+            Matrix A = B.Transpose() * B;
+            A += Matrix::Identity(n) * static_cast<double>(n);
+
+            CholeskyDecomposition Cholesky(A);
+            const Matrix& L = Cholesky.L();
+            std::string Name = "Cholesky " + std::to_string(n) + "x" + std::to_string(n);
+            Passed &= Check(Name + ": ||A - LL^T|| is small", Residual(A, L * L.Transpose()) < Tolerance);
+            Passed &= Check(Name + ": L is lower triangular", BelowDiagonal(L.Transpose()) == 0);
+            Passed &= Check(Name + ": A^-1 A = I", Residual(Matrix::Identity(n), Cholesky.Inverse() * A) < 1e-10);
+
+            //The determinant itself overflows at the larger sizes, so the logarithms are compared, taking that of LU from its pivots.
+            LUDecomposition LU(A);
+            double LogDeterminant = 0;
+            for (size_t i = 0; i < n; i++)
+                LogDeterminant += std::log(std::fabs(LU.PackedFactors()[i][i]));
+            Passed &= Check(Name + ": the log determinant matches LU", std::fabs(Cholesky.LogDeterminant() - LogDeterminant) < 1e-12 * std::max(1.0, LogDeterminant));
+        }
+
+        //A rank one matrix of ones is only semidefinite, and a matrix with a negative eigenvalue is indefinite.
+        Matrix Ones(80, 80);
+        for (size_t i = 0; i < 80; i++)
+            for (size_t j = 0; j < 80; j++)
+                Ones[i][j] = 1.0;
+        Passed &= Check("Cholesky of a rank one matrix throws", Throws([&] { CholeskyDecomposition Cholesky(Ones); }));
+
+        Matrix Indefinite = Matrix::Identity(70);
+        Indefinite[65][65] = -1.0;
+        Passed &= Check("Cholesky of an indefinite matrix throws", Throws([&] { CholeskyDecomposition Cholesky(Indefinite); }));
+        Passed &= Check("Cholesky of a rectangular matrix throws", Throws([&] { CholeskyDecomposition Cholesky(Random(4, 3, 5)); }));
+
+        return Passed;
+    }
+
+    /// Scales column j of A by Values[j], giving A * diag(Values).
+    Matrix ScaleColumns(Matrix A, const std::vector<double>& Values)
+    {
+        for (size_t i = 0; i < A.Rows(); i++)
+            for (size_t j = 0; j < A.Columns(); j++)
+                A[i][j] *= Values[j];
+
+        return A;
+    }
+
+    /// (A + A^T) / 2, which is symmetric to the last bit, unlike products such as B B^T.
+    Matrix Symmetrize(const Matrix& A)
+    {
+        Matrix Result = A;
+        Result += A.Transpose();
+        Result *= 0.5;
+        return Result;
+    }
+
+    /// ||AV - V diag(Values)|| relative to ||A||. The columns of V need only be eigenvectors, not a full basis.
+    double EigenResidual(const Matrix& A, const Matrix& V, const std::vector<double>& Values)
+    {
+        Matrix Difference = A * V;
+        Difference -= ScaleColumns(V, Values);
+        return Difference.FrobeniusNorm() / std::max(1.0, A.FrobeniusNorm());
+    }
+
+    bool TestSymmetricEigen()
+    {
+        bool Passed = true;
+
+        //A random symmetric matrix, a rank deficient one, and one with an eigenvalue of multiplicity ten (Q diag Q^T for a random orthogonal Q).
+        std::vector<std::pair<std::string, Matrix>> Cases;
+        for (size_t n : { 1, 10, 32, 100 })
+        {
+            Matrix B = Random(n, n, 61 + static_cast<unsigned>(n)), A = B;
+            A += B.Transpose();
+            Cases.emplace_back("Eigen " + std::to_string(n) + "x" + std::to_string(n), A);
+        }
+
+        Matrix Tall = Random(70, 25, 67), LowRank = Symmetrize(Tall * Tall.Transpose());
+        Cases.emplace_back("Eigen 70x70 of rank 25", LowRank);
+
+        std::vector<double> Repeated(60);
+        for (size_t i = 0; i < 60; i++)
+            Repeated[i] = i < 10 ? 2.0 : 3.0 + static_cast<double>(i);
+        Matrix Q = QRDecomposition(Random(60, 60, 71)).Q();
+        Cases.emplace_back("Eigen 60x60 with a tenfold eigenvalue", Symmetrize(ScaleColumns(Q, Repeated) * Q.Transpose()));
+
+        for (const auto& [Name, A] : Cases)
+        {
+            size_t n = A.Rows();
+            SymmetricEigen Eigen(A);
+            const std::vector<double>& Values = Eigen.Eigenvalues();
+            const Matrix& V = Eigen.Eigenvectors();
+
+            Passed &= Check(Name + ": ||AV - V diag(values)|| is small", EigenResidual(A, V, Values) < Tolerance);
+            Passed &= Check(Name + ": V^T V = I", Residual(Matrix::Identity(n), V.Transpose() * V) < Tolerance);
+            Passed &= Check(Name + ": eigenvalues ascend", std::is_sorted(Values.begin(), Values.end()));
+
+            double Trace = 0, Sum = 0;
+            for (size_t i = 0; i < n; i++)
+            {
+                Trace += A[i][i];
+                Sum += Values[i];
+            }
+            Passed &= Check(Name + ": eigenvalues sum to the trace", std::fabs(Trace - Sum) < Tolerance * std::max(1.0, A.FrobeniusNorm()));
+
+            //Asking for only the largest few, or only the values, must agree with the full decomposition.
+            size_t Count = std::max<size_t>(1, n / 4);
+            SymmetricEigen Largest(A, { true, Count });
+            SymmetricEigen ValuesOnly(A, { false, 0 });
+            bool Agree = Largest.Size() == Count && ValuesOnly.Size() == n && !ValuesOnly.HasEigenvectors();
+            for (size_t i = 0; Agree && i < Count; i++)
+                Agree = std::fabs(Largest.Eigenvalues()[i] - Values[n - Count + i]) < Tolerance * std::max(1.0, A.FrobeniusNorm());
+            for (size_t i = 0; Agree && i < n; i++)
+                Agree = std::fabs(ValuesOnly.Eigenvalues()[i] - Values[i]) < Tolerance * std::max(1.0, A.FrobeniusNorm());
+            Passed &= Check(Name + ": partial decompositions agree", Agree);
+            Passed &= Check(Name + ": partial eigenvectors satisfy AV = V diag(values)", EigenResidual(A, Largest.Eigenvectors(), Largest.Eigenvalues()) < Tolerance);
+        }
+
+        //The rank deficient matrix has 45 eigenvalues of zero.
+        SymmetricEigen Deficient(LowRank);
+        size_t Zeros = 0;
+        for (double Value : Deficient.Eigenvalues())
+            Zeros += std::fabs(Value) < 1e-12 * Deficient.Eigenvalues().back() * 70;
+        Passed &= Check("Eigen 70x70 of rank 25: has 45 zero eigenvalues", Zeros == 45);
+
+        Passed &= Check("Eigen of a non symmetric matrix throws", Throws([] { SymmetricEigen Eigen(Random(5, 5, 73)); }));
+        Passed &= Check("Eigen of a rectangular matrix throws", Throws([] { SymmetricEigen Eigen(Random(5, 4, 73)); }));
+
+        return Passed;
+    }
+
+    bool TestSingularValueDecomposition()
+    {
+        bool Passed = true;
+
+        struct Shape
+        {
+            size_t Rows, Columns, Rank;
+        };
+        const Shape Shapes[] = { { 1, 1, 1 }, { 120, 40, 40 }, { 40, 90, 40 }, { 64, 64, 64 }, { 80, 60, 20 }, { 30, 75, 12 } };
+        for (const Shape& S : Shapes)
+        {
+            Matrix A = S.Rank == std::min(S.Rows, S.Columns) ? Random(S.Rows, S.Columns, 81 + S.Rows) : RandomOfRank(S.Rows, S.Columns, S.Rank, 81 + S.Rows);
+            SingularValueDecomposition Svd(A);
+            std::string Name = "SVD " + std::to_string(S.Rows) + "x" + std::to_string(S.Columns) + " of rank " + std::to_string(S.Rank);
+
+            size_t k = std::min(S.Rows, S.Columns);
+            const std::vector<double>& Values = Svd.SingularValues();
+            const Matrix& U = Svd.U(), &V = Svd.V();
+            Passed &= Check(Name + ": factors have the right shape", Values.size() == k && U.Rows() == S.Rows && U.Columns() == k && V.Rows() == S.Columns && V.Columns() == k);
+            Passed &= Check(Name + ": ||A - U diag(values) V^T|| is small", Residual(A, ScaleColumns(U, Values) * V.Transpose()) < Tolerance);
+            Passed &= Check(Name + ": U^T U = I", Residual(Matrix::Identity(k), U.Transpose() * U) < Tolerance);
+            Passed &= Check(Name + ": V^T V = I", Residual(Matrix::Identity(k), V.Transpose() * V) < Tolerance);
+            Passed &= Check(Name + ": singular values are non-negative and descend", std::is_sorted(Values.rbegin(), Values.rend()) && Values.back() >= 0);
+            Passed &= Check(Name + ": the rank is found", Svd.Rank() == S.Rank);
+
+            //The squares of the singular values are the largest eigenvalues of A^T A.
+            SymmetricEigen Gram(Symmetrize(A.Transpose() * A), { false, k });
+            bool Agree = true;
+            for (size_t i = 0; i < k; i++)
+                Agree &= std::fabs(Values[i] * Values[i] - Gram.Eigenvalues()[k - 1 - i]) < 1e-10 * Values[0] * Values[0];
+            Passed &= Check(Name + ": values are the roots of the eigenvalues of A^T A", Agree);
+        }
+
+        return Passed;
+    }
+
+    /// A^Power by Power - 1 plain products, as the reference for Matrix::Pow.
+    Matrix RepeatedProduct(const Matrix& A, unsigned Power)
+    {
+        Matrix Result = A;
+        for (unsigned k = 1; k < Power; k++)
+            Result = Result * A;
+
+        return Result;
+    }
+
+    bool TestPow()
+    {
+        bool Passed = true;
+
+        //Scaled so that the powers neither grow nor shrink too much for a relative comparison.
+        Matrix General = Random(40, 40, 109);
+        General /= std::sqrt(40.0);
+
+        Matrix Upper = General, Lower = General;
+        for (size_t i = 0; i < 40; i++)
+            for (size_t j = 0; j < 40; j++)
+            {
+                if (j < i)
+                    Upper[i][j] = 0;
+                else if (j > i)
+                    Lower[i][j] = 0;
+            }
+
+        Matrix Diagonal(40, 40);
+        for (size_t i = 0; i < 40; i++)
+            Diagonal[i][i] = General[i][i] * 2;
+
+        Matrix Symmetric = Symmetrize(General);
+
+        const std::pair<const char*, const Matrix*> Inputs[] = {
+            { "general", &General }, { "upper triangular", &Upper }, { "lower triangular", &Lower }, { "diagonal", &Diagonal }, { "symmetric", &Symmetric }
+        };
+        for (const auto& [Name, A] : Inputs)
+            for (unsigned Power = 2; Power <= 9; Power++)
+            {
+                std::string Label = std::string("Pow ") + Name + " ^ " + std::to_string(Power);
+                Matrix Expected = RepeatedProduct(*A, Power);
+                Matrix Squared = A->Pow(Power), Spectral = A->Pow(Power, MPM_Spectral);
+                Passed &= Check(Label + ": squaring matches repeated products", Residual(Expected, Squared) < Tolerance);
+                Passed &= Check(Label + ": spectral matches repeated products", Residual(Expected, Spectral) < 1e-10);
+            }
+
+        //The triangular product must leave the zero half exactly zero, and the diagonal path must be exact.
+        Matrix UpperPower = Upper.Pow(7), LowerPower = Lower.Pow(7), DiagonalPower = Diagonal.Pow(5);
+        Passed &= Check("Pow upper triangular: stays upper triangular", UpperPower.IsUpperTriangular());
+        Passed &= Check("Pow lower triangular: stays lower triangular", LowerPower.IsLowerTriangular());
+        bool Exact = DiagonalPower.IsDiagonal();
+        for (size_t i = 0; i < 40; i++)
+            Exact &= DiagonalPower[i][i] == std::pow(Diagonal[i][i], 5.0);
+        Passed &= Check("Pow diagonal: raises each diagonal entry", Exact);
+
+        //Only symmetric matrices have a spectral path; anything else falls back to squaring, with the same result to the bit.
+        Passed &= Check("Pow non-symmetric with MPM_Spectral: falls back to squaring", General.Pow(6, MPM_Spectral) == General.Pow(6));
+        Passed &= Check("Pow triangular with MPM_Spectral: falls back to squaring", Upper.Pow(6, MPM_Spectral) == Upper.Pow(6));
+
+        //A large power, where squaring takes a handful of products instead of hundreds.
+        Matrix Contraction = General / (2.0 * General.FrobeniusNorm());
+        Passed &= Check("Pow general ^ 300: matches repeated products", Residual(RepeatedProduct(Contraction, 300), Contraction.Pow(300)) < Tolerance);
+
+        Matrix Rectangular = Random(3, 5, 113);
+        Passed &= Check("Pow ^ 0: is the identity", General.Pow(0) == Matrix::Identity(40) && Diagonal.Pow(0, MPM_Spectral) == Matrix::Identity(40));
+        Passed &= Check("Pow ^ 1: is the matrix itself", General.Pow(1) == General && Rectangular.Pow(1) == Rectangular && Symmetric.Pow(1, MPM_Spectral) == Symmetric);
+        bool Threw = false;
+        try
+        {
+            (void)Rectangular.Pow(2);
+        }
+        catch (const OperatorError&)
+        {
+            Threw = true;
+        }
+        Passed &= Check("Pow of a non-square matrix above 1 throws", Threw);
+
+        return Passed;
+    }
+
+    /// ||Expected - Actual|| relative to ||Expected||, over the real and imaginary parts of the first Count entries.
+    double Residual(const ComplexVector& Expected, const ComplexVector& Actual, size_t Count)
+    {
+        double Difference = 0, Norm = 0;
+        for (size_t i = 0; i < Count; i++)
+        {
+            double dr = Expected.Real()[i] - Actual.Real()[i], di = Expected.Imag()[i] - Actual.Imag()[i];
+            Difference += dr * dr + di * di;
+            Norm += Expected.Real()[i] * Expected.Real()[i] + Expected.Imag()[i] * Expected.Imag()[i];
+        }
+
+        return std::sqrt(Difference / std::max(1.0, Norm));
+    }
+
+    /// The transform by its definition, in O(n^2). The sums are kept in long double, and j k is reduced mod n before the twiddle is taken, so this is accurate enough to judge the FFT by.
+    ComplexVector NaiveDft(const ComplexVector& Signal)
+    {
+        size_t n = Signal.Size();
+        ComplexVector Result(n);
+        const long double Pi = 3.141592653589793238462643383279502884L;
+        for (size_t k = 0; k < n; k++)
+        {
+            long double Re = 0, Im = 0;
+            for (size_t j = 0; j < n; j++)
+            {
+                long double Angle = -2 * Pi * static_cast<long double>((j * k) % n) / static_cast<long double>(n);
+                long double c = std::cos(Angle), s = std::sin(Angle);
+                Re += Signal.Real()[j] * c - Signal.Imag()[j] * s;
+                Im += Signal.Real()[j] * s + Signal.Imag()[j] * c;
+            }
+            Result.Real()[k] = static_cast<double>(Re);
+            Result.Imag()[k] = static_cast<double>(Im);
+        }
+
+        return Result;
+    }
+
+    bool TestFft()
+    {
+        bool Passed = true;
+
+        //Powers of two, mixed radix 2, 3 and 5, and lengths with larger prime factors, which go through Bluestein's algorithm.
+        for (size_t n : { 1, 2, 8, 12, 60, 97, 121, 256, 1000, 1009 })
+        {
+            Matrix Parts = Random(2, n, 91 + static_cast<unsigned>(n));
+            ComplexVector Signal = ComplexVector::FromParts(Parts.RowData(0), Parts.RowData(1), n);
+            std::string Name = "FFT " + std::to_string(n);
+
+            ComplexVector Spectrum = Fft(Signal);
+            Passed &= Check(Name + ": matches the naive DFT", Residual(NaiveDft(Signal), Spectrum, n) < Tolerance);
+            Passed &= Check(Name + ": round trips", Residual(Signal, InverseFft(Spectrum), n) < Tolerance);
+            Passed &= Check(Name + ": uses Bluestein only for primes above 5", FftPlan::Get(n)->IsBluestein() == (FftPlan::FastSize(n) != n));
+
+            //The real transform gives the first half of the complex one, and recovers its input.
+            MathVector Real(n);
+            std::copy_n(Parts.RowData(0), n, Real.data());
+            ComplexVector RealSpectrum = RealFft(Real), Full = Fft(ComplexVector::FromParts(Parts.RowData(0), nullptr, n));
+            Passed &= Check(Name + ": real transform matches the complex one", RealSpectrum.Size() == n / 2 + 1 && Residual(Full, RealSpectrum, n / 2 + 1) < Tolerance);
+
+            MathVector Recovered = InverseRealFft(RealSpectrum, n);
+            double Error = 0;
+            for (size_t i = 0; i < n; i++)
+                Error = std::max(Error, std::fabs(Recovered[i] - Real[i]));
+            Passed &= Check(Name + ": real transform round trips", Recovered.Dim() == n && Error < Tolerance);
+        }
+
+        //Convolution by FFT matches the direct sum, for lengths whose padded transform is not a power of two.
+        MathVector One(37), Two(23);
+        for (size_t i = 0; i < 37; i++)
+            One[i] = std::sin(static_cast<double>(i));
+        for (size_t i = 0; i < 23; i++)
+            Two[i] = std::cos(static_cast<double>(i) * 0.5);
+
+        MathVector Convolution = Convolve(One, Two);
+        double Error = 0;
+        for (size_t k = 0; k < 59; k++)
+        {
+            double Direct = 0;
+            for (size_t i = 0; i < 37; i++)
+                if (k >= i && k - i < 23)
+                    Direct += One[i] * Two[k - i];
+            Error = std::max(Error, std::fabs(Direct - Convolution[k]));
+        }
+        Passed &= Check("Convolution matches the direct sum", Convolution.Dim() == 59 && Error < Tolerance);
+
+        //The two dimensional transform round trips, with a prime dimension.
+        ComplexMatrix Image(Random(13, 24, 97), Random(13, 24, 98));
+        ComplexMatrix Back = InverseFft2(Fft2(Image));
+        Passed &= Check("FFT 13x24: round trips", Residual(Image.Real(), Back.Real()) < Tolerance && Residual(Image.Imag(), Back.Imag()) < Tolerance);
+
+        Passed &= Check("FFT of an empty signal throws", Throws([] { (void)Fft(ComplexVector()); }));
+
+        return Passed;
+    }
+
+    /// A random Rows x Columns matrix where each entry is nonzero with probability Density. Every fifth row is left empty.
+    Matrix RandomSparse(size_t Rows, size_t Columns, double Density, unsigned Seed)
+    {
+        std::mt19937 Gen(Seed);
+        std::uniform_real_distribution<double> Dist(-1.0, 1.0), Keep(0.0, 1.0);
+        Matrix Result(Rows, Columns);
+        for (size_t i = 0; i < Rows; i++)
+            for (size_t j = 0; j < Columns; j++)
+                Result[i][j] = i % 5 != 4 && Keep(Gen) < Density ? Dist(Gen) : 0.0;
+
+        return Result;
+    }
+
+    bool TestSparseProducts()
+    {
+        bool Passed = true;
+        const SparseFormat Formats[] = { SF_CSR, SF_CSC };
+        const char* FormatNames[] = { "CSR", "CSC" };
+
+        Matrix DenseA = RandomSparse(230, 170, 0.05, 21), DenseB = RandomSparse(170, 190, 0.05, 22), DenseC = RandomSparse(230, 170, 0.05, 23);
+        Matrix Block = Random(170, 7, 24);
+        MathVector x(170);
+        for (size_t j = 0; j < 170; j++)
+            x[j] = std::sin(static_cast<double>(j));
+
+        Matrix Product = DenseA * DenseB, BlockProduct = DenseA * Block;
+        Matrix VectorProduct = DenseA * Matrix(x);
+        for (size_t f = 0; f < 2; f++)
+        {
+            SparseMatrix A(DenseA, Formats[f]), C(DenseC, Formats[f]);
+            std::string Name = std::string("Sparse ") + FormatNames[f];
+
+            Passed &= Check(Name + ": round trips through dense", Residual(DenseA, A.ToDense()) == 0);
+            Passed &= Check(Name + ": transpose matches dense", Residual(DenseA.Transpose(), A.Transpose().ToDense()) == 0);
+            Passed &= Check(Name + ": SpMV matches dense", Residual(VectorProduct, Matrix(A * x)) < Tolerance);
+            Passed &= Check(Name + ": sparse times dense matches dense", Residual(BlockProduct, A * Block) < Tolerance);
+
+            Matrix Sum = DenseA, Difference = DenseA;
+            Sum += DenseC;
+            Difference -= DenseC;
+            Passed &= Check(Name + ": sum matches dense", Residual(Sum, (A + C).ToDense()) < Tolerance);
+            Passed &= Check(Name + ": difference matches dense", Residual(Difference, (A - C).ToDense()) < Tolerance);
+            Passed &= Check(Name + ": A - A stores nothing", (A - A).NonZeros() == 0);
+
+            for (size_t g = 0; g < 2; g++)
+            {
+                SparseMatrix B(DenseB, Formats[g]);
+                SparseMatrix SparseProduct = A * B;
+                std::string ProductName = Name + " x " + FormatNames[g];
+                Passed &= Check(ProductName + ": SpGEMM matches dense", Residual(Product, SparseProduct.ToDense()) < Tolerance);
+                Passed &= Check(ProductName + ": SpGEMM has the right shape", SparseProduct.Rows() == 230 && SparseProduct.Columns() == 190);
+            }
+        }
+
+        //Multiplying by the identity, or by a matrix with no entries, is exact.
+        SparseMatrix A(DenseA);
+        Passed &= Check("Sparse: A I = A", Residual(DenseA, (A * SparseMatrix::Identity(170)).ToDense()) == 0);
+        SparseMatrix Empty(170, 190);
+        SparseMatrix ZeroProduct = A * Empty;
+        Passed &= Check("Sparse: A 0 = 0", ZeroProduct.NonZeros() == 0 && ZeroProduct.Rows() == 230 && ZeroProduct.Columns() == 190);
+
+        return Passed;
+    }
+
+    /// The five point finite difference operator -u_xx - u_yy + Drift * u_x on a Grid x Grid mesh. It is symmetric positive definite when Drift is zero.
+    SparseMatrix ConvectionDiffusion(size_t Grid, double Drift)
+    {
+        std::vector<SparseEntry> Entries;
+        for (size_t i = 0; i < Grid; i++)
+            for (size_t j = 0; j < Grid; j++)
+            {
+                size_t k = i * Grid + j;
+                Entries.push_back({ k, k, 4.0 });
+                if (i > 0)
+                    Entries.push_back({ k, k - Grid, -1.0 });
+                if (i + 1 < Grid)
+                    Entries.push_back({ k, k + Grid, -1.0 });
+                if (j > 0)
+                    Entries.push_back({ k, k - 1, -1.0 - Drift });
+                if (j + 1 < Grid)
+                    Entries.push_back({ k, k + 1, -1.0 + Drift });
+            }
+
+        return SparseMatrix::FromTriplets(Grid * Grid, Grid * Grid, std::move(Entries));
+    }
+
+    /// Checks that a solve converged, and that its solution has a small true residual and is close to Expected.
+    bool CheckSolve(const std::string& Name, const IterativeSolverResult& Result, const SparseMatrix& A, const MathVector& b, const MathVector& Expected)
+    {
+        MathVector Residual = A * Result.Solution;
+        double ResidualNorm = 0, bNorm = 0, Error = 0, ExpectedNorm = 0;
+        for (size_t i = 0; i < b.Dim(); i++)
+        {
+            ResidualNorm += (b[i] - Residual[i]) * (b[i] - Residual[i]);
+            bNorm += b[i] * b[i];
+            Error += (Result.Solution[i] - Expected[i]) * (Result.Solution[i] - Expected[i]);
+            ExpectedNorm += Expected[i] * Expected[i];
+        }
+
+        bool Passed = true;
+        Passed &= Check(Name + ": converges", Result.Converged && Result.Iterations > 0);
+        Passed &= Check(Name + ": ||b - Ax|| <= tolerance * ||b||", std::sqrt(ResidualNorm / bNorm) <= 1e-9);
+        Passed &= Check(Name + ": reports its residual", Result.RelativeResidual() <= 1e-10 && Result.ResidualHistory.size() == Result.Iterations + 1);
+        Passed &= Check(Name + ": finds the solution", std::sqrt(Error / ExpectedNorm) <= 1e-7);
+        return Passed;
+    }
+
+    bool TestIterativeSolvers()
+    {
+        bool Passed = true;
+        const std::pair<PreconditionerKind, const char*> Kinds[] = { { PK_None, "none" }, { PK_Jacobi, "Jacobi" }, { PK_ILU0, "ILU(0)" } };
+
+        //Right hand sides made from a known solution, so that the error can be checked as well as the residual.
+        SparseMatrix Symmetric = ConvectionDiffusion(20, 0.0), General = ConvectionDiffusion(20, 0.6);
+        Matrix DenseSymmetric = Symmetric.ToDense(), DenseGeneral = General.ToDense();
+        MathVector Expected(400);
+        for (size_t i = 0; i < 400; i++)
+            Expected[i] = std::cos(0.1 * static_cast<double>(i)) + 1.0;
+        MathVector SymmetricB = Symmetric * Expected, GeneralB = General * Expected;
+
+        size_t PlainCG = 0, PlainGMRES = 0;
+        for (const auto& [Kind, Name] : Kinds)
+        {
+            IterativeSolverOptions Options;
+            Options.Preconditioning = Kind;
+
+            IterativeSolverResult CG = ConjugateGradient(Symmetric, SymmetricB, Options);
+            Passed &= CheckSolve(std::string("CG, sparse, ") + Name, CG, Symmetric, SymmetricB, Expected);
+            Passed &= CheckSolve(std::string("CG, dense, ") + Name, ConjugateGradient(DenseSymmetric, SymmetricB, Options), Symmetric, SymmetricB, Expected);
+
+            IterativeSolverResult Gmres = GMRES(General, GeneralB, Options);
+            Passed &= CheckSolve(std::string("GMRES, sparse, ") + Name, Gmres, General, GeneralB, Expected);
+            Passed &= CheckSolve(std::string("GMRES, dense, ") + Name, GMRES(DenseGeneral, GeneralB, Options), General, GeneralB, Expected);
+
+            //ILU(0) is a much closer approximation of these matrices than the identity, so it should save iterations.
+            if (Kind == PK_None)
+            {
+                PlainCG = CG.Iterations;
+                PlainGMRES = Gmres.Iterations;
+            }
+            else if (Kind == PK_ILU0)
+            {
+                Passed &= Check("CG, ILU(0): takes fewer iterations than none", CG.Iterations < PlainCG);
+                Passed &= Check("GMRES, ILU(0): takes fewer iterations than none", Gmres.Iterations < PlainGMRES);
+            }
+        }
+
+        //The matrix free overloads take the preconditioner directly.
+        LinearOperator Apply = [&](const MathVector& In, MathVector& Out) { Out = General * In; };
+        ILU0Preconditioner Ilu(General);
+        Passed &= CheckSolve("GMRES, matrix free, ILU(0)", GMRES(Apply, GeneralB, {}, &Ilu), General, GeneralB, Expected);
+        JacobiPreconditioner Jacobi(Symmetric);
+        LinearOperator ApplySymmetric = [&](const MathVector& In, MathVector& Out) { Out = Symmetric * In; };
+        Passed &= CheckSolve("CG, matrix free, Jacobi", ConjugateGradient(ApplySymmetric, SymmetricB, {}, &Jacobi), Symmetric, SymmetricB, Expected);
+
+        //A zero right hand side has the zero solution, whatever the initial guess, and takes no iterations to find it.
+        MathVector Zero(400), Guess(400, 3.0);
+        for (const auto& [Kind, Name] : Kinds)
+        {
+            IterativeSolverOptions Options;
+            Options.Preconditioning = Kind;
+            IterativeSolverResult CG = ConjugateGradient(Symmetric, Zero, Options, &Guess);
+            IterativeSolverResult Gmres = GMRES(General, Zero, Options, &Guess);
+
+            bool CGZero = CG.Converged && CG.Iterations == 0 && CG.Solution.Dim() == 400, GmresZero = Gmres.Converged && Gmres.Iterations == 0 && Gmres.Solution.Dim() == 400;
+            for (size_t i = 0; i < 400; i++)
+            {
+                CGZero &= CG.Solution[i] == 0.0;
+                GmresZero &= Gmres.Solution[i] == 0.0;
+            }
+            Passed &= Check(std::string("CG, zero right hand side, ") + Name + ": gives zero", CGZero);
+            Passed &= Check(std::string("GMRES, zero right hand side, ") + Name + ": gives zero", GmresZero);
+        }
+
+        return Passed;
+    }
+
+    /// Count complex values whose parts have random signs, mantissas in [1, 10), and decimal exponents uniform over [Low, High].
+    std::vector<std::complex<double>> RandomComplex(size_t Count, int Low, int High, unsigned Seed)
+    {
+        std::mt19937 Gen(Seed);
+        std::uniform_real_distribution<double> Mantissa(1.0, 10.0);
+        std::uniform_int_distribution<int> Exponent(Low, High), Sign(0, 1);
+        auto Part = [&] { return (Sign(Gen) ? -1.0 : 1.0) * Mantissa(Gen) * std::pow(10.0, Exponent(Gen)); };
+
+        std::vector<std::complex<double>> Result(Count);
+        for (auto& Curr : Result)
+            Curr = { Part(), Part() };
+
+        return Result;
+    }
+    ComplexVector ToComplexVector(const std::vector<std::complex<double>>& Values)
+    {
+        ComplexVector Result(Values.size());
+        for (size_t i = 0; i < Values.size(); i++)
+        {
+            Result.Real()[i] = Values[i].real();
+            Result.Imag()[i] = Values[i].imag();
+        }
+
+        return Result;
+    }
+    /// True if every element of Actual is within Relative of the matching element of Expected, relative to its magnitude.
+    bool CloseTo(const std::vector<std::complex<double>>& Expected, const ComplexVector& Actual, double Relative)
+    {
+        if (Actual.Size() != Expected.size())
+            return false;
+
+        for (size_t i = 0; i < Expected.size(); i++)
+            if (!(std::abs(std::complex<double>(Actual.Real()[i], Actual.Imag()[i]) - Expected[i]) <= Relative * std::abs(Expected[i])))
+                return false;
+
+        return true;
+    }
+
+    bool TestComplexKernels()
+    {
+        bool Passed = true;
+
+        //Lengths that leave a remainder for every SIMD width, and operands near the ends of the exponent range, where squaring a part overflows or underflows.
+        struct Range
+        {
+            const char* Name;
+            int Low, High;
+        };
+        const Range Ranges[] = { { "ordinary", -3, 3 }, { "near 1e300", 295, 300 }, { "near 1e-300", -300, -295 } };
+        for (size_t Length : { 1, 3, 7, 13, 33, 1001 })
+            for (const Range& Curr : Ranges)
+            {
+                std::string Name = "Complex " + std::string(Curr.Name) + " of length " + std::to_string(Length);
+                auto X = RandomComplex(Length, Curr.Low, Curr.High, static_cast<unsigned>(Length * 7 + Curr.High));
+                auto Y = RandomComplex(Length, Curr.Low, Curr.High, static_cast<unsigned>(Length * 11 + Curr.High));
+                //Products of two large or two small values leave the range, so the factors are taken from both ends instead.
+                auto Factor = RandomComplex(Length, -Curr.High, -Curr.Low, static_cast<unsigned>(Length * 13 + Curr.High));
+                ComplexVector VX = ToComplexVector(X), VY = ToComplexVector(Y), VFactor = ToComplexVector(Factor);
+
+                std::vector<std::complex<double>> Product(Length), Quotient(Length), Conjugate(Length);
+                bool Abs = true;
+                std::vector<double> Magnitudes = VX.Abs();
+                for (size_t i = 0; i < Length; i++)
+                {
+                    Product[i] = X[i] * Factor[i];
+                    Quotient[i] = X[i] / Y[i];
+                    Conjugate[i] = std::conj(X[i]);
+                    Abs &= std::fabs(Magnitudes[i] - std::abs(X[i])) <= 4e-16 * std::abs(X[i]);
+                }
+
+                Passed &= Check(Name + ": multiply matches std::complex", CloseTo(Product, VX * VFactor, 1e-15));
+                Passed &= Check(Name + ": divide matches std::complex", CloseTo(Quotient, VX / VY, 1e-15));
+                Passed &= Check(Name + ": Abs matches std::abs", Abs);
+
+                ComplexVector Conjugated = VX;
+                Conjugated.Conjugate();
+                Passed &= Check(Name + ": Conjugate matches std::conj", CloseTo(Conjugate, Conjugated, 0.0));
+
+                //The dot product sums terms that may cancel, so it is compared relative to the sum of their magnitudes.
+                std::complex<double> Dot = 0;
+                double Bound = 0;
+                for (size_t i = 0; i < Length; i++)
+                {
+                    Dot += std::conj(X[i]) * Factor[i];
+                    Bound += std::abs(X[i]) * std::abs(Factor[i]);
+                }
+                Complex Actual = ComplexVector::DotProduct(VX, VFactor);
+                Passed &= Check(Name + ": DotProduct matches std::complex", std::abs(std::complex<double>(Actual.a, Actual.b) - Dot) <= 1e-14 * Bound);
+
+                //The norm of values whose squares leave the range.
+                long double Scale = 0, Sum = 0;
+                for (const auto& Curr : X)
+                    Scale = std::max({ Scale, std::fabs(static_cast<long double>(Curr.real())), std::fabs(static_cast<long double>(Curr.imag())) });
+                for (const auto& Curr : X)
+                {
+                    long double re = Curr.real() / Scale, im = Curr.imag() / Scale;
+                    Sum += re * re + im * im;
+                }
+                double Norm = static_cast<double>(Scale * std::sqrt(Sum));
+                Passed &= Check(Name + ": Norm matches a scaled sum", std::fabs(VX.Norm() - Norm) <= 1e-14 * Norm);
+            }
+
+        //Complex GEMM against a naive triple loop, on shapes that are not multiples of the GEMM blocking.
+        for (auto [m, k, n] : { std::tuple<size_t, size_t, size_t>{ 1, 1, 1 }, { 37, 29, 45 }, { 70, 130, 9 } })
+        {
+            std::string Name = "ComplexMatrix " + std::to_string(m) + "x" + std::to_string(k) + " * " + std::to_string(k) + "x" + std::to_string(n);
+            ComplexMatrix A(Random(m, k, static_cast<unsigned>(m + 3)), Random(m, k, static_cast<unsigned>(m + 4)));
+            ComplexMatrix B(Random(k, n, static_cast<unsigned>(n + 5)), Random(k, n, static_cast<unsigned>(n + 6)));
+            ComplexMatrix C = A * B;
+
+            bool Close = C.Rows() == m && C.Columns() == n;
+            for (size_t i = 0; Close && i < m; i++)
+                for (size_t j = 0; Close && j < n; j++)
+                {
+                    std::complex<double> Expected = 0;
+                    double Bound = 0;
+                    for (size_t t = 0; t < k; t++)
+                    {
+                        std::complex<double> a(A.Real()[i][t], A.Imag()[i][t]), b(B.Real()[t][j], B.Imag()[t][j]);
+                        Expected += a * b;
+                        Bound += std::abs(a) * std::abs(b);
+                    }
+
+                    Close = std::abs(std::complex<double>(C.Real()[i][j], C.Imag()[i][j]) - Expected) <= 1e-14 * Bound;
+                }
+            Passed &= Check(Name + ": matches a naive triple loop", Close);
+        }
+
+        return Passed;
+    }
+
+    bool SameBits(double One, double Two)
+    {
+        return std::memcmp(&One, &Two, sizeof(double)) == 0;
+    }
+
+    /// The bytes of a list of units, laid end to end.
+    std::vector<char> Flatten(const std::vector<Unit>& Units)
+    {
+        std::vector<char> Result;
+        for (const Unit& Curr : Units)
+            Result.insert(Result.end(), Curr.Expose(), Curr.Expose() + Curr.GetSize());
+
+        return Result;
+    }
+    /// Splits Bytes into units of UnitSize, padding the last with zeroes.
+    std::vector<Unit> Split(const std::vector<char>& Bytes, unsigned char UnitSize)
+    {
+        std::vector<Unit> Result;
+        for (size_t i = 0; i < Bytes.size(); i += UnitSize)
+        {
+            Unit Curr(UnitSize);
+            std::copy_n(Bytes.begin() + static_cast<std::ptrdiff_t>(i), std::min<size_t>(UnitSize, Bytes.size() - i), Curr.Expose());
+            Result.push_back(std::move(Curr));
+        }
+
+        return Result;
+    }
+
+    /// Writes Value with ToBinary at several unit sizes, and checks that FromBinary reads back a value for which Same holds, in exactly RequiredUnits units.
+    template<typename T, typename Comparison>
+    bool CheckBinary(const std::string& Name, const T& Value, Comparison Same)
+    {
+        size_t SizeMismatches = 0, Mismatches = 0;
+        for (unsigned char UnitSize : { 1, 2, 3, 7, 8, 16, 64, 255 })
+        {
+            std::vector<Unit> Units = Value.ToBinary(UnitSize);
+            bool Sized = Units.size() == Value.RequiredUnits(UnitSize);
+            for (const Unit& Curr : Units)
+                Sized &= Curr.GetSize() == UnitSize;
+            SizeMismatches += !Sized;
+
+            std::unique_ptr<VariableType> Read = VariableType::FromBinary(Units, Value.GetType());
+            const auto* Conv = dynamic_cast<const T*>(Read.get());
+            Mismatches += !Conv || !Same(Value, *Conv);
+        }
+
+        bool Passed = true;
+        Passed &= Check(Name + ": ToBinary fills RequiredUnits units of the unit size", SizeMismatches == 0);
+        Passed &= Check(Name + ": reads back bit for bit", Mismatches == 0);
+        return Passed;
+    }
+
+    bool TestBinary()
+    {
+        bool Passed = true;
+
+        //Values that compare equal without being identical, or not at all, so that only an exact copy passes.
+        const double Special[] = { -0.0, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::quiet_NaN(), 0.1, -1e300 };
+
+        for (double Value : Special)
+            Passed &= CheckBinary("Binary Scalar " + std::to_string(Value), Scalar(Value), [](const Scalar& One, const Scalar& Two) { return SameBits(One.Data, Two.Data); });
+        Passed &= CheckBinary("Binary Complex", Complex(-0.0, 1e-310), [](const Complex& One, const Complex& Two) { return SameBits(One.a, Two.a) && SameBits(One.b, Two.b); });
+
+        auto SameVector = [](const MathVector& One, const MathVector& Two)
+        {
+            bool Same = One.Dim() == Two.Dim();
+            for (size_t i = 0; Same && i < One.Dim(); i++)
+                Same = SameBits(One[i], Two[i]);
+            return Same;
+        };
+        for (size_t Dim : { 0, 1, 3, 40 })
+        {
+            MathVector Vector(Dim);
+            for (size_t i = 0; i < Dim; i++)
+                Vector[i] = i < std::size(Special) ? Special[i] : std::sin(static_cast<double>(i));
+            Passed &= CheckBinary("Binary MathVector of " + std::to_string(Dim), Vector, SameVector);
+        }
+
+        //Columns that do not fill the padded stride, so that the padding must be skipped in both directions.
+        auto SameMatrix = [](const Matrix& One, const Matrix& Two)
+        {
+            bool Same = One.Rows() == Two.Rows() && One.Columns() == Two.Columns();
+            for (size_t i = 0; Same && i < One.Rows(); i++)
+                for (size_t j = 0; Same && j < One.Columns(); j++)
+                    Same = SameBits(One[i][j], Two[i][j]);
+            return Same;
+        };
+        for (auto [Rows, Columns] : { std::pair<size_t, size_t>{ 1, 1 }, { 5, 7 }, { 13, 3 }, { 4, 9 } })
+        {
+            Matrix A = Random(Rows, Columns, static_cast<unsigned>(Rows * 31 + Columns));
+            A[0][0] = -0.0;
+            A[Rows - 1][Columns - 1] = std::numeric_limits<double>::quiet_NaN();
+            Passed &= CheckBinary("Binary Matrix " + std::to_string(Rows) + "x" + std::to_string(Columns), A, SameMatrix);
+        }
+
+        auto SameSparse = [](const SparseMatrix& One, const SparseMatrix& Two) { return One.Format() == Two.Format() && One == Two; };
+        SparseMatrix Csr(RandomSparse(30, 45, 0.1, 89));
+        Passed &= CheckBinary("Binary SparseMatrix CSR", Csr, SameSparse);
+        Passed &= CheckBinary("Binary SparseMatrix CSC", Csr.ToFormat(SF_CSC), SameSparse);
+        Passed &= CheckBinary("Binary SparseMatrix empty", SparseMatrix(6, 4, SF_CSC), SameSparse);
+        Passed &= CheckBinary("Binary SparseMatrix 0x0", SparseMatrix(0, 0), SameSparse);
+
+        //The header is the version, the type, then the payload length as 64 bits; at a unit size of 3 it crosses units.
+        Matrix A = Random(5, 7, 97);
+        std::vector<char> Good = Flatten(A.ToBinary(3));
+        auto Rejects = [&](std::vector<char> Bytes, VariableTypes Expected)
+        {
+            try
+            {
+                (void)VariableType::FromBinary(Split(Bytes, 3), Expected);
+            }
+            catch (const FormatError&)
+            {
+                return true;
+            }
+
+            return false;
+        };
+
+        std::vector<char> Version = Good;
+        Version[0] = static_cast<char>(BinaryFormatVersion + 1);
+        Passed &= Check("Binary: rejects another format version", Rejects(Version, VT_Matrix));
+        Passed &= Check("Binary: rejects another type", Rejects(Good, VT_Vector));
+
+        std::vector<char> Truncated(Good.begin(), Good.begin() + static_cast<std::ptrdiff_t>(BinaryHeaderSize + A.bin_size() / 2));
+        Passed &= Check("Binary: rejects a truncated payload", Rejects(Truncated, VT_Matrix));
+        Passed &= Check("Binary: rejects a header alone", Rejects(std::vector<char>(Good.begin(), Good.begin() + 5), VT_Matrix));
+
+        std::vector<char> Shorter = Good, Longer = Good;
+        Shorter[2] = static_cast<char>(Shorter[2] - 8);
+        Longer[2] = static_cast<char>(Longer[2] + 8);
+        Longer.resize(Longer.size() + 8, 0);
+        Passed &= Check("Binary: rejects a length shorter than the payload", Rejects(Shorter, VT_Matrix));
+        Passed &= Check("Binary: rejects a length longer than the payload", Rejects(Longer, VT_Matrix));
+        Passed &= Check("Binary: the uncorrupted data reads back", !Rejects(Good, VT_Matrix));
+
+        return Passed;
+    }
+
+    bool TestSparseText()
+    {
+        bool Passed = true;
+
+        //Values are written at the precision of the stream, so the full precision of a double reads back exactly.
+        auto RoundTrips = [](const SparseMatrix& Original)
+        {
+            std::stringstream Text;
+            Text << std::setprecision(std::numeric_limits<double>::max_digits10);
+            Original.str_serialize(Text);
+
+            SparseMatrix Read = SparseMatrix::ErrorMatrix();
+            Read.str_deserialize(Text);
+            return Read == Original && Read.Format() == Original.Format() && Read.NonZeros() == Original.NonZeros();
+        };
+
+        SparseMatrix Csr(RandomSparse(40, 25, 0.15, 127));
+        Passed &= Check("Sparse text: CSR round trips", RoundTrips(Csr));
+        Passed &= Check("Sparse text: CSC round trips", RoundTrips(Csr.ToFormat(SF_CSC)));
+        Passed &= Check("Sparse text: no entries round trips", RoundTrips(SparseMatrix(7, 3, SF_CSC)));
+        Passed &= Check("Sparse text: 0x0 round trips", RoundTrips(SparseMatrix(0, 0)));
+
+        //A stored zero would be counted by NonZeros and visited by every product, so loading rejects it in both formats.
+        SparseMatrix Small = SparseMatrix::FromTriplets(2, 3, { { 0, 1, 2.5 }, { 1, 2, -1.0 } });
+        std::stringstream Text;
+        Small.str_serialize(Text);
+        std::string Zeroed = Text.str();
+        Zeroed.replace(Zeroed.find("2.5"), 3, "0");
+
+        bool TextThrew = false;
+        try
+        {
+            std::stringstream In(Zeroed);
+            SparseMatrix Read = SparseMatrix::ErrorMatrix();
+            Read.str_deserialize(In);
+        }
+        catch (const FormatError&)
+        {
+            TextThrew = true;
+        }
+        Passed &= Check("Sparse text: a stored zero is rejected", TextThrew);
+
+        std::vector<char> Bytes = Flatten(Small.ToBinary(8));
+        double Stored = 2.5;
+        auto At = std::search(Bytes.begin(), Bytes.end(), reinterpret_cast<const char*>(&Stored), reinterpret_cast<const char*>(&Stored) + sizeof(double));
+        bool Found = At != Bytes.end();
+        if (Found)
+            std::fill_n(At, sizeof(double), 0);
+
+        bool BinaryThrew = false;
+        try
+        {
+            (void)VariableType::FromBinary(Split(Bytes, 8), VT_Sparse);
+        }
+        catch (const FormatError&)
+        {
+            BinaryThrew = true;
+        }
+        Passed &= Check("Sparse binary: a stored zero is rejected", Found && BinaryThrew);
+
+        return Passed;
+    }
+
+    /// The distance from Actual to Exact, in units in the last place of the double nearest Exact. Subnormals share the smallest unit.
+    double UlpError(double Actual, long double Exact)
+    {
+        int Exponent;
+        std::frexp(Exact, &Exponent);
+        long double Ulp = std::ldexp(1.0L, std::max(Exponent, std::numeric_limits<double>::min_exponent) - std::numeric_limits<double>::digits);
+        return static_cast<double>(std::fabs(Actual - Exact) / Ulp);
+    }
+
+    /// Values of random sign whose magnitudes are 2^u, for u uniform in [LowExponent, HighExponent].
+    std::vector<double> Spread(size_t Count, double LowExponent, double HighExponent, bool Signed, unsigned Seed)
+    {
+        std::mt19937 Gen(Seed);
+        std::uniform_real_distribution<double> Exponent(LowExponent, HighExponent);
+        std::bernoulli_distribution Negative(Signed ? 0.5 : 0.0);
+
+        std::vector<double> Result(Count);
+        for (double& Curr : Result)
+            Curr = (Negative(Gen) ? -1.0 : 1.0) * std::exp2(Exponent(Gen));
+        return Result;
+    }
+
+    std::vector<double> Uniform(size_t Count, double Low, double High, unsigned Seed)
+    {
+        std::mt19937 Gen(Seed);
+        std::uniform_real_distribution<double> Dist(Low, High);
+
+        std::vector<double> Result(Count);
+        for (double& Curr : Result)
+            Curr = Dist(Gen);
+        return Result;
+    }
+
+    /// Runs a kernel over a copy of Arguments, and checks that every result is within Bound ULP of Exact(i).
+    template<typename Kernel, typename Reference>
+    bool CheckUlps(const std::string& Name, const std::vector<double>& Arguments, Kernel&& Run, Reference&& Exact, double Bound)
+    {
+        std::vector<double> Results = Arguments;
+        Run(Results.data(), Results.size());
+
+        double Worst = 0;
+        size_t WorstAt = 0;
+        for (size_t i = 0; i < Results.size(); i++)
+        {
+            double Error = UlpError(Results[i], Exact(i));
+            if (!(Error <= Worst)) //Also catches NaN.
+            {
+                Worst = Error;
+                WorstAt = i;
+            }
+        }
+
+        bool Passed = Worst <= Bound;
+        if (!Passed)
+            std::cerr << std::setprecision(17) << Name << ": " << Worst << " ULP at x = " << Arguments[WorstAt] << '\n';
+        return Check(Name + ": within " + std::to_string(Bound).substr(0, 4) + " ULP", Passed);
+    }
+
+    /// The result of a kernel for each argument, compared bit for bit with libm (any NaN matches any NaN).
+    template<typename Kernel, typename Reference>
+    bool MatchesLibm(const std::vector<double>& Arguments, Kernel&& Run, Reference&& Expected)
+    {
+        std::vector<double> Results = Arguments;
+        Run(Results.data(), Results.size());
+
+        for (size_t i = 0; i < Results.size(); i++)
+        {
+            double Wanted = Expected(i);
+            if (std::isnan(Wanted) ? !std::isnan(Results[i]) : !SameBits(Results[i], Wanted))
+                return false;
+        }
+        return true;
+    }
+
+    bool TestVectorMath()
+    {
+        bool Passed = true;
+        const VectorMathTable& Vm = VectorMath();
+        const std::string Prefix = std::string("VectorMath (") + Vm.Name + ") ";
+
+        //An odd count, so every kernel also runs its partial last register. The bounds are the ones documented in VectorMath.h.
+        constexpr size_t Count = 200003;
+        auto Unary = [&](const char* Name, void (*Run)(double*, size_t) noexcept, long double (*Exact)(long double), const std::vector<double>& X, double Bound)
+        {
+            return CheckUlps(Prefix + Name, X, Run, [&](size_t i) { return Exact(X[i]); }, Bound);
+        };
+
+        std::vector<double> Angles = Spread(Count, -30, 20, true, 131);
+        Passed &= Unary("sin", Vm.Sin, std::sin, Angles, 0.78);
+        Passed &= Unary("cos", Vm.Cos, std::cos, Angles, 0.78);
+        Passed &= Unary("tan", Vm.Tan, std::tan, Angles, 0.85);
+
+        std::vector<double> Unit = Uniform(Count, -1, 1, 137);
+        Passed &= Unary("asin", Vm.Asin, std::asin, Unit, 0.91);
+        Passed &= Unary("acos", Vm.Acos, std::acos, Unit, 0.91);
+        Passed &= Unary("atan", Vm.Atan, std::atan, Spread(Count, -30, 30, true, 139), 0.86);
+
+        //Down to -745 the results reach the subnormal range.
+        Passed &= Unary("exp", Vm.Exp, std::exp, Uniform(Count, -745, 709.7, 149), 0.79);
+        Passed &= Unary("log", Vm.Log, std::log, Spread(Count, -1020, 1020, false, 151), 0.51);
+
+        for (double Base : { 10.0, 0.5 })
+        {
+            std::vector<double> X = Uniform(Count, -300, 300, 157);
+            Passed &= CheckUlps(Prefix + "exp base " + std::to_string(Base).substr(0, 4), X,
+                                [&](double* Out, size_t n) { Vm.ExpBase(Out, Base, n); }, [&](size_t i) { return std::pow(static_cast<long double>(Base), static_cast<long double>(X[i])); }, 0.79);
+
+            std::vector<double> Y = Spread(Count, -1020, 1020, false, 163);
+            Passed &= CheckUlps(Prefix + "log base " + std::to_string(Base).substr(0, 4), Y,
+                                [&](double* Out, size_t n) { Vm.LogBase(Out, Base, n); }, [&](size_t i) { return std::log(static_cast<long double>(Y[i])) / std::log(static_cast<long double>(Base)); }, 0.51);
+        }
+
+        //|y * log2(x)| stays below 1000, so every result is finite and normal.
+        std::vector<double> X = Spread(Count, -20, 20, false, 167), Y = Uniform(Count, -48, 48, 173);
+        Passed &= CheckUlps(Prefix + "pow", X, [&](double* Out, size_t n) { Vm.Pow(Out, Y.data(), n); },
+                            [&](size_t i) { return std::pow(static_cast<long double>(X[i]), static_cast<long double>(Y[i])); }, 0.69);
+        for (double N : { 2.5, -0.3, 7.0 })
+        {
+            std::vector<double> Z = Spread(Count, -100, 100, false, 179);
+            Passed &= CheckUlps(Prefix + "pow const " + std::to_string(N).substr(0, 4), Z, [&](double* Out, size_t n) { Vm.PowConst(Out, N, n); },
+                                [&](size_t i) { return std::pow(static_cast<long double>(Z[i]), static_cast<long double>(N)); }, 0.69);
+        }
+
+        //Special arguments go to libm, so they must come back exactly as libm gives them: NaN, infinities, zeros and subnormals for every function,
+        //and the arguments outside each function's domain. Every list is repeated so that its entries also land in full registers.
+        constexpr double Inf = std::numeric_limits<double>::infinity(), NaN = std::numeric_limits<double>::quiet_NaN(), Tiny = std::numeric_limits<double>::denorm_min();
+        const std::vector<double> Specials = { NaN, Inf, -Inf, 0.0, -0.0, Tiny, -Tiny, 1e-310, -1e-310 };
+        auto Repeated = [&](std::vector<double> Outside)
+        {
+            Outside.insert(Outside.end(), Specials.begin(), Specials.end());
+            std::vector<double> Result;
+            for (int Repeat = 0; Repeat < 9; Repeat++)
+                Result.insert(Result.end(), Outside.begin(), Outside.end());
+            return Result;
+        };
+
+        const std::tuple<const char*, void (*)(double*, size_t) noexcept, double (*)(double), std::vector<double>> Functions[] = {
+            { "sin", Vm.Sin, std::sin, Repeated({ 0x1p21, -0x1p40, 1e308 }) }, { "cos", Vm.Cos, std::cos, Repeated({ 0x1p21, -0x1p40, 1e308 }) },
+            { "tan", Vm.Tan, std::tan, Repeated({ 0x1p21, -0x1p40, 1e308 }) }, { "asin", Vm.Asin, std::asin, Repeated({ 1.5, -2.0, 1e300 }) },
+            { "acos", Vm.Acos, std::acos, Repeated({ 1.0, -1.0, 1.5, -2.0, 1e300 }) }, { "atan", Vm.Atan, std::atan, Repeated({}) },
+            { "exp", Vm.Exp, std::exp, Repeated({ 710.0, -746.0, 1e300, -1e300 }) }, { "log", Vm.Log, std::log, Repeated({ -1.0, -1e300 }) }
+        };
+        for (const auto& [Name, Run, Libm, Args] : Functions)
+            Passed &= Check(Prefix + Name + ": special arguments match libm", MatchesLibm(Args, Run, [&, Libm = Libm, &Args = Args](size_t i) { return Libm(Args[i]); }));
+
+        //A base without a finite, non-zero logarithm sends every lane to libm.
+        const std::vector<double> Exponents = Repeated({ 1e308, -1e308, 2.0, -0.5 }), Logarithms = Repeated({ -1.0, -1e300, 2.0, 0.5 });
+        for (double Base : { 10.0, 0.5, 1.0, 0.0, -2.0, Inf, NaN })
+        {
+            bool Regular = Base == 10.0 || Base == 0.5;
+            std::vector<double> X = Regular ? Repeated({ 1e300, -1e300, 1e308, -1e308 }) : Exponents, Y = Regular ? Repeated({ -1.0, -1e300 }) : Logarithms;
+            Passed &= Check(Prefix + "exp base " + std::to_string(Base) + ": special arguments match libm",
+                            MatchesLibm(X, [&](double* Out, size_t n) { Vm.ExpBase(Out, Base, n); }, [&](size_t i) { return std::pow(Base, X[i]); }));
+            Passed &= Check(Prefix + "log base " + std::to_string(Base) + ": special arguments match libm",
+                            MatchesLibm(Y, [&](double* Out, size_t n) { Vm.LogBase(Out, Base, n); }, [&](size_t i) { return std::log(Y[i]) / std::log(Base); }));
+        }
+
+        //For pow, every special paired with a few ordinary values (and with itself), then the pairs outside the domain or the range of a double.
+        std::vector<double> Bases, Powers;
+        for (double Special : Specials)
+            for (double Other : { 2.0, -2.0, 0.5, -3.0, 1e300, 0x1p60, NaN, Inf, -Inf, 0.0, -0.0, Tiny, -Tiny })
+            {
+                Bases.insert(Bases.end(), { Special, Other });
+                Powers.insert(Powers.end(), { Other, Special });
+            }
+        for (auto [Base, Power] : { std::pair{ -2.0, 0.5 }, { -8.0, 1.0 / 3.0 }, { 10.0, 400.0 }, { 10.0, -400.0 }, { -10.0, 401.0 }, { 1e300, 2.0 },
+                                    { 2.0, 0x1p60 }, { 0.5, -0x1p60 }, { -2.0, 0x1p60 } })
+        {
+            Bases.push_back(Base);
+            Powers.push_back(Power);
+        }
+        for (int Repeat = 0; Repeat < 3; Repeat++)
+        {
+            Bases.insert(Bases.end(), Bases.begin(), Bases.end());
+            Powers.insert(Powers.end(), Powers.begin(), Powers.end());
+        }
+        Passed &= Check(Prefix + "pow: special arguments match libm", MatchesLibm(Bases, [&](double* Out, size_t n) { Vm.Pow(Out, Powers.data(), n); },
+                                                                                    [&](size_t i) { return std::pow(Bases[i], Powers[i]); }));
+
+        //PowConst sees the same pairs, grouped by power.
+        bool SameAsLibm = true;
+        for (double N : Powers)
+        {
+            std::vector<double> X;
+            for (size_t i = 0; i < Powers.size(); i++)
+                if (SameBits(Powers[i], N))
+                    X.push_back(Bases[i]);
+
+            SameAsLibm &= MatchesLibm(X, [&](double* Out, size_t n) { Vm.PowConst(Out, N, n); }, [&](size_t i) { return std::pow(X[i], N); });
+        }
+        Passed &= Check(Prefix + "pow const: special arguments match libm", SameAsLibm);
+
+        return Passed;
+    }
+
+    bool ThrowsOperatorError(char Operator, const Value& One, const Value& Two)
+    {
+        try
+        {
+            (void)Value::Apply(Operator, One, Two);
+        }
+        catch (const OperatorError&)
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+    bool TestValue()
+    {
+        bool Passed = true;
+
+        //Numbers, with a complex operand making the result complex.
+        Value Two(2.0), Three(3.0), Seven(7.0), Half(0.5);
+        std::complex<double> I(0.0, 1.0), W(1.5, -2.0);
+        Passed &= Check("Value: scalar + - * / ^ %", Two + Three == Value(5.0) && Two - Three == Value(-1.0) && Two * Three == Value(6.0) && Three / Two == Value(1.5) &&
+                                                    Value::Apply('^', Two, Three) == Value(8.0) && Value::Apply('%', Seven, Three) == Value(1.0));
+        Passed &= Check("Value: scalar % of a fraction throws", ThrowsOperatorError('%', Seven, Half));
+        Passed &= Check("Value: scalar / 0 throws", ThrowsOperatorError('/', Two, Value(0.0)));
+        Passed &= Check("Value: complex + - * /", Value(I) + Two == Value(2.0 + I) && Two - Value(W) == Value(2.0 - W) && Value(W) * Value(I) == Value(W * I) && Two / Value(W) == Value(2.0 / W));
+        Complex Squared = Value::Apply('^', Value(W), Two).AsComplex();
+        Passed &= Check("Value: complex ^", std::abs(std::complex<double>(Squared.a, Squared.b) - W * W) < 1e-14);
+        Passed &= Check("Value: complex % throws", ThrowsOperatorError('%', Value(W), Two));
+
+        MathVector X = MathVector::FromList(1.0, -2.0, 4.0), Y = MathVector::FromList(0.5, 3.0, -1.0);
+        Value VX(X), VY(Y);
+        Passed &= Check("Value: vector + - vector", (VX + VY).AsVector() == MathVector(X + Y) && (VX - VY).AsVector() == MathVector(X - Y));
+        Passed &= Check("Value: vector * / scalar, scalar * vector", (VX * Three).AsVector() == MathVector(X * 3.0) && (VX / Two).AsVector() == MathVector(X / 2.0) && (Three * VX).AsVector() == MathVector(X * 3.0));
+        Passed &= Check("Value: vector * vector throws", ThrowsOperatorError('*', VX, VY));
+        Passed &= Check("Value: scalar + vector throws", ThrowsOperatorError('+', Two, VX) && ThrowsOperatorError('+', VX, Two));
+        Passed &= Check("Value: vector with complex throws", ThrowsOperatorError('*', VX, Value(I)));
+
+        Matrix A = Matrix::FromList(3, 3, 2.0, -1.0, 0.0, 1.0, 3.0, 1.0, 0.0, 4.0, -2.0), B = Random(3, 3, 103);
+        Value VA(A), VB(B);
+        Passed &= Check("Value: matrix + - * matrix", (VA + VB).AsMatrix() == Matrix(A + B) && (VA - VB).AsMatrix() == Matrix(A - B) && (VA * VB).AsMatrix() == A * B);
+        Passed &= Check("Value: matrix * / scalar, scalar * matrix", (VA * Three).AsMatrix() == Matrix(A * 3.0) && (VA / Two).AsMatrix() == Matrix(A / 2.0) && (Three * VA).AsMatrix() == Matrix(A * 3.0));
+        Passed &= Check("Value: matrix ^ scalar", Value::Apply('^', VA, Three).AsMatrix() == A * A * A && Value::Apply('^', VA, Value(0.0)).AsMatrix() == Matrix::Identity(3));
+        Passed &= Check("Value: matrix ^ a negative or fractional power throws", ThrowsOperatorError('^', VA, Value(-1.0)) && ThrowsOperatorError('^', VA, Half));
+        Passed &= Check("Value: matrix / matrix throws", ThrowsOperatorError('/', VA, VB));
+        Passed &= Check("Value: scalar - matrix throws", ThrowsOperatorError('-', Two, VA));
+
+        //A vector is a column matrix next to a matrix, and vector - matrix keeps its order, so it is the negation of matrix - vector.
+        Matrix Column = Matrix::FromList(3, 1, 1.0, 5.0, -3.0);
+        Value VC(Column);
+        Passed &= Check("Value: matrix + - vector", (VC + VX).AsMatrix() == Matrix(Column + Matrix(X)) && (VC - VX).AsMatrix() == Matrix(Column - Matrix(X)));
+        Passed &= Check("Value: vector + matrix", (VX + VC).AsMatrix() == Matrix(Matrix(X) + Column));
+        Passed &= Check("Value: vector - matrix", (VX - VC).AsMatrix() == Matrix(Matrix(X) - Column) && (VX - VC).AsMatrix() == Matrix(-(VC - VX).AsMatrix()));
+        Passed &= Check("Value: matrix * vector", (VA * VX).AsMatrix() == A * Matrix(X));
+        Passed &= Check("Value: vector * matrix throws", ThrowsOperatorError('*', VX, VA));
+
+        //Copies share their buffer until one of them is written to.
+        Value Original(X);
+        Value Copy = Original;
+        Passed &= Check("Value: a copied vector shares its buffer", !Original.IsUnique() && &Copy.AsVector() == &Original.AsVector());
+        Copy.MutableVector()[0] = 100.0;
+        Passed &= Check("Value: writing to a copied vector leaves the original", Original.AsVector() == X && Copy.AsVector()[0] == 100.0 && Original.IsUnique() && Copy.IsUnique());
+
+        Value OriginalMatrix(A);
+        Value CopyMatrix = OriginalMatrix;
+        CopyMatrix.MutableMatrix()[1][1] = -50.0;
+        Passed &= Check("Value: writing to a copied matrix leaves the original", OriginalMatrix.AsMatrix() == A && CopyMatrix.AsMatrix()[1][1] == -50.0);
+
+        //Compound assignment reuses a buffer owned alone, but not one that is shared.
+        Value Sum = Original + VY;
+        Passed &= Check("Value: adding to a shared vector leaves it", Original.AsVector() == X && Sum.AsVector() == MathVector(X + Y));
+        const MathVector* Buffer = &Original.AsVector();
+        Value Moved = Value::Apply('+', std::move(Original), VY);
+        Passed &= Check("Value: adding to a vector owned alone reuses its buffer", &Moved.AsVector() == Buffer && Moved.AsVector() == MathVector(X + Y));
+
+        Value ScaledCopy = OriginalMatrix * Two;
+        Passed &= Check("Value: scaling a shared matrix leaves it", OriginalMatrix.AsMatrix() == A && ScaledCopy.AsMatrix() == Matrix(A * 2.0));
+
+        return Passed;
+    }
+    bool TestSmallBuffer()
+    {
+        bool Passed = true;
+        typedef SmallBuffer<double, MathVector::InlineDimensions> Buffer;
+        constexpr size_t N = MathVector::InlineDimensions;
+
+        auto Holds = [](const Buffer& B, const std::vector<double>& Expected)
+        {
+            return B.size() == Expected.size() && std::equal(B.begin(), B.end(), Expected.begin());
+        };
+        auto Counting = [](size_t Size)
+        {
+            std::vector<double> Result(Size);
+            for (size_t i = 0; i < Size; i++)
+                Result[i] = static_cast<double>(i + 1);
+            return Result;
+        };
+        auto Filled = [](const std::vector<double>& Values)
+        {
+            Buffer Result(Values.size());
+            std::copy(Values.begin(), Values.end(), Result.begin());
+            return Result;
+        };
+
+        Buffer Empty;
+        Passed &= Check("SmallBuffer: starts empty and inline", Empty.empty() && Empty.is_inline() && Empty.capacity() == N);
+
+        //Growing past the inline storage keeps the elements and zeroes the new ones. Shrinking keeps the heap buffer, so growing again reuses it.
+        Buffer Grown = Filled(Counting(N));
+        Passed &= Check("SmallBuffer: N elements fit inline", Grown.is_inline() && Holds(Grown, Counting(N)));
+        Grown.resize(N + 3);
+        std::vector<double> Expected = Counting(N);
+        Expected.resize(N + 3, 0.0);
+        Passed &= Check("SmallBuffer: growing past N moves to the heap and keeps the elements", !Grown.is_inline() && Holds(Grown, Expected));
+
+        const double* Heap = Grown.data();
+        Grown.resize(2);
+        Passed &= Check("SmallBuffer: shrinking keeps the first elements", Holds(Grown, Counting(2)) && Grown.data() == Heap);
+        Grown.resize(N + 3);
+        Expected = Counting(2);
+        Expected.resize(N + 3, 0.0);
+        Passed &= Check("SmallBuffer: growing again reuses the heap buffer, and zeroes the elements past the old size", Grown.data() == Heap && Holds(Grown, Expected));
+
+        Buffer Assigned;
+        Assigned.assign(N + 1, 7.0);
+        Passed &= Check("SmallBuffer: assign past N moves to the heap", !Assigned.is_inline() && Holds(Assigned, std::vector<double>(N + 1, 7.0)));
+        Assigned.assign(2, -1.0);
+        Passed &= Check("SmallBuffer: assign on the heap replaces the elements", Holds(Assigned, { -1.0, -1.0 }));
+
+        //Copies, in both states and in both directions.
+        const Buffer Small = Filled(Counting(3)), Large = Filled(Counting(N + 5));
+        Buffer SmallCopy(Small), LargeCopy(Large);
+        Passed &= Check("SmallBuffer: copying an inline buffer stays inline", SmallCopy.is_inline() && Holds(SmallCopy, Counting(3)));
+        Passed &= Check("SmallBuffer: copying a heap buffer allocates its own", !LargeCopy.is_inline() && LargeCopy.data() != Large.data() && Holds(LargeCopy, Counting(N + 5)));
+
+        Buffer Shrunk = Filled(Counting(N + 5));
+        Shrunk.resize(2);
+        Buffer ShrunkCopy(Shrunk);
+        Passed &= Check("SmallBuffer: copying a shrunk heap buffer goes inline", ShrunkCopy.is_inline() && Holds(ShrunkCopy, Counting(2)));
+
+        Buffer HeapTarget = Filled(Counting(N + 2));
+        HeapTarget = Small;
+        Passed &= Check("SmallBuffer: copy assigning inline elements into a heap buffer", Holds(HeapTarget, Counting(3)));
+        Buffer InlineTarget = Filled(Counting(2));
+        InlineTarget = Large;
+        Passed &= Check("SmallBuffer: copy assigning heap elements into an inline buffer", !InlineTarget.is_inline() && InlineTarget.data() != Large.data() && Holds(InlineTarget, Counting(N + 5)));
+
+        //Moves hand a heap buffer over, copy inline elements, and always leave the source empty.
+        Buffer LargeSource = Large, SmallSource = Small;
+        const double* Handed = LargeSource.data();
+        Buffer LargeMoved(std::move(LargeSource)), SmallMoved(std::move(SmallSource));
+        Passed &= Check("SmallBuffer: moving a heap buffer hands it over", LargeMoved.data() == Handed && Holds(LargeMoved, Counting(N + 5)));
+        Passed &= Check("SmallBuffer: moving an inline buffer copies it", SmallMoved.is_inline() && Holds(SmallMoved, Counting(3)));
+        Passed &= Check("SmallBuffer: a moved from buffer is empty and inline", LargeSource.empty() && LargeSource.is_inline() && SmallSource.empty() && SmallSource.is_inline());
+
+        Buffer HeapMoveTarget = Filled(Counting(N + 2)), InlineMoveTarget = Filled(Counting(1));
+        HeapMoveTarget = Filled(Counting(3));
+        Passed &= Check("SmallBuffer: move assigning inline elements into a heap buffer", Holds(HeapMoveTarget, Counting(3)));
+        Handed = LargeMoved.data();
+        InlineMoveTarget = std::move(LargeMoved);
+        Passed &= Check("SmallBuffer: move assigning a heap buffer into an inline buffer hands it over", InlineMoveTarget.data() == Handed && Holds(InlineMoveTarget, Counting(N + 5)) && LargeMoved.empty());
+        Buffer HeapToHeap = Filled(Counting(N + 1));
+        HeapToHeap = std::move(InlineMoveTarget);
+        Passed &= Check("SmallBuffer: move assigning a heap buffer into a heap buffer hands it over", HeapToHeap.data() == Handed && Holds(HeapToHeap, Counting(N + 5)));
+
+        //Self assignment, through a reference so the compiler does not see it, changes nothing in either state.
+        for (Buffer* Self : { &SmallMoved, &HeapToHeap })
+        {
+            std::vector<double> Before(Self->begin(), Self->end());
+            const double* Storage = Self->data();
+            Buffer& Alias = *Self;
+            *Self = Alias;
+            bool Copied = Self->data() == Storage && Holds(*Self, Before);
+            *Self = std::move(Alias);
+            bool Moved = Self->data() == Storage && Holds(*Self, Before);
+            Passed &= Check(std::string("SmallBuffer: self assignment of an ") + (Self->is_inline() ? "inline" : "heap") + " buffer", Copied && Moved);
+        }
+
+        //The same transitions through MathVector, which stores its elements in a SmallBuffer.
+        MathVector Vector = MathVector::FromList(1, 2, 3);
+        MathVector Wide(N + 3, 2.5);
+        Vector = Wide;
+        Passed &= Check("SmallBuffer: a MathVector grows past InlineDimensions", Vector == Wide && Vector.Dim() == N + 3);
+        Vector = MathVector::FromList(4, 5);
+        Passed &= Check("SmallBuffer: a MathVector shrinks back", Vector == MathVector::FromList(4, 5));
+        MathVector Taken(std::move(Wide));
+        Passed &= Check("SmallBuffer: a moved MathVector keeps its elements", Taken == MathVector(N + 3, 2.5));
+
+        return Passed;
+    }
+
+    /// True if Action throws an OperatorError from the operator Operator, because of Reason.
+    template<typename T>
+    bool ThrowsAt(const std::string& Operator, const std::string& Reason, T&& Action)
+    {
+        try
+        {
+            Action();
+        }
+        catch (const OperatorError& e)
+        {
+            std::string Message = e.what();
+            return Message.starts_with("the operator '" + Operator + "'") && Message.find(Reason) != std::string::npos;
+        }
+
+        return false;
+    }
+
+    bool TestExpressions()
+    {
+        bool Passed = true;
+
+        //The lazy trees perform the same operations, in the same order, as the element-wise loops below, so the results match exactly.
+        const Matrix A = Random(5, 7, 211), B = Random(5, 7, 212), C = Random(5, 7, 213);
+        auto Elementwise = [&](auto Element)
+        {
+            Matrix Result(A.Rows(), A.Columns());
+            for (size_t i = 0; i < A.Rows(); i++)
+                for (size_t j = 0; j < A.Columns(); j++)
+                    Result[i][j] = Element(i, j);
+            return Result;
+        };
+
+        Matrix Lazy = A + B - C * 2;
+        Passed &= Check("Matrix expressions: A + B - C * 2 matches the eager result", Lazy == Elementwise([&](size_t i, size_t j) { return A[i][j] + B[i][j] - C[i][j] * 2; }));
+        Lazy = -A + B / 4 - 0.5 * C;
+        Passed &= Check("Matrix expressions: negation, division and a leading factor", Lazy == Elementwise([&](size_t i, size_t j) { return A[i][j] * -1.0 + B[i][j] / 4 - C[i][j] * 0.5; }));
+
+        //Temporaries are moved into the tree, so it can outlive the statement that built it.
+        auto Deferred = A + Matrix(B) * 2 - Random(5, 7, 213);
+        Passed &= Check("Matrix expressions: temporaries live as long as the tree", Matrix(Deferred) == Elementwise([&](size_t i, size_t j) { return A[i][j] + B[i][j] * 2 - C[i][j]; }));
+
+        //Each element only reads the same element of the operands, so writing over an operand is safe.
+        Matrix X = A;
+        X = X + B;
+        Passed &= Check("Matrix expressions: A = A + B", X == Elementwise([&](size_t i, size_t j) { return A[i][j] + B[i][j]; }));
+        X = A;
+        X = X * 3 - X;
+        Passed &= Check("Matrix expressions: X = X * 3 - X", X == Elementwise([&](size_t i, size_t j) { return A[i][j] * 3 - A[i][j]; }));
+        X = A;
+        X = B - X;
+        Passed &= Check("Matrix expressions: X = B - X", X == Elementwise([&](size_t i, size_t j) { return B[i][j] - A[i][j]; }));
+        X = A;
+        X += X * 2;
+        Passed &= Check("Matrix expressions: X += X * 2", X == Elementwise([&](size_t i, size_t j) { return A[i][j] + A[i][j] * 2; }));
+        X = Random(2, 2, 217);
+        X = A - C;
+        Passed &= Check("Matrix expressions: assigning to a matrix of another shape resizes it", X == Elementwise([&](size_t i, size_t j) { return A[i][j] - C[i][j]; }));
+
+        //Products are computed eagerly, from the evaluated sides, and enter the tree as temporaries.
+        const Matrix S = Random(6, 6, 219), T = Random(6, 6, 221), R = Random(7, 3, 223);
+        Matrix Sum = S, Difference = S;
+        Sum += T;
+        Difference -= T;
+        Passed &= Check("Matrix expressions: (S + T) * (S - T)", Matrix((S + T) * (S - T)) == Sum * Difference);
+
+        Matrix Product = S * T, Expected = Product;
+        for (size_t i = 0; i < 6; i++)
+            for (size_t j = 0; j < 6; j++)
+                Expected[i][j] = Product[i][j] + S[i][j] * 2;
+        Passed &= Check("Matrix expressions: S * T + S * 2", Matrix(S * T + S * 2) == Expected);
+        Matrix Y = S;
+        Y = Y * T + Y * 2;
+        Passed &= Check("Matrix expressions: Y = Y * T + Y * 2", Y == Expected);
+
+        Matrix Left = A;
+        Left += B;
+        Passed &= Check("Matrix expressions: a rectangular (A + B) * R", Matrix((A + B) * R) == Left * R);
+
+        //Shapes are checked as each node is built, so the error names the operator that caused it.
+        const Matrix Wrong = Random(7, 5, 227), Narrow = Random(5, 6, 229), Empty = Matrix::ErrorMatrix();
+        Passed &= Check("Matrix expressions: A + Wrong throws at '+'", ThrowsAt("+", "dimension mismatch", [&] { (void)(A + Wrong); }));
+        Passed &= Check("Matrix expressions: A + B - Narrow * 2 throws at '-'", ThrowsAt("-", "dimension mismatch", [&] { (void)(A + B - Narrow * 2); }));
+        Passed &= Check("Matrix expressions: A * 2 + an empty matrix throws at '+'", ThrowsAt("+", "empty matrix", [&] { (void)(A * 2 + Empty); }));
+        Passed &= Check("Matrix expressions: (A + B) * A throws at '*'", ThrowsAt("*", "dimension mismatch", [&] { (void)((A + B) * A); }));
+        Passed &= Check("Matrix expressions: A / 0 throws at '/'", ThrowsAt("/", "divide by zero", [&] { (void)(A / 0); }));
+        Passed &= Check("Matrix expressions: X += Wrong + Wrong throws at '+'", ThrowsAt("+", "dimension mismatch", [&] { X += Wrong + Wrong; }));
+
+        //Vectors of different dimensions combine, with the shorter one padded by zeroes.
+        const MathVector v = MathVector::FromList(0.5, -1.25, 3, 7.5, -2), w = MathVector::FromList(4, 0.25, -6, 1, 9), u = MathVector::FromList(-3, 2.5, 1);
+        auto Padded = [](const MathVector& Vector, size_t i) { return i < Vector.Dim() ? Vector[i] : 0.0; };
+        auto Elements = [](size_t Dim, auto Element)
+        {
+            MathVector Result(Dim);
+            for (size_t i = 0; i < Dim; i++)
+                Result[i] = Element(i);
+            return Result;
+        };
+
+        Passed &= Check("Vector expressions: v + w - u * 2 matches the eager result, with u padded",
+                        MathVector(v + w - u * 2) == Elements(5, [&](size_t i) { return v[i] + w[i] - Padded(u, i) * 2; }));
+        auto DeferredVector = v + MathVector(w) * 2;
+        Passed &= Check("Vector expressions: temporaries live as long as the tree", MathVector(DeferredVector) == Elements(5, [&](size_t i) { return v[i] + w[i] * 2; }));
+        Passed &= Check("Vector expressions: single elements", (v + w)[4] == v[4] + w[4] && (v + u)[4] == v[4]);
+
+        MathVector x = v;
+        x = x * 2 - x;
+        Passed &= Check("Vector expressions: v = v * 2 - v", x == Elements(5, [&](size_t i) { return v[i] * 2 - v[i]; }));
+        x = v;
+        x = u - x;
+        Passed &= Check("Vector expressions: x = u - x, with u shorter", x == Elements(5, [&](size_t i) { return Padded(u, i) - v[i]; }));
+        MathVector y = u;
+        y = y + v;
+        Passed &= Check("Vector expressions: y = y + v, which lengthens y", y == Elements(5, [&](size_t i) { return Padded(u, i) + v[i]; }));
+        y = u;
+        y -= y * 0.5;
+        Passed &= Check("Vector expressions: y -= y * 0.5", y == Elements(3, [&](size_t i) { return u[i] - u[i] * 0.5; }));
+
+        const MathVector None;
+        Passed &= Check("Vector expressions: two error vectors throw at '+'", ThrowsAt("+", "error vectors", [&] { (void)(None + None); }));
+        Passed &= Check("Vector expressions: v + w - an error vector / 2 throws at '/'", ThrowsAt("/", "error vector", [&] { (void)(v + w - None / 2); }));
+        Passed &= Check("Vector expressions: v / 0 throws at '/'", ThrowsAt("/", "divide by zero", [&] { (void)(v / 0); }));
+        bool OutOfRange = false;
+        try
+        {
+            (void)(v + u)[5];
+        }
+        catch (const std::logic_error&)
+        {
+            OutOfRange = true;
+        }
+        Passed &= Check("Vector expressions: an element past the end throws", OutOfRange);
+
+        return Passed;
+    }
+
+    /// The largest difference between two vectors, or infinity if their dimensions differ.
+    double Distance(const MathVector& One, const MathVector& Two)
+    {
+        if (One.Dim() != Two.Dim())
+            return std::numeric_limits<double>::infinity();
+
+        double Result = 0;
+        for (size_t i = 0; i < One.Dim(); i++)
+            Result = std::max(Result, std::fabs(One[i] - Two[i]));
+        return Result;
+    }
+
+    bool TestVectorBatch()
+    {
+        bool Passed = true;
+
+        //Counts below, at, and just past one chunk, and past two chunks with a remainder that is not a multiple of any SIMD width.
+        for (size_t Count : { size_t(1), size_t(7), VectorBatch::ChunkSize, VectorBatch::ChunkSize + 1, 2 * VectorBatch::ChunkSize + 7 })
+            for (size_t Dim : { 2, 3, 5 })
+            {
+                const std::string Name = "VectorBatch " + std::to_string(Dim) + "D x " + std::to_string(Count) + ": ";
+                const unsigned Seed = static_cast<unsigned>(Count * 10 + Dim);
+                VectorBatch A(Random(Dim, Count, Seed)), B(Random(Dim, Count, Seed + 1));
+                std::vector<MathVector> As = A.ToVectors(), Bs = B.ToVectors();
+
+                std::vector<double> Dots = VectorBatch::DotProduct(A, B), Norms = A.Magnitudes();
+                bool DotsMatch = Dots.size() == Count, NormsMatch = Norms.size() == Count;
+                for (size_t i = 0; i < Count && DotsMatch && NormsMatch; i++)
+                {
+                    DotsMatch = std::fabs(Dots[i] - MathVector::DotProduct(As[i], Bs[i])) <= Tolerance;
+                    NormsMatch = std::fabs(Norms[i] - As[i].Magnitude()) <= Tolerance;
+                }
+                Passed &= Check(Name + "dot products match MathVector", DotsMatch);
+                Passed &= Check(Name + "magnitudes match MathVector", NormsMatch);
+
+                if (Dim <= 3)
+                {
+                    VectorBatch Cross = VectorBatch::CrossProduct(A, B);
+                    bool CrossMatch = Cross.Dim() == 3 && Cross.Count() == Count;
+                    for (size_t i = 0; i < Count && CrossMatch; i++)
+                        CrossMatch = Distance(Cross.Get(i), MathVector::CrossProduct(As[i], Bs[i])) <= Tolerance;
+                    Passed &= Check(Name + "cross products match MathVector", CrossMatch);
+                }
+                else
+                    Passed &= Check(Name + "cross product throws", Throws([&] { (void)VectorBatch::CrossProduct(A, B); }));
+
+                VectorBatch Sum = A;
+                Sum.AddScaled(B, -0.75);
+                bool SumMatch = true;
+                for (size_t i = 0; i < Count && SumMatch; i++)
+                {
+                    MathVector Expected = As[i];
+                    Expected.AddScaled(Bs[i], -0.75);
+                    SumMatch = Distance(Sum.Get(i), Expected) <= Tolerance;
+                }
+                Passed &= Check(Name + "AddScaled matches MathVector", SumMatch);
+
+                //Zero vectors at the start, at the last index of the first chunk, and at the very end must stay zero instead of becoming 0/0.
+                VectorBatch Unit = A;
+                const MathVector Zero(Dim);
+                std::vector<size_t> Zeroes = { 0, std::min(Count, VectorBatch::ChunkSize) - 1, Count - 1 };
+                for (size_t i : Zeroes)
+                    Unit.Set(i, Zero);
+                Unit.Normalize();
+                bool UnitMatch = true;
+                for (size_t i = 0; i < Count && UnitMatch; i++)
+                {
+                    bool IsZero = std::find(Zeroes.begin(), Zeroes.end(), i) != Zeroes.end();
+                    MathVector Expected = IsZero ? Zero : MathVector(As[i] / As[i].Magnitude());
+                    UnitMatch = IsZero ? Unit.Get(i) == Zero : Distance(Unit.Get(i), Expected) <= Tolerance;
+                }
+                Passed &= Check(Name + "Normalize matches MathVector, and leaves zero vectors", UnitMatch);
+
+                Passed &= Check(Name + "mismatched counts throw", Throws([&] { (void)VectorBatch::DotProduct(A, VectorBatch(Dim, Count + 1)); }));
+                Passed &= Check(Name + "mismatched dimensions throw", Throws([&] { A.AddScaled(VectorBatch(Dim + 1, Count), 1.0); }));
+            }
+
+        //Adopting a matrix of columns and handing it back reuse the same storage.
+        Matrix Points = Random(3, 2049, 191);
+        const Matrix Original = Points;
+        const double* Storage = Points.RowData(0);
+        VectorBatch Adopted(std::move(Points));
+        Passed &= Check("VectorBatch: adopting a matrix does not copy it", Adopted.Component(0) == Storage && Adopted.AsMatrix() == Original);
+        Passed &= Check("VectorBatch: the columns are the vectors", Adopted.Count() == 2049 && Adopted.Get(2048) == MathVector::FromList(Original[0][2048], Original[1][2048], Original[2][2048]));
+
+        VectorBatch Copied(Original);
+        Passed &= Check("VectorBatch: copying a matrix leaves it", Copied.Component(0) != Original.RowData(0) && Copied.AsMatrix() == Original);
+
+        Matrix Released = std::move(Adopted).ToMatrix();
+        Passed &= Check("VectorBatch: releasing the matrix does not copy it", Released.RowData(0) == Storage && Released == Original);
+        Passed &= Check("VectorBatch: releasing the matrix leaves the batch empty", !Adopted.IsValid() && Adopted.Count() == 0);
+
+        return Passed;
+    }
+}
+
+bool NumericsTester() noexcept
+{
+    bool Passed = true;
     try
     {
         Scalar a(1.1), b(3.2), c(0.00);
@@ -70,12 +2008,41 @@ bool NumericsTester()
         MathVector vd = MathVector::FromList(3, 4, 5);
         MathVector cross = MathVector::CrossProduct(vc, vd);
         std::cout << display_print(cross) << " == " << display_print(MathVector::FromList(6, -12, 6)) << " ? " << (cross == MathVector::FromList(6, -12, 6)) << std::endl;
+
+        Passed &= TestLU();
+        Passed &= TestRowReduction();
+        Passed &= TestTranspose();
+        Passed &= TestPow();
+        Passed &= TestFixedInverse<1>();
+        Passed &= TestFixedInverse<2>();
+        Passed &= TestFixedInverse<3>();
+        Passed &= TestFixedInverse<4>();
+        Passed &= TestSparseProducts();
+        Passed &= TestIterativeSolvers();
+        Passed &= TestQR();
+        Passed &= TestCholesky();
+        Passed &= TestSymmetricEigen();
+        Passed &= TestSingularValueDecomposition();
+        Passed &= TestFft();
+        Passed &= TestComplexKernels();
+        Passed &= TestVectorMath();
+        Passed &= TestBinary();
+        Passed &= TestSparseText();
+        Passed &= TestValue();
+        Passed &= TestSmallBuffer();
+        Passed &= TestVectorBatch();
+        Passed &= TestExpressions();
     }
     catch (const ErrorBase& e)
     {
         std::cerr << "Cought: " << e << std::endl;
         return false;
     }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Cought: " << e.what() << std::endl;
+        return false;
+    }
     
-    return true;
+    return Passed;
 }
@@ -0,0 +1,184 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "QRDecomposition.h"
+#include "Householder.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    //The number of reflectors gathered into one block before they are applied to the rest of the matrix with GEMMs.
+    constexpr size_t BlockSize = 32;
+}
+
+QRDecomposition::QRDecomposition(const Matrix& A) : Factors(A)
+{
+    if (!A.IsValid())
+        throw OperationError("QR decomposition", "empty matrix");
+
+    Factorize();
+}
+
+void QRDecomposition::Factorize()
+{
+    size_t m = Rows(), n = Columns(), k = std::min(m, n);
+    Tau.assign(k, 0.0);
+
+    /*
+     * Blocked Householder QR. For each block of columns:
+     *  1. Factor the panel with one reflector per column, applying each reflector only within the panel.
+     *  2. Build T for the compact WY form of the block, so that H_s H_(s+1) ... H_(s+w-1) = I - V T V^T.
+     *  3. Apply the whole block to the trailing columns at once, which is three GEMMs instead of w rank 1 updates.
+     */
+    for (size_t s = 0; s < k; s += BlockSize)
+    {
+        size_t w = std::min(BlockSize, k - s);
+        FactorizePanel(s, w);
+
+        Matrix V = GatherReflectors(Factors.View(), s, w, 0);
+        Matrix T = ReflectorBlockT(V, Tau.data() + s);
+
+        if (s + w < n)
+            ApplyReflectorBlock(V, T, Factors.Block(s, s + w, m - s, n - s - w), true);
+
+        BlockT.push_back(std::move(T));
+    }
+}
+void QRDecomposition::FactorizePanel(size_t Start, size_t Width)
+{
+    size_t m = Rows();
+    const auto& simd = SimdKernels();
+    std::vector<double> w(Width);
+
+    for (size_t j = Start; j < Start + Width; j++)
+    {
+        double tau = Tau[j] = GenerateReflector(Factors.RowData(j)[j], Factors.RowData(j) + j + Factors.LeadingDimension(), m - j - 1, Factors.LeadingDimension());
+        if (tau == 0) //Already zero below the diagonal, so the reflector is the identity.
+            continue;
+
+        //Apply H = I - tau v v^T to the rest of the panel: w = v^T A, then A -= tau v w^T. Both passes run along rows.
+        size_t width = Start + Width - j - 1;
+        if (width == 0)
+            continue;
+
+        double* pivotRow = Factors.RowData(j) + j + 1;
+        std::copy_n(pivotRow, width, w.data());
+        for (size_t i = j + 1; i < m; i++)
+            simd.Axpy(w.data(), Factors.RowData(i)[j], Factors.RowData(i) + j + 1, width);
+
+        simd.Axpy(pivotRow, -tau, w.data(), width);
+        for (size_t i = j + 1; i < m; i++)
+            simd.Axpy(Factors.RowData(i) + j + 1, -tau * Factors.RowData(i)[j], w.data(), width);
+    }
+}
+bool QRDecomposition::IsFullRank() const noexcept
+{
+    size_t m = Rows(), n = Columns(), k = std::min(m, n);
+    if (k < n)
+        return false;
+
+    double largest = 0;
+    for (size_t i = 0; i < k; i++)
+        largest = std::max(largest, std::abs(Factors.RowData(i)[i]));
+
+    double tolerance = static_cast<double>(std::max(m, n)) * std::numeric_limits<double>::epsilon() * largest;
+    if (largest == 0)
+        return false;
+
+    for (size_t i = 0; i < k; i++)
+        if (std::abs(Factors.RowData(i)[i]) <= tolerance)
+            return false;
+
+    return true;
+}
+
+Matrix QRDecomposition::Q() const
+{
+    Matrix result = Matrix::Identity(Rows(), std::min(Rows(), Columns()));
+    ApplyQ(result);
+    return result;
+}
+Matrix QRDecomposition::R() const
+{
+    size_t k = std::min(Rows(), Columns()), n = Columns();
+    Matrix result(k, n);
+    for (size_t i = 0; i < k; i++)
+        std::copy(Factors.RowData(i) + i, Factors.RowData(i) + n, result.RowData(i) + i);
+
+    return result;
+}
+
+void QRDecomposition::ApplyQ(Matrix& B) const
+{
+    if (B.Rows() != Rows())
+        throw OperationError("apply Q", "dimension mismatch");
+
+    //Q = Q_0 Q_1 ... Q_last, so the block closest to B is applied first.
+    size_t m = Rows(), p = B.Columns(), k = std::min(Rows(), Columns());
+    for (size_t b = BlockT.size(); b-- > 0; )
+    {
+        size_t s = b * BlockSize, w = std::min(BlockSize, k - s);
+        ApplyReflectorBlock(GatherReflectors(Factors.View(), s, w, 0), BlockT[b], B.Block(s, 0, m - s, p), false);
+    }
+}
+void QRDecomposition::ApplyQTranspose(Matrix& B) const
+{
+    if (B.Rows() != Rows())
+        throw OperationError("apply Q", "dimension mismatch");
+
+    size_t m = Rows(), p = B.Columns(), k = std::min(Rows(), Columns());
+    for (size_t b = 0; b < BlockT.size(); b++)
+    {
+        size_t s = b * BlockSize, w = std::min(BlockSize, k - s);
+        ApplyReflectorBlock(GatherReflectors(Factors.View(), s, w, 0), BlockT[b], B.Block(s, 0, m - s, p), true);
+    }
+}
+
+MathVector QRDecomposition::SolveLeastSquares(const MathVector& b) const
+{
+    if (b.Dim() != Rows())
+        throw OperationError("least squares", "dimension mismatch");
+
+    Matrix x = SolveLeastSquares(Matrix(b));
+    MathVector result(Columns());
+    for (size_t i = 0; i < Columns(); i++)
+        result[i] = x.RowData(i)[0];
+
+    return result;
+}
+Matrix QRDecomposition::SolveLeastSquares(const Matrix& B) const
+{
+    if (B.Rows() != Rows())
+        throw OperationError("least squares", "dimension mismatch");
+    if (Columns() > Rows())
+        throw OperationError("least squares", "the matrix has more columns than rows");
+    if (!IsFullRank())
+        throw OperationError("least squares", "the matrix is rank deficient");
+
+    /*
+     * ||Ax - b|| = ||Q^T A x - Q^T b|| = ||Rx - Q^T b||, since Q is orthogonal. The first n rows of that can be made exactly
+     * zero by back substitution, and the remaining m - n rows of Q^T b are the part of b no choice of x can reach.
+     */
+    size_t n = Columns(), p = B.Columns();
+    const auto& simd = SimdKernels();
+    Matrix X(B);
+    ApplyQTranspose(X);
+
+    for (size_t i = n; i-- > 0; )
+    {
+        const double* r = Factors.RowData(i);
+        double* row = X.RowData(i);
+        for (size_t k = i + 1; k < n; k++)
+            if (r[k] != 0)
+                simd.Axpy(row, -r[k], X.RowData(k), p);
+
+        simd.Divide(row, r[i], p);
+    }
+
+    return X.Extract(0, 0, n, p);
+}
@@ -0,0 +1,77 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_QRDECOMPOSITION_H
+#define JASON_QRDECOMPOSITION_H
+
+#include "Matrix.h"
+#include "MathVector.h"
+
+#include <vector>
+
+/// <summary>
+/// The factorization A = QR of an m x n matrix, where Q is orthogonal (m x m) and R is upper triangular (m x n), computed with Householder reflections.
+/// Q is never formed explicitly; it is kept as the reflectors themselves, and applied blockwise with GEMMs. This is the stable way to solve least squares problems, since it never squares the condition number the way the normal equations (A^T A x = A^T b) do.
+/// </summary>
+class QRDecomposition
+{
+private:
+    /// <summary>
+    /// R on and above the diagonal. Below the diagonal, column j holds the Householder vector of reflector j, whose leading 1 is implicit.
+    /// </summary>
+    Matrix Factors;
+    /// <summary>
+    /// The scale of each reflector: H_j = I - Tau[j] * v_j * v_j^T.
+    /// </summary>
+    std::vector<double> Tau;
+    /// <summary>
+    /// The upper triangular T of each block of reflectors, in the compact WY form H_j H_(j+1) ... = I - V * T * V^T.
+    /// </summary>
+    std::vector<Matrix> BlockT;
+
+    void Factorize();
+    void FactorizePanel(size_t Start, size_t Width);
+
+public:
+    /// <summary>
+    /// Factors the matrix. Throws if the matrix is empty.
+    /// </summary>
+    explicit QRDecomposition(const Matrix& A);
+
+    [[nodiscard]] size_t Rows() const noexcept { return Factors.Rows(); }
+    [[nodiscard]] size_t Columns() const noexcept { return Factors.Columns(); }
+    [[nodiscard]] const Matrix& PackedFactors() const noexcept { return Factors; }
+    [[nodiscard]] const std::vector<double>& HouseholderScales() const noexcept { return Tau; }
+
+    /// <summary>
+    /// True if every diagonal entry of R is nonzero, relative to the size and norm of the original matrix. Only full rank, tall (m >= n) factorizations can solve least squares problems.
+    /// </summary>
+    [[nodiscard]] bool IsFullRank() const noexcept;
+
+    /// <summary>
+    /// The thin factors: Q is m x k and R is k x n, where k = min(m, n).
+    /// </summary>
+    [[nodiscard]] Matrix Q() const;
+    [[nodiscard]] Matrix R() const;
+
+    /// <summary>
+    /// Overwrites B (which must have m rows) with Q * B.
+    /// </summary>
+    void ApplyQ(Matrix& B) const;
+    /// <summary>
+    /// Overwrites B (which must have m rows) with Q^T * B.
+    /// </summary>
+    void ApplyQTranspose(Matrix& B) const;
+
+    /// <summary>
+    /// Finds the x minimizing ||Ax - b||. When A is square, this is the solution of Ax = b. Throws if A has more columns than rows, or is rank deficient.
+    /// </summary>
+    [[nodiscard]] MathVector SolveLeastSquares(const MathVector& b) const;
+    /// <summary>
+    /// Solves the least squares problem for every column of B.
+    /// </summary>
+    [[nodiscard]] Matrix SolveLeastSquares(const Matrix& B) const;
+};
+
+#endif //JASON_QRDECOMPOSITION_H
@@ -0,0 +1,233 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "RowReduction.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    //The number of columns eliminated at a time before the columns to their right are updated with a GEMM.
+    constexpr size_t BlockSize = 64;
+
+    /// The threshold at or below which a candidate pivot is treated as zero.
+    struct PivotTolerance
+    {
+        /// A tolerance given by the caller, or negative for the automatic one.
+        double Fixed;
+        /// max(rows, cols) * epsilon.
+        double Scale;
+        /// The infinity norm of the matrix being reduced.
+        double Norm;
+        /// The largest absolute value of U found so far.
+        double Growth = 0;
+
+        /// The threshold for the next pivot, once Pivots pivots have been found.
+        [[nodiscard]] double operator()(size_t Pivots) const noexcept
+        {
+            //Each entry left after p pivots has absorbed p updates of size at most |l| * max|U| <= max|U|, so its rounding error grows with p * max|U|.
+            return Fixed >= 0 ? Fixed : Scale * std::max(Norm, static_cast<double>(Pivots) * Growth);
+        }
+    };
+
+    /// Eliminates the columns [Start, Start + Width) of A, beginning at pivot row Row. Only the columns inside the panel are updated.
+    /// Multipliers are left in place below each pivot, and the column of each pivot found is appended to Pivots.
+    void EliminatePanel(const SimdKernelTable& simd, MatrixView A, size_t Start, size_t Width, size_t& Row, PivotTolerance& Tolerance, std::vector<size_t>& Pivots)
+    {
+        size_t m = A.Rows(), n = A.Columns(), end = Start + Width;
+
+        for (size_t c = Start; c < end && Row < m; c++)
+        {
+            size_t pivot = Row;
+            double best = std::abs(A(Row, c));
+            for (size_t i = Row + 1; i < m; i++)
+            {
+                double curr = std::abs(A(i, c));
+                if (curr > best)
+                {
+                    best = curr;
+                    pivot = i;
+                }
+            }
+
+            if (best <= Tolerance(Pivots.size()))
+            {
+                //No usable pivot; whatever is left in this column is rounding error, so it is cleared.
+                for (size_t i = Row; i < m; i++)
+                    A(i, c) = 0;
+                continue;
+            }
+
+            if (pivot != Row)
+                std::swap_ranges(A.RowData(Row), A.RowData(Row) + n, A.RowData(pivot));
+
+            const double* pivotRow = A.RowData(Row);
+            double pivotValue = pivotRow[c];
+            size_t remaining = end - c - 1;
+            //Inside the panel the pivot row is final, while the part to its right is only updated once the panel is done.
+            for (size_t j = c; j < end; j++)
+                Tolerance.Growth = std::max(Tolerance.Growth, std::abs(pivotRow[j]));
+
+            for (size_t i = Row + 1; i < m; i++)
+            {
+                double* row = A.RowData(i);
+                double fac = row[c] /= pivotValue;
+                if (fac != 0 && remaining != 0)
+                    simd.Axpy(row + c + 1, -fac, pivotRow + c + 1, remaining);
+            }
+
+            Pivots.push_back(c);
+            Row++;
+        }
+    }
+}
+
+EliminationResult RowReduce(MatrixView A, RowReductionForm Form, double Tolerance)
+{
+    if (!A.IsRowContiguous())
+        throw std::logic_error("Row reduction requires a view with contiguous rows.");
+
+    EliminationResult result;
+    if (!A.IsValid())
+        return result;
+
+    size_t m = A.Rows(), n = A.Columns();
+    const auto& simd = SimdKernels();
+
+    PivotTolerance tolerance { Tolerance, static_cast<double>(std::max(m, n)) * std::numeric_limits<double>::epsilon(), 0 };
+    if (Tolerance < 0)
+    {
+        //Rounding error is measured against the infinity norm (the largest absolute row sum), and against the growth of U as it is found.
+        for (size_t i = 0; i < m; i++)
+        {
+            double sum = 0;
+            for (size_t j = 0; j < n; j++)
+                sum += std::abs(A(i, j));
+            tolerance.Norm = std::max(tolerance.Norm, sum);
+        }
+    }
+
+    std::vector<size_t>& pivots = result.PivotColumns;
+    std::vector<double> scratch;
+
+    /*
+     * Forward elimination, right looking and blocked, as in LUDecomposition. For each panel of columns:
+     *  1. Eliminate inside the panel with partial pivoting, keeping the multipliers (L) below the pivots.
+     *  2. Solve L11 * U12 = A12 for the pivot rows, to the right of the panel.
+     *  3. Update everything below the pivot rows and to the right of the panel with A22 -= L21 * U12, through GEMM.
+     *  4. Clear the multipliers, leaving exact zeroes below every pivot.
+     * Unlike LU, a panel can find fewer pivots than it has columns (or none at all), since the matrix may be rank deficient or rectangular.
+     */
+    size_t row = 0;
+    for (size_t c0 = 0; c0 < n && row < m; c0 += BlockSize)
+    {
+        size_t width = std::min(BlockSize, n - c0), r0 = row, p0 = pivots.size();
+        EliminatePanel(simd, A, c0, width, row, tolerance, pivots);
+
+        size_t kb = row - r0, rest = n - c0 - width, below = m - row;
+        if (kb != 0 && rest != 0)
+        {
+            for (size_t s = 1; s < kb; s++)
+            {
+                double* target = A.RowData(r0 + s) + c0 + width;
+                const double* l = A.RowData(r0 + s);
+                for (size_t t = 0; t < s; t++)
+                    if (l[pivots[p0 + t]] != 0)
+                        simd.Axpy(target, -l[pivots[p0 + t]], A.RowData(r0 + t) + c0 + width, rest);
+            }
+
+            if (below != 0)
+            {
+                //The multipliers are scattered across the pivot columns of the panel, so they are gathered into one dense block for the GEMM.
+                scratch.assign(below * kb, 0.0);
+                for (size_t i = 0; i < below; i++)
+                    for (size_t t = 0; t < kb; t++)
+                        scratch[i * kb + t] = A(row + i, pivots[p0 + t]);
+
+                ViewMultiply(A.Block(row, c0 + width, below, rest),
+                             ConstMatrixView(scratch.data(), below, kb, kb),
+                             A.Block(r0, c0 + width, kb, rest),
+                             -1.0, 1.0);
+            }
+
+            for (size_t t = 0; t < kb; t++)
+            {
+                const double* u = A.RowData(r0 + t) + c0 + width;
+                for (size_t j = 0; j < rest; j++)
+                    tolerance.Growth = std::max(tolerance.Growth, std::abs(u[j]));
+            }
+        }
+
+        for (size_t t = 0; t < kb; t++)
+            for (size_t i = r0 + t + 1; i < m; i++)
+                A(i, pivots[p0 + t]) = 0;
+    }
+
+    result.Rank = row;
+    size_t rank = result.Rank;
+
+    for (size_t s = 0; s < rank; s++)
+    {
+        size_t c = pivots[s];
+        double* pivotRow = A.RowData(s);
+        if (c + 1 < n)
+            simd.Divide(pivotRow + c + 1, pivotRow[c], n - c - 1);
+        pivotRow[c] = 1;
+    }
+
+    if (Form != RRF_Reduced)
+        return result;
+
+    /*
+     * Backward elimination, blocked from the bottom. Each block of pivot rows is first reduced against itself, after which
+     * it holds exactly one nonzero (a 1) in each of its pivot columns. Then every row above the block is cleared in those
+     * pivot columns at once: the coefficients are that row's entries in the pivot columns, so the update is a single GEMM.
+     */
+    for (size_t b1 = rank; b1 > 0; )
+    {
+        size_t b0 = b1 > BlockSize ? b1 - BlockSize : 0, kb = b1 - b0;
+
+        for (size_t s = b1; s-- > b0 + 1; )
+        {
+            size_t c = pivots[s];
+            const double* pivotRow = A.RowData(s);
+            for (size_t i = b0; i < s; i++)
+            {
+                double* target = A.RowData(i);
+                double fac = target[c];
+                if (fac == 0)
+                    continue;
+
+                if (c + 1 < n)
+                    simd.Axpy(target + c + 1, -fac, pivotRow + c + 1, n - c - 1);
+                target[c] = 0;
+            }
+        }
+
+        if (b0 != 0)
+        {
+            size_t first = pivots[b0];
+            scratch.assign(b0 * kb, 0.0);
+            for (size_t i = 0; i < b0; i++)
+                for (size_t t = 0; t < kb; t++)
+                    scratch[i * kb + t] = A(i, pivots[b0 + t]);
+
+            ViewMultiply(A.Block(0, first, b0, n - first),
+                         ConstMatrixView(scratch.data(), b0, kb, kb),
+                         A.Block(b0, first, kb, n - first),
+                         -1.0, 1.0);
+
+            for (size_t i = 0; i < b0; i++)
+                for (size_t t = 0; t < kb; t++)
+                    A(i, pivots[b0 + t]) = 0;
+        }
+
+        b1 = b0;
+    }
+
+    return result;
+}
@@ -0,0 +1,44 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_ROWREDUCTION_H
+#define JASON_ROWREDUCTION_H
+
+#include "MatrixView.h"
+
+#include <vector>
+
+/// @brief The form produced by RowReduce.
+enum RowReductionForm
+{
+    RRF_Echelon = 0, //Row echelon form, with every pivot scaled to 1.
+    RRF_Reduced = 1, //Reduced row echelon form, where every pivot column is also zero above its pivot.
+};
+
+/// @brief Describes the result of a row reduction.
+struct EliminationResult
+{
+    /// @brief The number of pivots found, which is the rank of the matrix.
+    size_t Rank = 0;
+    /// @brief The column of each pivot. The pivot of row i (for i < Rank) is in column PivotColumns[i].
+    std::vector<size_t> PivotColumns;
+};
+
+/// @brief Passing this as the tolerance picks max(rows, cols) * epsilon * max(||A||_inf, p * max|U|) for each pivot, where p is
+/// the number of pivots already found and max|U| is the largest entry of U so far, so the threshold follows the growth of elimination.
+/// @details Rank from elimination is still a heuristic: rounding in the input itself can leave a pivot above any threshold.
+/// When the rank must be reliable, use SingularValueDecomposition::Rank instead.
+constexpr double AutomaticTolerance = -1.0;
+
+/// @brief Row reduces the matrix in place, using Gaussian elimination with partial pivoting.
+/// @details Columns are processed in panels. Inside a panel, pivots are chosen and eliminated one column at a time; the
+/// columns to the right of the panel are then updated all at once with a (multithreaded) GEMM, which is where almost all
+/// the work of a large reduction is.
+/// @param A The matrix to reduce. Must have contiguous rows.
+/// @param Form Whether to stop at row echelon form, or continue to reduced row echelon form.
+/// @param Tolerance Any candidate pivot with an absolute value at or below this is treated as zero. Negative values select AutomaticTolerance.
+/// @return The rank and pivot columns.
+EliminationResult RowReduce(MatrixView A, RowReductionForm Form, double Tolerance = AutomaticTolerance);
+
+#endif //JASON_ROWREDUCTION_H
@@ -30,6 +30,18 @@ void Scalar::str_deserialize(std::istream& in)
     
     in >> this->Data;
 }
+size_t Scalar::bin_size() const noexcept
+{
+    return sizeof(double);
+}
+void Scalar::bin_serialize(BinaryWriter& out) const
+{
+    out.Write(this->Data);
+}
+void Scalar::bin_deserialize(BinaryReader& in)
+{
+    this->Data = in.Read<double>();
+}
 
 long long Scalar::ToLongNoRound() const
 {
@@ -8,6 +8,8 @@
 #include "Constraints.h"
 #include "VariableType.h"
 
+#include <cmath>
+
 class Scalar : public VariableType
 {
 public:
@@ -25,6 +27,9 @@ public:
     [[nodiscard]] constexpr VariableTypes GetType() const noexcept override { return VT_Scalar; }
     void str_serialize(std::ostream& out) const noexcept override;
     void str_deserialize(std::istream& in) override;
+    [[nodiscard]] size_t bin_size() const noexcept override;
+    void bin_serialize(BinaryWriter& out) const override;
+    void bin_deserialize(BinaryReader& in) override;
     void dsp_fmt(std::ostream& out) const noexcept override;
     void dbg_fmt(std::ostream& out) const noexcept override;
 
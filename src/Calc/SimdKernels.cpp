@@ -0,0 +1,775 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "SimdKernels.h"
+
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define JASON_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    /*
+     * Portable kernels. These are used directly on targets without a hand written path, and to finish the tail
+     * (the last Count % Width elements) of every vectorized kernel.
+     */
+
+    void PortableAdd(double* X, const double* Y, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] += Y[i];
+    }
+    void PortableSubtract(double* X, const double* Y, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] -= Y[i];
+    }
+    void PortableScale(double* X, double Fac, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] *= Fac;
+    }
+    void PortableDivide(double* X, double Fac, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] /= Fac;
+    }
+    void PortableAxpy(double* Y, double Fac, const double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            Y[i] += Fac * X[i];
+    }
+    double PortableDot(const double* X, const double* Y, size_t Count) noexcept
+    {
+        double result = 0;
+        for (size_t i = 0; i < Count; i++)
+            result += X[i] * Y[i];
+
+        return result;
+    }
+
+    void PortableTranspose4x4(const double* In, size_t LDI, double* Out, size_t LDO) noexcept
+    {
+        for (size_t i = 0; i < 4; i++)
+            for (size_t j = 0; j < 4; j++)
+                Out[j * LDO + i] = In[i * LDI + j];
+    }
+
+    void PortableMultiplyElements(double* X, const double* Y, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] *= Y[i];
+    }
+    void PortableDivideElements(double* X, const double* Y, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] /= Y[i];
+    }
+    void PortableMultiplyAdd(double* Z, const double* X, const double* Y, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            Z[i] += X[i] * Y[i];
+    }
+    void PortableMultiplySubtract(double* Z, const double* X, const double* Y, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            Z[i] -= X[i] * Y[i];
+    }
+    void PortableSqrt(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::sqrt(X[i]);
+    }
+
+    void PortableComplexMultiply(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+        {
+            double re = XRe[i] * YRe[i] - XIm[i] * YIm[i];
+            XIm[i] = XRe[i] * YIm[i] + XIm[i] * YRe[i];
+            XRe[i] = re;
+        }
+    }
+    void PortableComplexDivide(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+        {
+            //x / y = x * conj(y') * s / |y'|^2, with y' = y * s and s = 1 / max(|Re y|, |Im y|).
+            double s = 1.0 / std::fmax(std::fabs(YRe[i]), std::fabs(YIm[i]));
+            double yr = YRe[i] * s, yi = YIm[i] * s;
+            double f = s / (yr * yr + yi * yi);
+            double re = (XRe[i] * yr + XIm[i] * yi) * f;
+            XIm[i] = (XIm[i] * yr - XRe[i] * yi) * f;
+            XRe[i] = re;
+        }
+    }
+    void PortableComplexScale(double* XRe, double* XIm, double FacRe, double FacIm, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+        {
+            double re = XRe[i] * FacRe - XIm[i] * FacIm;
+            XIm[i] = XRe[i] * FacIm + XIm[i] * FacRe;
+            XRe[i] = re;
+        }
+    }
+    void PortableComplexAbs(double* Out, const double* XRe, const double* XIm, size_t Count) noexcept
+    {
+        //re^2 + im^2 overflows past about 1e154 and underflows below about 1e-154, so the SIMD versions compute
+        //m sqrt(1 + (n / m)^2), with m and n the larger and smaller of |re| and |im|, and hypot does the same here.
+        for (size_t i = 0; i < Count; i++)
+            Out[i] = std::hypot(XRe[i], XIm[i]);
+    }
+
+    [[maybe_unused]] constexpr SimdKernelTable PortableTable = {
+        "portable", PortableAdd, PortableSubtract, PortableScale, PortableDivide, PortableAxpy, PortableDot, PortableTranspose4x4,
+        PortableMultiplyElements, PortableDivideElements, PortableMultiplyAdd, PortableMultiplySubtract, PortableSqrt,
+        PortableComplexMultiply, PortableComplexDivide, PortableComplexScale, PortableComplexAbs
+    };
+
+#ifdef JASON_SIMD_X86
+    //SSE2 (x86-64 baseline), 2 doubles per register.
+
+    void Sse2Add(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(X + i, _mm_add_pd(_mm_loadu_pd(X + i), _mm_loadu_pd(Y + i)));
+
+        PortableAdd(X + i, Y + i, Count - i);
+    }
+    void Sse2Subtract(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(X + i, _mm_sub_pd(_mm_loadu_pd(X + i), _mm_loadu_pd(Y + i)));
+
+        PortableSubtract(X + i, Y + i, Count - i);
+    }
+    void Sse2Scale(double* X, double Fac, size_t Count) noexcept
+    {
+        __m128d f = _mm_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(X + i, _mm_mul_pd(_mm_loadu_pd(X + i), f));
+
+        PortableScale(X + i, Fac, Count - i);
+    }
+    void Sse2Divide(double* X, double Fac, size_t Count) noexcept
+    {
+        __m128d f = _mm_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(X + i, _mm_div_pd(_mm_loadu_pd(X + i), f));
+
+        PortableDivide(X + i, Fac, Count - i);
+    }
+    void Sse2Axpy(double* Y, double Fac, const double* X, size_t Count) noexcept
+    {
+        __m128d f = _mm_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(Y + i, _mm_add_pd(_mm_loadu_pd(Y + i), _mm_mul_pd(f, _mm_loadu_pd(X + i))));
+
+        PortableAxpy(Y + i, Fac, X + i, Count - i);
+    }
+    double Sse2Dot(const double* X, const double* Y, size_t Count) noexcept
+    {
+        //Two accumulators hide the add latency.
+        __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(X + i), _mm_loadu_pd(Y + i)));
+            acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(X + i + 2), _mm_loadu_pd(Y + i + 2)));
+        }
+
+        double lanes[2];
+        _mm_storeu_pd(lanes, _mm_add_pd(acc0, acc1));
+        return lanes[0] + lanes[1] + PortableDot(X + i, Y + i, Count - i);
+    }
+
+    void Sse2Transpose4x4(const double* In, size_t LDI, double* Out, size_t LDO) noexcept
+    {
+        //Four independent 2x2 transposes.
+        for (size_t bi = 0; bi < 4; bi += 2)
+        {
+            for (size_t bj = 0; bj < 4; bj += 2)
+            {
+                __m128d r0 = _mm_loadu_pd(In + bi * LDI + bj), r1 = _mm_loadu_pd(In + (bi + 1) * LDI + bj);
+                _mm_storeu_pd(Out + bj * LDO + bi, _mm_unpacklo_pd(r0, r1));
+                _mm_storeu_pd(Out + (bj + 1) * LDO + bi, _mm_unpackhi_pd(r0, r1));
+            }
+        }
+    }
+
+    void Sse2MultiplyElements(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(X + i, _mm_mul_pd(_mm_loadu_pd(X + i), _mm_loadu_pd(Y + i)));
+
+        PortableMultiplyElements(X + i, Y + i, Count - i);
+    }
+    void Sse2DivideElements(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(X + i, _mm_div_pd(_mm_loadu_pd(X + i), _mm_loadu_pd(Y + i)));
+
+        PortableDivideElements(X + i, Y + i, Count - i);
+    }
+    void Sse2MultiplyAdd(double* Z, const double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(Z + i, _mm_add_pd(_mm_loadu_pd(Z + i), _mm_mul_pd(_mm_loadu_pd(X + i), _mm_loadu_pd(Y + i))));
+
+        PortableMultiplyAdd(Z + i, X + i, Y + i, Count - i);
+    }
+    void Sse2MultiplySubtract(double* Z, const double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(Z + i, _mm_sub_pd(_mm_loadu_pd(Z + i), _mm_mul_pd(_mm_loadu_pd(X + i), _mm_loadu_pd(Y + i))));
+
+        PortableMultiplySubtract(Z + i, X + i, Y + i, Count - i);
+    }
+    void Sse2Sqrt(double* X, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+            _mm_storeu_pd(X + i, _mm_sqrt_pd(_mm_loadu_pd(X + i)));
+
+        PortableSqrt(X + i, Count - i);
+    }
+
+    void Sse2ComplexMultiply(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+        {
+            __m128d xr = _mm_loadu_pd(XRe + i), xi = _mm_loadu_pd(XIm + i), yr = _mm_loadu_pd(YRe + i), yi = _mm_loadu_pd(YIm + i);
+            _mm_storeu_pd(XRe + i, _mm_sub_pd(_mm_mul_pd(xr, yr), _mm_mul_pd(xi, yi)));
+            _mm_storeu_pd(XIm + i, _mm_add_pd(_mm_mul_pd(xr, yi), _mm_mul_pd(xi, yr)));
+        }
+
+        PortableComplexMultiply(XRe + i, XIm + i, YRe + i, YIm + i, Count - i);
+    }
+    void Sse2ComplexDivide(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept
+    {
+        const __m128d one = _mm_set1_pd(1.0);
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+        {
+            __m128d xr = _mm_loadu_pd(XRe + i), xi = _mm_loadu_pd(XIm + i), yr = _mm_loadu_pd(YRe + i), yi = _mm_loadu_pd(YIm + i);
+            __m128d s = _mm_div_pd(one, _mm_max_pd(_mm_andnot_pd(_mm_set1_pd(-0.0), yr), _mm_andnot_pd(_mm_set1_pd(-0.0), yi)));
+            yr = _mm_mul_pd(yr, s);
+            yi = _mm_mul_pd(yi, s);
+            __m128d f = _mm_div_pd(s, _mm_add_pd(_mm_mul_pd(yr, yr), _mm_mul_pd(yi, yi)));
+            _mm_storeu_pd(XRe + i, _mm_mul_pd(_mm_add_pd(_mm_mul_pd(xr, yr), _mm_mul_pd(xi, yi)), f));
+            _mm_storeu_pd(XIm + i, _mm_mul_pd(_mm_sub_pd(_mm_mul_pd(xi, yr), _mm_mul_pd(xr, yi)), f));
+        }
+
+        PortableComplexDivide(XRe + i, XIm + i, YRe + i, YIm + i, Count - i);
+    }
+    void Sse2ComplexScale(double* XRe, double* XIm, double FacRe, double FacIm, size_t Count) noexcept
+    {
+        const __m128d fr = _mm_set1_pd(FacRe), fi = _mm_set1_pd(FacIm);
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+        {
+            __m128d xr = _mm_loadu_pd(XRe + i), xi = _mm_loadu_pd(XIm + i);
+            _mm_storeu_pd(XRe + i, _mm_sub_pd(_mm_mul_pd(xr, fr), _mm_mul_pd(xi, fi)));
+            _mm_storeu_pd(XIm + i, _mm_add_pd(_mm_mul_pd(xr, fi), _mm_mul_pd(xi, fr)));
+        }
+
+        PortableComplexScale(XRe + i, XIm + i, FacRe, FacIm, Count - i);
+    }
+    void Sse2ComplexAbs(double* Out, const double* XRe, const double* XIm, size_t Count) noexcept
+    {
+        //Scaled as in PortableComplexAbs.
+        const __m128d sign = _mm_set1_pd(-0.0), one = _mm_set1_pd(1.0), zero = _mm_setzero_pd(), inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+        size_t i = 0;
+        for (; i + 2 <= Count; i += 2)
+        {
+            __m128d a = _mm_andnot_pd(sign, _mm_loadu_pd(XRe + i)), b = _mm_andnot_pd(sign, _mm_loadu_pd(XIm + i));
+            __m128d m = _mm_max_pd(a, b), r = _mm_div_pd(_mm_min_pd(a, b), m);
+            __m128d result = _mm_mul_pd(m, _mm_sqrt_pd(_mm_add_pd(one, _mm_mul_pd(r, r))));
+            result = _mm_andnot_pd(_mm_cmpeq_pd(m, zero), result); //0 / 0 when both parts are zero.
+            result = _mm_add_pd(result, _mm_add_pd(_mm_sub_pd(a, a), _mm_sub_pd(b, b))); //NaN if either part is NaN (or infinite, fixed next).
+            __m128d infinite = _mm_or_pd(_mm_cmpeq_pd(a, inf), _mm_cmpeq_pd(b, inf));
+            _mm_storeu_pd(Out + i, _mm_or_pd(_mm_and_pd(infinite, inf), _mm_andnot_pd(infinite, result)));
+        }
+
+        PortableComplexAbs(Out + i, XRe + i, XIm + i, Count - i);
+    }
+
+    constexpr SimdKernelTable Sse2Table = {
+        "sse2", Sse2Add, Sse2Subtract, Sse2Scale, Sse2Divide, Sse2Axpy, Sse2Dot, Sse2Transpose4x4,
+        Sse2MultiplyElements, Sse2DivideElements, Sse2MultiplyAdd, Sse2MultiplySubtract, Sse2Sqrt,
+        Sse2ComplexMultiply, Sse2ComplexDivide, Sse2ComplexScale, Sse2ComplexAbs
+    };
+
+    //AVX2 + FMA, 4 doubles per register.
+
+    __attribute__((target("avx2,fma"))) void Avx2Add(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(X + i, _mm256_add_pd(_mm256_loadu_pd(X + i), _mm256_loadu_pd(Y + i)));
+
+        PortableAdd(X + i, Y + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2Subtract(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(X + i, _mm256_sub_pd(_mm256_loadu_pd(X + i), _mm256_loadu_pd(Y + i)));
+
+        PortableSubtract(X + i, Y + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2Scale(double* X, double Fac, size_t Count) noexcept
+    {
+        __m256d f = _mm256_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(X + i, _mm256_mul_pd(_mm256_loadu_pd(X + i), f));
+
+        PortableScale(X + i, Fac, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2Divide(double* X, double Fac, size_t Count) noexcept
+    {
+        __m256d f = _mm256_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(X + i, _mm256_div_pd(_mm256_loadu_pd(X + i), f));
+
+        PortableDivide(X + i, Fac, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2Axpy(double* Y, double Fac, const double* X, size_t Count) noexcept
+    {
+        __m256d f = _mm256_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(Y + i, _mm256_fmadd_pd(f, _mm256_loadu_pd(X + i), _mm256_loadu_pd(Y + i)));
+
+        PortableAxpy(Y + i, Fac, X + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) double Avx2Dot(const double* X, const double* Y, size_t Count) noexcept
+    {
+        __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+        {
+            acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(X + i), _mm256_loadu_pd(Y + i), acc0);
+            acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(X + i + 4), _mm256_loadu_pd(Y + i + 4), acc1);
+        }
+
+        double lanes[4];
+        _mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + PortableDot(X + i, Y + i, Count - i);
+    }
+
+    __attribute__((target("avx2,fma"))) void Avx2Transpose4x4(const double* In, size_t LDI, double* Out, size_t LDO) noexcept
+    {
+        __m256d r0 = _mm256_loadu_pd(In), r1 = _mm256_loadu_pd(In + LDI), r2 = _mm256_loadu_pd(In + 2 * LDI), r3 = _mm256_loadu_pd(In + 3 * LDI);
+
+        __m256d t0 = _mm256_unpacklo_pd(r0, r1); //a0 b0 a2 b2
+        __m256d t1 = _mm256_unpackhi_pd(r0, r1); //a1 b1 a3 b3
+        __m256d t2 = _mm256_unpacklo_pd(r2, r3); //c0 d0 c2 d2
+        __m256d t3 = _mm256_unpackhi_pd(r2, r3); //c1 d1 c3 d3
+
+        _mm256_storeu_pd(Out, _mm256_permute2f128_pd(t0, t2, 0x20));
+        _mm256_storeu_pd(Out + LDO, _mm256_permute2f128_pd(t1, t3, 0x20));
+        _mm256_storeu_pd(Out + 2 * LDO, _mm256_permute2f128_pd(t0, t2, 0x31));
+        _mm256_storeu_pd(Out + 3 * LDO, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+
+    __attribute__((target("avx2,fma"))) void Avx2MultiplyElements(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(X + i, _mm256_mul_pd(_mm256_loadu_pd(X + i), _mm256_loadu_pd(Y + i)));
+
+        PortableMultiplyElements(X + i, Y + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2DivideElements(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(X + i, _mm256_div_pd(_mm256_loadu_pd(X + i), _mm256_loadu_pd(Y + i)));
+
+        PortableDivideElements(X + i, Y + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2MultiplyAdd(double* Z, const double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(Z + i, _mm256_fmadd_pd(_mm256_loadu_pd(X + i), _mm256_loadu_pd(Y + i), _mm256_loadu_pd(Z + i)));
+
+        PortableMultiplyAdd(Z + i, X + i, Y + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2MultiplySubtract(double* Z, const double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(Z + i, _mm256_fnmadd_pd(_mm256_loadu_pd(X + i), _mm256_loadu_pd(Y + i), _mm256_loadu_pd(Z + i)));
+
+        PortableMultiplySubtract(Z + i, X + i, Y + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2Sqrt(double* X, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+            _mm256_storeu_pd(X + i, _mm256_sqrt_pd(_mm256_loadu_pd(X + i)));
+
+        PortableSqrt(X + i, Count - i);
+    }
+
+    __attribute__((target("avx2,fma"))) void Avx2ComplexMultiply(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            __m256d xr = _mm256_loadu_pd(XRe + i), xi = _mm256_loadu_pd(XIm + i), yr = _mm256_loadu_pd(YRe + i), yi = _mm256_loadu_pd(YIm + i);
+            _mm256_storeu_pd(XRe + i, _mm256_fmsub_pd(xr, yr, _mm256_mul_pd(xi, yi)));
+            _mm256_storeu_pd(XIm + i, _mm256_fmadd_pd(xr, yi, _mm256_mul_pd(xi, yr)));
+        }
+
+        PortableComplexMultiply(XRe + i, XIm + i, YRe + i, YIm + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2ComplexDivide(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept
+    {
+        const __m256d one = _mm256_set1_pd(1.0), sign = _mm256_set1_pd(-0.0);
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            __m256d xr = _mm256_loadu_pd(XRe + i), xi = _mm256_loadu_pd(XIm + i), yr = _mm256_loadu_pd(YRe + i), yi = _mm256_loadu_pd(YIm + i);
+            __m256d s = _mm256_div_pd(one, _mm256_max_pd(_mm256_andnot_pd(sign, yr), _mm256_andnot_pd(sign, yi)));
+            yr = _mm256_mul_pd(yr, s);
+            yi = _mm256_mul_pd(yi, s);
+            __m256d f = _mm256_div_pd(s, _mm256_fmadd_pd(yr, yr, _mm256_mul_pd(yi, yi)));
+            _mm256_storeu_pd(XRe + i, _mm256_mul_pd(_mm256_fmadd_pd(xr, yr, _mm256_mul_pd(xi, yi)), f));
+            _mm256_storeu_pd(XIm + i, _mm256_mul_pd(_mm256_fmsub_pd(xi, yr, _mm256_mul_pd(xr, yi)), f));
+        }
+
+        PortableComplexDivide(XRe + i, XIm + i, YRe + i, YIm + i, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2ComplexScale(double* XRe, double* XIm, double FacRe, double FacIm, size_t Count) noexcept
+    {
+        const __m256d fr = _mm256_set1_pd(FacRe), fi = _mm256_set1_pd(FacIm);
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            __m256d xr = _mm256_loadu_pd(XRe + i), xi = _mm256_loadu_pd(XIm + i);
+            _mm256_storeu_pd(XRe + i, _mm256_fmsub_pd(xr, fr, _mm256_mul_pd(xi, fi)));
+            _mm256_storeu_pd(XIm + i, _mm256_fmadd_pd(xr, fi, _mm256_mul_pd(xi, fr)));
+        }
+
+        PortableComplexScale(XRe + i, XIm + i, FacRe, FacIm, Count - i);
+    }
+    __attribute__((target("avx2,fma"))) void Avx2ComplexAbs(double* Out, const double* XRe, const double* XIm, size_t Count) noexcept
+    {
+        //Scaled as in PortableComplexAbs.
+        const __m256d sign = _mm256_set1_pd(-0.0), one = _mm256_set1_pd(1.0), zero = _mm256_setzero_pd(), inf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+        size_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            __m256d a = _mm256_andnot_pd(sign, _mm256_loadu_pd(XRe + i)), b = _mm256_andnot_pd(sign, _mm256_loadu_pd(XIm + i));
+            __m256d m = _mm256_max_pd(a, b), r = _mm256_div_pd(_mm256_min_pd(a, b), m);
+            __m256d result = _mm256_mul_pd(m, _mm256_sqrt_pd(_mm256_fmadd_pd(r, r, one)));
+            result = _mm256_andnot_pd(_mm256_cmp_pd(m, zero, _CMP_EQ_OQ), result);
+            result = _mm256_add_pd(result, _mm256_add_pd(_mm256_sub_pd(a, a), _mm256_sub_pd(b, b)));
+            __m256d infinite = _mm256_or_pd(_mm256_cmp_pd(a, inf, _CMP_EQ_OQ), _mm256_cmp_pd(b, inf, _CMP_EQ_OQ));
+            _mm256_storeu_pd(Out + i, _mm256_blendv_pd(result, inf, infinite));
+        }
+
+        PortableComplexAbs(Out + i, XRe + i, XIm + i, Count - i);
+    }
+
+    constexpr SimdKernelTable Avx2Table = {
+        "avx2", Avx2Add, Avx2Subtract, Avx2Scale, Avx2Divide, Avx2Axpy, Avx2Dot, Avx2Transpose4x4,
+        Avx2MultiplyElements, Avx2DivideElements, Avx2MultiplyAdd, Avx2MultiplySubtract, Avx2Sqrt,
+        Avx2ComplexMultiply, Avx2ComplexDivide, Avx2ComplexScale, Avx2ComplexAbs
+    };
+
+#if !defined(__clang__)
+#pragma GCC diagnostic push
+//GCC 12's avx512fintrin.h starts reductions, sqrt, max and min from _mm512_undefined_pd, which -Wall reports as uninitialized.
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+    //AVX-512F, 8 doubles per register. The tail is handled with a mask instead of the portable loop.
+
+    __attribute__((target("avx512f"))) void Avx512Add(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(X + i, _mm512_add_pd(_mm512_loadu_pd(X + i), _mm512_loadu_pd(Y + i)));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(X + i, m, _mm512_add_pd(_mm512_maskz_loadu_pd(m, X + i), _mm512_maskz_loadu_pd(m, Y + i)));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512Subtract(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(X + i, _mm512_sub_pd(_mm512_loadu_pd(X + i), _mm512_loadu_pd(Y + i)));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(X + i, m, _mm512_sub_pd(_mm512_maskz_loadu_pd(m, X + i), _mm512_maskz_loadu_pd(m, Y + i)));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512Scale(double* X, double Fac, size_t Count) noexcept
+    {
+        __m512d f = _mm512_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(X + i, _mm512_mul_pd(_mm512_loadu_pd(X + i), f));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(X + i, m, _mm512_mul_pd(_mm512_maskz_loadu_pd(m, X + i), f));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512Divide(double* X, double Fac, size_t Count) noexcept
+    {
+        __m512d f = _mm512_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(X + i, _mm512_div_pd(_mm512_loadu_pd(X + i), f));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(X + i, m, _mm512_div_pd(_mm512_maskz_loadu_pd(m, X + i), f));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512Axpy(double* Y, double Fac, const double* X, size_t Count) noexcept
+    {
+        __m512d f = _mm512_set1_pd(Fac);
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(Y + i, _mm512_fmadd_pd(f, _mm512_loadu_pd(X + i), _mm512_loadu_pd(Y + i)));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(Y + i, m, _mm512_fmadd_pd(f, _mm512_maskz_loadu_pd(m, X + i), _mm512_maskz_loadu_pd(m, Y + i)));
+        }
+    }
+    __attribute__((target("avx512f"))) double Avx512Dot(const double* X, const double* Y, size_t Count) noexcept
+    {
+        __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd();
+        size_t i = 0;
+        for (; i + 16 <= Count; i += 16)
+        {
+            acc0 = _mm512_fmadd_pd(_mm512_loadu_pd(X + i), _mm512_loadu_pd(Y + i), acc0);
+            acc1 = _mm512_fmadd_pd(_mm512_loadu_pd(X + i + 8), _mm512_loadu_pd(Y + i + 8), acc1);
+        }
+        for (; i < Count; i += 8)
+        {
+            size_t left = Count - i;
+            __mmask8 m = left >= 8 ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << left) - 1);
+            acc0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, X + i), _mm512_maskz_loadu_pd(m, Y + i), acc0);
+        }
+
+        return _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1));
+    }
+
+    __attribute__((target("avx512f"))) void Avx512MultiplyElements(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(X + i, _mm512_mul_pd(_mm512_loadu_pd(X + i), _mm512_loadu_pd(Y + i)));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(X + i, m, _mm512_mul_pd(_mm512_maskz_loadu_pd(m, X + i), _mm512_maskz_loadu_pd(m, Y + i)));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512DivideElements(double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(X + i, _mm512_div_pd(_mm512_loadu_pd(X + i), _mm512_loadu_pd(Y + i)));
+
+        if (i < Count)
+        {
+            //The masked divide skips the lanes past the end, which would otherwise divide 0 by 0.
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(X + i, m, _mm512_maskz_div_pd(m, _mm512_maskz_loadu_pd(m, X + i), _mm512_maskz_loadu_pd(m, Y + i)));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512MultiplyAdd(double* Z, const double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(Z + i, _mm512_fmadd_pd(_mm512_loadu_pd(X + i), _mm512_loadu_pd(Y + i), _mm512_loadu_pd(Z + i)));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(Z + i, m, _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, X + i), _mm512_maskz_loadu_pd(m, Y + i), _mm512_maskz_loadu_pd(m, Z + i)));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512MultiplySubtract(double* Z, const double* X, const double* Y, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(Z + i, _mm512_fnmadd_pd(_mm512_loadu_pd(X + i), _mm512_loadu_pd(Y + i), _mm512_loadu_pd(Z + i)));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(Z + i, m, _mm512_fnmadd_pd(_mm512_maskz_loadu_pd(m, X + i), _mm512_maskz_loadu_pd(m, Y + i), _mm512_maskz_loadu_pd(m, Z + i)));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512Sqrt(double* X, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(X + i, _mm512_sqrt_pd(_mm512_loadu_pd(X + i)));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(X + i, m, _mm512_sqrt_pd(_mm512_maskz_loadu_pd(m, X + i)));
+        }
+    }
+
+    __attribute__((target("avx512f"))) void Avx512ComplexMultiply(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+        {
+            __m512d xr = _mm512_loadu_pd(XRe + i), xi = _mm512_loadu_pd(XIm + i), yr = _mm512_loadu_pd(YRe + i), yi = _mm512_loadu_pd(YIm + i);
+            _mm512_storeu_pd(XRe + i, _mm512_fmsub_pd(xr, yr, _mm512_mul_pd(xi, yi)));
+            _mm512_storeu_pd(XIm + i, _mm512_fmadd_pd(xr, yi, _mm512_mul_pd(xi, yr)));
+        }
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            __m512d xr = _mm512_maskz_loadu_pd(m, XRe + i), xi = _mm512_maskz_loadu_pd(m, XIm + i), yr = _mm512_maskz_loadu_pd(m, YRe + i), yi = _mm512_maskz_loadu_pd(m, YIm + i);
+            _mm512_mask_storeu_pd(XRe + i, m, _mm512_fmsub_pd(xr, yr, _mm512_mul_pd(xi, yi)));
+            _mm512_mask_storeu_pd(XIm + i, m, _mm512_fmadd_pd(xr, yi, _mm512_mul_pd(xi, yr)));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512ComplexDivide(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept
+    {
+        const __m512d one = _mm512_set1_pd(1.0);
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+        {
+            __m512d xr = _mm512_loadu_pd(XRe + i), xi = _mm512_loadu_pd(XIm + i), yr = _mm512_loadu_pd(YRe + i), yi = _mm512_loadu_pd(YIm + i);
+            __m512d s = _mm512_div_pd(one, _mm512_max_pd(_mm512_abs_pd(yr), _mm512_abs_pd(yi)));
+            yr = _mm512_mul_pd(yr, s);
+            yi = _mm512_mul_pd(yi, s);
+            __m512d f = _mm512_div_pd(s, _mm512_fmadd_pd(yr, yr, _mm512_mul_pd(yi, yi)));
+            _mm512_storeu_pd(XRe + i, _mm512_mul_pd(_mm512_fmadd_pd(xr, yr, _mm512_mul_pd(xi, yi)), f));
+            _mm512_storeu_pd(XIm + i, _mm512_mul_pd(_mm512_fmsub_pd(xi, yr, _mm512_mul_pd(xr, yi)), f));
+        }
+
+        if (i < Count)
+        {
+            //As in Avx512DivideElements, the masked divides keep the unused lanes from dividing by zero.
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            __m512d xr = _mm512_maskz_loadu_pd(m, XRe + i), xi = _mm512_maskz_loadu_pd(m, XIm + i), yr = _mm512_maskz_loadu_pd(m, YRe + i), yi = _mm512_maskz_loadu_pd(m, YIm + i);
+            __m512d s = _mm512_maskz_div_pd(m, one, _mm512_max_pd(_mm512_abs_pd(yr), _mm512_abs_pd(yi)));
+            yr = _mm512_mul_pd(yr, s);
+            yi = _mm512_mul_pd(yi, s);
+            __m512d f = _mm512_maskz_div_pd(m, s, _mm512_fmadd_pd(yr, yr, _mm512_mul_pd(yi, yi)));
+            _mm512_mask_storeu_pd(XRe + i, m, _mm512_mul_pd(_mm512_fmadd_pd(xr, yr, _mm512_mul_pd(xi, yi)), f));
+            _mm512_mask_storeu_pd(XIm + i, m, _mm512_mul_pd(_mm512_fmsub_pd(xi, yr, _mm512_mul_pd(xr, yi)), f));
+        }
+    }
+    __attribute__((target("avx512f"))) void Avx512ComplexScale(double* XRe, double* XIm, double FacRe, double FacIm, size_t Count) noexcept
+    {
+        const __m512d fr = _mm512_set1_pd(FacRe), fi = _mm512_set1_pd(FacIm);
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+        {
+            __m512d xr = _mm512_loadu_pd(XRe + i), xi = _mm512_loadu_pd(XIm + i);
+            _mm512_storeu_pd(XRe + i, _mm512_fmsub_pd(xr, fr, _mm512_mul_pd(xi, fi)));
+            _mm512_storeu_pd(XIm + i, _mm512_fmadd_pd(xr, fi, _mm512_mul_pd(xi, fr)));
+        }
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            __m512d xr = _mm512_maskz_loadu_pd(m, XRe + i), xi = _mm512_maskz_loadu_pd(m, XIm + i);
+            _mm512_mask_storeu_pd(XRe + i, m, _mm512_fmsub_pd(xr, fr, _mm512_mul_pd(xi, fi)));
+            _mm512_mask_storeu_pd(XIm + i, m, _mm512_fmadd_pd(xr, fi, _mm512_mul_pd(xi, fr)));
+        }
+    }
+    /// |x| for 8 lanes, scaled as in PortableComplexAbs.
+    __attribute__((target("avx512f"))) __m512d Avx512Hypot(__m512d XRe, __m512d XIm) noexcept
+    {
+        const __m512d one = _mm512_set1_pd(1.0), inf = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+        __m512d a = _mm512_abs_pd(XRe), b = _mm512_abs_pd(XIm);
+        __m512d m = _mm512_max_pd(a, b);
+        __m512d r = _mm512_maskz_div_pd(_mm512_cmp_pd_mask(m, _mm512_setzero_pd(), _CMP_NEQ_UQ), _mm512_min_pd(a, b), m); //Zero, rather than 0 / 0, when both parts are zero.
+        __m512d result = _mm512_mul_pd(m, _mm512_sqrt_pd(_mm512_fmadd_pd(r, r, one)));
+        result = _mm512_add_pd(result, _mm512_add_pd(_mm512_sub_pd(a, a), _mm512_sub_pd(b, b)));
+        __mmask8 infinite = _mm512_cmp_pd_mask(a, inf, _CMP_EQ_OQ) | _mm512_cmp_pd_mask(b, inf, _CMP_EQ_OQ);
+        return _mm512_mask_blend_pd(infinite, result, inf);
+    }
+    __attribute__((target("avx512f"))) void Avx512ComplexAbs(double* Out, const double* XRe, const double* XIm, size_t Count) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= Count; i += 8)
+            _mm512_storeu_pd(Out + i, Avx512Hypot(_mm512_loadu_pd(XRe + i), _mm512_loadu_pd(XIm + i)));
+
+        if (i < Count)
+        {
+            __mmask8 m = static_cast<__mmask8>((1u << (Count - i)) - 1);
+            _mm512_mask_storeu_pd(Out + i, m, Avx512Hypot(_mm512_maskz_loadu_pd(m, XRe + i), _mm512_maskz_loadu_pd(m, XIm + i)));
+        }
+    }
+
+    //A 4x4 block is a full AVX2 register per row, so the AVX-512 table reuses that shuffle.
+    constexpr SimdKernelTable Avx512Table = {
+        "avx512", Avx512Add, Avx512Subtract, Avx512Scale, Avx512Divide, Avx512Axpy, Avx512Dot, Avx2Transpose4x4,
+        Avx512MultiplyElements, Avx512DivideElements, Avx512MultiplyAdd, Avx512MultiplySubtract, Avx512Sqrt,
+        Avx512ComplexMultiply, Avx512ComplexDivide, Avx512ComplexScale, Avx512ComplexAbs
+    };
+#if !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+    const SimdKernelTable& SelectKernels() noexcept
+    {
+#ifdef JASON_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return Avx512Table;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return Avx2Table;
+
+        return Sse2Table;
+#else
+        return PortableTable;
+#endif
+    }
+}
+
+const SimdKernelTable& SimdKernels() noexcept
+{
+    static const SimdKernelTable& table = SelectKernels();
+    return table;
+}
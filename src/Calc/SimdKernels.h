@@ -0,0 +1,71 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_SIMDKERNELS_H
+#define JASON_SIMDKERNELS_H
+
+#include <cstddef>
+
+/*
+ * SIMD KERNELS
+ *
+ * Element-wise kernels over contiguous arrays of doubles, used by Matrix and MathVector arithmetic.
+ *
+ * The best implementation for the running CPU is picked once, the first time SimdKernels() is called:
+ *  - x86-64: AVX-512F, then AVX2 + FMA, then the SSE2 baseline.
+ *  - Other targets: portable loops, left to the compiler to vectorize.
+ *
+ * None of the kernels allocate or check bounds; the caller is responsible for passing matching lengths.
+ * Input and output arrays may be the same array, but must not otherwise overlap.
+ */
+
+struct SimdKernelTable
+{
+    /// @brief The name of the instruction set the table was built for.
+    const char* Name;
+
+    /// @brief X[i] += Y[i]
+    void (*Add)(double* X, const double* Y, size_t Count) noexcept;
+    /// @brief X[i] -= Y[i]
+    void (*Subtract)(double* X, const double* Y, size_t Count) noexcept;
+    /// @brief X[i] *= Fac
+    void (*Scale)(double* X, double Fac, size_t Count) noexcept;
+    /// @brief X[i] /= Fac
+    void (*Divide)(double* X, double Fac, size_t Count) noexcept;
+    /// @brief Y[i] += Fac * X[i]
+    void (*Axpy)(double* Y, double Fac, const double* X, size_t Count) noexcept;
+    /// @brief Returns the sum of X[i] * Y[i]
+    double (*Dot)(const double* X, const double* Y, size_t Count) noexcept;
+    /// @brief Writes the transpose of the 4x4 block at In (row stride LDI) to Out (row stride LDO), using in-register shuffles.
+    void (*Transpose4x4)(const double* In, size_t LDI, double* Out, size_t LDO) noexcept;
+
+    //Element by element products, for structure of arrays data where each array holds one component of many vectors.
+
+    /// @brief X[i] *= Y[i]
+    void (*MultiplyElements)(double* X, const double* Y, size_t Count) noexcept;
+    /// @brief X[i] /= Y[i]
+    void (*DivideElements)(double* X, const double* Y, size_t Count) noexcept;
+    /// @brief Z[i] += X[i] * Y[i]
+    void (*MultiplyAdd)(double* Z, const double* X, const double* Y, size_t Count) noexcept;
+    /// @brief Z[i] -= X[i] * Y[i]
+    void (*MultiplySubtract)(double* Z, const double* X, const double* Y, size_t Count) noexcept;
+    /// @brief X[i] = sqrt(X[i])
+    void (*Sqrt)(double* X, size_t Count) noexcept;
+
+    //Complex arithmetic on split storage, where the real and imaginary parts of X[i] are XRe[i] and XIm[i].
+
+    /// @brief X[i] *= Y[i]
+    void (*ComplexMultiply)(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept;
+    /// @brief X[i] /= Y[i]. Y[i] is scaled by its largest part first, so |Y[i]|^2 cannot overflow or underflow. Dividing by zero gives NaN.
+    void (*ComplexDivide)(double* XRe, double* XIm, const double* YRe, const double* YIm, size_t Count) noexcept;
+    /// @brief X[i] *= (FacRe + FacIm i)
+    void (*ComplexScale)(double* XRe, double* XIm, double FacRe, double FacIm, size_t Count) noexcept;
+    /// @brief Out[i] = |X[i]|, computed from the larger part as hypot is, so that it cannot overflow or underflow early.
+    void (*ComplexAbs)(double* Out, const double* XRe, const double* XIm, size_t Count) noexcept;
+};
+
+/// @brief Returns the kernel table for the instruction set of the running CPU.
+[[nodiscard]] const SimdKernelTable& SimdKernels() noexcept;
+
+#endif //JASON_SIMDKERNELS_H
@@ -0,0 +1,348 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "SingularValueDecomposition.h"
+#include "Householder.h"
+#include "Tridiagonal.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    //The number of reflector pairs generated before the trailing submatrix is updated with GEMMs.
+    constexpr size_t BlockSize = 32;
+    //Singular values closer together than this (relative to the largest) have their vectors reorthogonalized. Matches the eigensolver's clustering.
+    constexpr double ClusterTolerance = 1e-3;
+
+    /// @brief Reduces A (m x n, m >= n) to upper bidiagonal form B = Q^T A P.
+    /// @details Left reflector j is stored in column j below the diagonal, and right reflector j in row j to the right of the superdiagonal.
+    void Bidiagonalize(Matrix& A, std::vector<double>& Diagonal, std::vector<double>& SuperDiagonal, std::vector<double>& TauQ, std::vector<double>& TauP)
+    {
+        size_t m = A.Rows(), n = A.Columns(), ld = A.LeadingDimension();
+        const auto& simd = SimdKernels();
+        Diagonal.assign(n, 0.0);
+        SuperDiagonal.assign(n - 1, 0.0);
+        TauQ.assign(n, 0.0);
+        TauP.assign(n - 1, 0.0);
+
+        /*
+         * Blocked reduction. As in the tridiagonal reduction, the reflectors of a panel are not applied to the trailing matrix
+         * as they are generated. The trailing matrix is kept as A - V Y^T - X U^T, where V and U are the left and right
+         * reflectors and Y and X record their effect. Each row and column is brought up to date just before its reflector is
+         * generated, and the whole update is applied with two GEMMs at the end of the panel.
+         */
+        Matrix Vt(BlockSize, m), Xt(BlockSize, m), Ut(BlockSize, n), Yt(BlockSize, n);
+        std::vector<double> column(m);
+
+        for (size_t k0 = 0; k0 < n; k0 += BlockSize)
+        {
+            size_t nb = std::min(BlockSize, n - k0), next = k0 + nb;
+
+            for (size_t i = 0; i < nb; i++)
+            {
+                size_t c = k0 + i, height = m - c, width = n - c - 1;
+                double* v = Vt.RowData(i);
+                double* x = Xt.RowData(i);
+                double* u = Ut.RowData(i);
+                double* y = Yt.RowData(i);
+                std::fill(x, x + m, 0.0);
+                std::fill(u, u + n, 0.0);
+                std::fill(y, y + n, 0.0);
+
+                //Bring column c up to date, then zero it below the diagonal.
+                for (size_t r = 0; r < height; r++)
+                    column[r] = A.RowData(c + r)[c];
+                for (size_t s = 0; s < i; s++)
+                {
+                    simd.Axpy(column.data(), -Yt.RowData(s)[c], Vt.RowData(s) + c, height);
+                    simd.Axpy(column.data(), -Ut.RowData(s)[c], Xt.RowData(s) + c, height);
+                }
+                for (size_t r = 0; r < height; r++)
+                    A.RowData(c + r)[c] = column[r];
+
+                double* diag = A.RowData(c) + c;
+                double tauq = TauQ[c] = GenerateReflector(*diag, diag + ld, height - 1, ld);
+                Diagonal[c] = *diag;
+
+                std::fill(v, v + c, 0.0);
+                v[c] = 1;
+                for (size_t r = c + 1; r < m; r++)
+                    v[r] = A.RowData(r)[c];
+
+                if (width == 0)
+                    break;
+
+                //y = tauq (A - V Y^T - X U^T)^T v over the columns after c. A^T v is accumulated one row of A at a time.
+                double* yr = y + c + 1;
+                if (tauq != 0)
+                {
+                    for (size_t r = c; r < m; r++)
+                        simd.Axpy(yr, v[r], A.RowData(r) + c + 1, width);
+                    for (size_t s = 0; s < i; s++)
+                    {
+                        simd.Axpy(yr, -simd.Dot(Vt.RowData(s) + c, v + c, height), Yt.RowData(s) + c + 1, width);
+                        simd.Axpy(yr, -simd.Dot(Xt.RowData(s) + c, v + c, height), Ut.RowData(s) + c + 1, width);
+                    }
+                    simd.Scale(yr, tauq, width);
+                }
+
+                //Bring row c up to date (including the left reflector just generated), then zero it past the superdiagonal.
+                double* row = A.RowData(c) + c + 1;
+                for (size_t s = 0; s <= i; s++)
+                    simd.Axpy(row, -Vt.RowData(s)[c], Yt.RowData(s) + c + 1, width);
+                for (size_t s = 0; s < i; s++)
+                    simd.Axpy(row, -Xt.RowData(s)[c], Ut.RowData(s) + c + 1, width);
+
+                double taup = TauP[c] = GenerateReflector(row[0], row + 1, width - 1, 1);
+                SuperDiagonal[c] = row[0];
+
+                u[c + 1] = 1;
+                std::copy_n(row + 1, width - 1, u + c + 2);
+
+                if (taup == 0)
+                    continue;
+
+                //x = taup (A - V Y^T - X U^T) u over the rows after c.
+                double* ur = u + c + 1;
+                double* xr = x + c + 1;
+                size_t below = height - 1;
+                for (size_t r = c + 1; r < m; r++)
+                    x[r] = simd.Dot(A.RowData(r) + c + 1, ur, width);
+                for (size_t s = 0; s <= i; s++)
+                    simd.Axpy(xr, -simd.Dot(Yt.RowData(s) + c + 1, ur, width), Vt.RowData(s) + c + 1, below);
+                for (size_t s = 0; s < i; s++)
+                    simd.Axpy(xr, -simd.Dot(Ut.RowData(s) + c + 1, ur, width), Xt.RowData(s) + c + 1, below);
+                simd.Scale(xr, taup, below);
+            }
+
+            if (next < n)
+            {
+                MatrixView target = A.Block(next, next, m - next, n - next);
+                ViewMultiply(target, Vt.Block(0, next, nb, m - next).Transposed(), Yt.Block(0, next, nb, n - next), -1.0, 1.0);
+                ViewMultiply(target, Xt.Block(0, next, nb, m - next).Transposed(), Ut.Block(0, next, nb, n - next), -1.0, 1.0);
+            }
+        }
+    }
+
+    /// @brief Overwrites Z with R Z, where R = H_0 H_1 ... is the product of the reflectors stored in the columns of Packed, starting Offset rows below the diagonal.
+    void ApplyReflectors(ConstMatrixView Packed, const std::vector<double>& Tau, size_t Offset, Matrix& Z)
+    {
+        size_t n = Packed.Rows(), count = Tau.size(), k = Z.Columns();
+        for (size_t b = (count + BlockSize - 1) / BlockSize; b-- > 0; )
+        {
+            size_t s = b * BlockSize, w = std::min(BlockSize, count - s);
+            Matrix V = GatherReflectors(Packed, s, w, Offset);
+            ApplyReflectorBlock(V, ReflectorBlockT(V, Tau.data() + s), Z.Block(s + Offset, 0, n - s - Offset, k), false);
+        }
+    }
+
+    /// @brief Replaces the columns of Vectors flagged in Missing with unit vectors orthogonal to every other column.
+    /// @details Each one starts from the coordinate vector with the largest component outside the span of the others, which is at least 1/n of its length.
+    void CompleteOrthonormal(Matrix& Vectors, const std::vector<char>& Missing)
+    {
+        size_t n = Vectors.Rows(), k = Vectors.Columns();
+        const auto& simd = SimdKernels();
+
+        //Work on the transpose, so that every vector is contiguous.
+        Matrix Wt = Vectors.Transpose();
+        std::vector<double> outside(n, 1.0);
+        std::vector<size_t> basis;
+        for (size_t j = 0; j < k; j++)
+        {
+            if (Missing[j])
+                continue;
+
+            basis.push_back(j);
+            for (size_t i = 0; i < n; i++)
+                outside[i] -= Wt.RowData(j)[i] * Wt.RowData(j)[i];
+        }
+
+        for (size_t j = 0; j < k; j++)
+        {
+            if (!Missing[j])
+                continue;
+
+            double* w = Wt.RowData(j);
+            std::fill(w, w + n, 0.0);
+            w[std::max_element(outside.begin(), outside.end()) - outside.begin()] = 1;
+
+            //Gram-Schmidt, twice, which is enough to make the result orthogonal to working precision.
+            for (int pass = 0; pass < 2; pass++)
+                for (size_t b : basis)
+                    simd.Axpy(w, -simd.Dot(w, Wt.RowData(b), n), Wt.RowData(b), n);
+
+            simd.Divide(w, std::sqrt(simd.Dot(w, w, n)), n);
+            basis.push_back(j);
+            for (size_t i = 0; i < n; i++)
+                outside[i] -= w[i] * w[i];
+        }
+
+        Vectors = Wt.Transpose();
+    }
+}
+
+SingularValueDecomposition::SingularValueDecomposition(const Matrix& A, const SpectralOptions& Options) :
+    rows(A.Rows()), cols(A.Columns()), LeftVectors(Matrix::ErrorMatrix()), RightVectors(Matrix::ErrorMatrix())
+{
+    if (!A.IsValid())
+        throw OperationError("singular value decomposition", "empty matrix");
+    if (Options.Count > std::min(rows, cols))
+        throw OperationError("singular value decomposition", "more singular values were requested than the matrix has");
+
+    Compute(A, Options);
+}
+
+void SingularValueDecomposition::Compute(const Matrix& Input, const SpectralOptions& Options)
+{
+    //A wide matrix is decomposed through its transpose, A^T = V S U^T, so that the reduction always works on a tall matrix.
+    bool transposed = rows < cols;
+    Matrix A = transposed ? Input.Transpose() : Input;
+    size_t m = A.Rows(), n = A.Columns(), count = Options.Count == 0 ? n : Options.Count;
+
+    std::vector<double> diagonal, superDiagonal, tauQ, tauP;
+    Bidiagonalize(A, diagonal, superDiagonal, tauQ, tauP);
+
+    /*
+     * The Golub-Kahan matrix has a zero diagonal, and d_0, e_0, d_1, e_1, ..., d_(n-1) beside it. Its eigenvalues are the
+     * singular values of B and their negatives, and the eigenvector of sigma is (v_0, u_0, v_1, u_1, ...) / sqrt(2), where
+     * B v = sigma u. The n largest eigenvalues are exactly the singular values.
+     */
+    std::vector<double> zeros(2 * n, 0.0), coupling(2 * n - 1);
+    for (size_t i = 0; i < n; i++)
+    {
+        coupling[2 * i] = diagonal[i];
+        if (i + 1 < n)
+            coupling[2 * i + 1] = superDiagonal[i];
+    }
+
+    Matrix Z = Matrix::ErrorMatrix();
+    std::vector<double> eigenvalues = TridiagonalEigen(zeros, coupling, 2 * n - count, count, Options.ComputeVectors ? &Z : nullptr);
+
+    Values.resize(count);
+    for (size_t j = 0; j < count; j++)
+        Values[j] = std::abs(eigenvalues[count - 1 - j]);
+
+    if (Options.ComputeVectors)
+    {
+        /*
+         * Split each eigenvector into its u and v halves, which are each normalized on their own. That also repairs any
+         * mixing with the eigenvector of -sigma (which is (v, -u)), as long as both halves survive. When one half is much
+         * shorter than the other, it is rebuilt from the longer one through B. Singular values that are zero (to working
+         * precision) have no such relation, so their vectors are instead completed to an orthonormal set.
+         *
+         * Within a cluster of close singular values, the eigensolver only keeps the whole vectors orthogonal, not their
+         * halves, so the halves are reorthogonalized against the rest of their cluster. The vectors of a tight cluster are
+         * only determined up to a rotation within it anyway, so this costs nothing in accuracy.
+         */
+        const auto& simd = SimdKernels();
+        double zero = static_cast<double>(std::max(m, n)) * std::numeric_limits<double>::epsilon() * Values.front();
+        Matrix Ut(count, m), Vt(count, n);
+        std::vector<char> missing(count, 0);
+        size_t clusterStart = 0;
+
+        auto reorthogonalize = [&](Matrix& Set, size_t j, size_t From)
+        {
+            double* w = Set.RowData(j);
+            for (int pass = 0; pass < 2; pass++)
+                for (size_t p = From; p < j; p++)
+                    if (!missing[p])
+                        simd.Axpy(w, -simd.Dot(w, Set.RowData(p), n), Set.RowData(p), n);
+
+            simd.Divide(w, std::sqrt(simd.Dot(w, w, n)), n);
+        };
+
+        for (size_t j = 0; j < count; j++)
+        {
+            if (j > 0 && Values[j - 1] - Values[j] > ClusterTolerance * Values.front())
+                clusterStart = j;
+
+            size_t source = count - 1 - j;
+            double sigma = Values[j];
+            double* u = Ut.RowData(j);
+            double* v = Vt.RowData(j);
+            for (size_t i = 0; i < n; i++)
+            {
+                v[i] = Z.RowData(2 * i)[source];
+                u[i] = Z.RowData(2 * i + 1)[source];
+            }
+
+            if (sigma <= zero)
+            {
+                missing[j] = 1;
+                continue;
+            }
+
+            double lengthU = std::sqrt(simd.Dot(u, u, n)), lengthV = std::sqrt(simd.Dot(v, v, n));
+            if (lengthU < 0.5 * lengthV)
+            {
+                //u = B v / sigma, up to scale, since both halves are normalized below.
+                for (size_t i = 0; i < n; i++)
+                    u[i] = diagonal[i] * v[i] + (i + 1 < n ? superDiagonal[i] * v[i + 1] : 0.0);
+            }
+            else if (lengthV < 0.5 * lengthU)
+            {
+                //v = B^T u / sigma, up to scale.
+                for (size_t i = 0; i < n; i++)
+                    v[i] = diagonal[i] * u[i] + (i > 0 ? superDiagonal[i - 1] * u[i - 1] : 0.0);
+            }
+
+            //Also normalizes both halves.
+            reorthogonalize(Ut, j, clusterStart);
+            reorthogonalize(Vt, j, clusterStart);
+        }
+
+        //The left vectors of B live in the first n rows of U; the rows of Ut past n stay zero.
+        Matrix left = Ut.Transpose(), right = Vt.Transpose();
+        if (std::find(missing.begin(), missing.end(), 1) != missing.end())
+        {
+            Matrix top = left.Extract(0, 0, n, count);
+            CompleteOrthonormal(top, missing);
+            CompleteOrthonormal(right, missing);
+            ViewCopy(left.Block(0, 0, n, count), top.View());
+        }
+
+        ApplyReflectors(A.View(), tauQ, 0, left);
+        ApplyReflectors(A.View().Transposed(), tauP, 1, right);
+
+        LeftVectors = transposed ? std::move(right) : std::move(left);
+        RightVectors = transposed ? std::move(left) : std::move(right);
+    }
+}
+
+double SingularValueDecomposition::ConditionNumber() const
+{
+    if (Size() != std::min(rows, cols))
+        throw OperationError("condition number", "every singular value is required");
+
+    if (Values.back() == 0)
+        return std::numeric_limits<double>::infinity();
+
+    return Values.front() / Values.back();
+}
+size_t SingularValueDecomposition::Rank(double Tolerance) const noexcept
+{
+    if (Tolerance < 0)
+        Tolerance = static_cast<double>(std::max(rows, cols)) * std::numeric_limits<double>::epsilon() * Values.front();
+
+    return static_cast<size_t>(std::count_if(Values.begin(), Values.end(), [Tolerance](double x) { return x > Tolerance; }));
+}
+
+Matrix SingularValueDecomposition::Scores() const
+{
+    if (!HasSingularVectors())
+        throw OperationError("principal component scores", "the singular vectors were not computed");
+
+    Matrix result(LeftVectors);
+    for (size_t i = 0; i < result.Rows(); i++)
+    {
+        double* row = result.RowData(i);
+        for (size_t j = 0; j < Size(); j++)
+            row[j] *= Values[j];
+    }
+
+    return result;
+}
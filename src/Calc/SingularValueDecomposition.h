@@ -0,0 +1,72 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_SINGULARVALUEDECOMPOSITION_H
+#define JASON_SINGULARVALUEDECOMPOSITION_H
+
+#include "Matrix.h"
+#include "SymmetricEigen.h"
+
+#include <vector>
+
+/// <summary>
+/// The decomposition A = U * diag(Values) * V^T of an m x n matrix, where the k = min(m, n) singular values are non-negative and descending, and the columns of U (m x k) and V (n x k) are orthonormal.
+/// The matrix is reduced to bidiagonal form B with blocked Householder reflectors. The singular values and vectors of B then come from the symmetric tridiagonal eigensolver, applied to the 2k x 2k Golub-Kahan matrix [0 B^T; B 0] with its rows interleaved, whose positive eigenvalues are the singular values of B.
+/// For principal component analysis, decompose the centered data matrix (one observation per row): the columns of V are the principal axes, the squared singular values are proportional to the variance along each, and Scores() gives the coordinates of each observation.
+/// </summary>
+class SingularValueDecomposition
+{
+private:
+    size_t rows;
+    size_t cols;
+    std::vector<double> Values;
+    Matrix LeftVectors;
+    Matrix RightVectors;
+
+    void Compute(const Matrix& A, const SpectralOptions& Options);
+
+public:
+    /// <summary>
+    /// Decomposes the matrix. Throws if the matrix is empty, or if Options asks for more values than min(m, n).
+    /// </summary>
+    explicit SingularValueDecomposition(const Matrix& A, const SpectralOptions& Options = {});
+
+    [[nodiscard]] size_t Rows() const noexcept { return rows; }
+    [[nodiscard]] size_t Columns() const noexcept { return cols; }
+    /// <summary>
+    /// The number of singular values computed, which is min(m, n) unless SpectralOptions::Count limited it.
+    /// </summary>
+    [[nodiscard]] size_t Size() const noexcept { return Values.size(); }
+    [[nodiscard]] bool HasSingularVectors() const noexcept { return LeftVectors.IsValid(); }
+
+    [[nodiscard]] const std::vector<double>& SingularValues() const noexcept { return Values; }
+    /// <summary>
+    /// The left singular vectors, as columns. Empty if they were not computed.
+    /// </summary>
+    [[nodiscard]] const Matrix& U() const noexcept { return LeftVectors; }
+    /// <summary>
+    /// The right singular vectors, as columns. Empty if they were not computed.
+    /// </summary>
+    [[nodiscard]] const Matrix& V() const noexcept { return RightVectors; }
+
+    /// <summary>
+    /// The spectral norm (the largest singular value), which is the most any vector can be stretched by the matrix.
+    /// </summary>
+    [[nodiscard]] double Norm() const noexcept { return Values.front(); }
+    /// <summary>
+    /// The 2-norm condition number, largest over smallest singular value. Infinite for a rank deficient matrix. Throws unless every singular value was computed.
+    /// </summary>
+    [[nodiscard]] double ConditionNumber() const;
+    /// <summary>
+    /// The number of singular values above Tolerance. The default scales it to the size of the matrix and its largest singular value.
+    /// </summary>
+    [[nodiscard]] size_t Rank(double Tolerance = AutomaticTolerance) const noexcept;
+
+    /// <summary>
+    /// U * diag(Values), the coordinates of each row of A along the right singular vectors (the principal component scores, when A is centered).
+    /// </summary>
+    [[nodiscard]] Matrix Scores() const;
+};
+
+#endif //JASON_SINGULARVALUEDECOMPOSITION_H
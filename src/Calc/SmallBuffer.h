@@ -0,0 +1,151 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_SMALLBUFFER_H
+#define JASON_SMALLBUFFER_H
+
+#include "AlignedAllocator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+/// @brief A resizable array that keeps up to N elements inside the object itself, and only goes to the heap (through AlignedAllocator) past that.
+/// @details Moves never allocate: a heap buffer is handed over, and inline elements are copied into whatever storage the destination already has.
+/// A moved-from buffer is left empty. Only trivially copyable element types are supported, so elements are copied and never constructed or destroyed.
+/// @tparam T The element type.
+/// @tparam N The number of elements stored inline.
+template<typename T, size_t N>
+class SmallBuffer
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SmallBuffer only supports trivially copyable elements");
+    static_assert(N > 0, "SmallBuffer needs room for at least one inline element");
+
+private:
+    /// @brief Either Inline, or the heap allocation. Keeping one pointer makes every access branch free.
+    T* Start;
+    size_t Count = 0;
+    size_t Capacity = N;
+    T Inline[N];
+
+    [[nodiscard]] bool IsInline() const noexcept { return Start == Inline; }
+    void Release() noexcept
+    {
+        if (!IsInline())
+            AlignedAllocator<T>().deallocate(Start, Capacity);
+
+        Start = Inline;
+        Capacity = N;
+    }
+    /// @brief Ensures there is room for Size elements. The current elements are lost if the buffer has to grow.
+    void Prepare(size_t Size)
+    {
+        if (Size <= Capacity)
+            return;
+
+        T* grown = AlignedAllocator<T>().allocate(Size);
+        Release();
+        Start = grown;
+        Capacity = Size;
+    }
+
+public:
+    SmallBuffer() noexcept : Start(Inline) { }
+    explicit SmallBuffer(size_t Size, const T& Value = T()) : SmallBuffer()
+    {
+        assign(Size, Value);
+    }
+    SmallBuffer(std::initializer_list<T> List) : SmallBuffer()
+    {
+        Prepare(List.size());
+        std::copy(List.begin(), List.end(), Start);
+        Count = List.size();
+    }
+    SmallBuffer(const SmallBuffer& Other) : SmallBuffer()
+    {
+        *this = Other;
+    }
+    SmallBuffer(SmallBuffer&& Other) noexcept : SmallBuffer()
+    {
+        *this = std::move(Other);
+    }
+    ~SmallBuffer()
+    {
+        Release();
+    }
+
+    SmallBuffer& operator=(const SmallBuffer& Other)
+    {
+        if (this == &Other)
+            return *this;
+
+        Prepare(Other.Count);
+        std::copy_n(Other.Start, Other.Count, Start);
+        Count = Other.Count;
+        return *this;
+    }
+    SmallBuffer& operator=(SmallBuffer&& Other) noexcept
+    {
+        if (this == &Other)
+            return *this;
+
+        if (Other.IsInline())
+            std::copy_n(Other.Inline, Other.Count, Start); //Capacity is never below N, so this always fits.
+        else
+        {
+            Release();
+            Start = Other.Start;
+            Capacity = Other.Capacity;
+            Other.Start = Other.Inline;
+            Other.Capacity = N;
+        }
+
+        Count = Other.Count;
+        Other.Count = 0;
+        return *this;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return Count; }
+    [[nodiscard]] size_t capacity() const noexcept { return Capacity; }
+    [[nodiscard]] bool empty() const noexcept { return Count == 0; }
+    /// @brief True if the elements live inside the object, with no heap allocation.
+    [[nodiscard]] bool is_inline() const noexcept { return IsInline(); }
+
+    [[nodiscard]] T* data() noexcept { return Start; }
+    [[nodiscard]] const T* data() const noexcept { return Start; }
+    [[nodiscard]] T& operator[](size_t i) noexcept { return Start[i]; }
+    [[nodiscard]] const T& operator[](size_t i) const noexcept { return Start[i]; }
+
+    [[nodiscard]] T* begin() noexcept { return Start; }
+    [[nodiscard]] T* end() noexcept { return Start + Count; }
+    [[nodiscard]] const T* begin() const noexcept { return Start; }
+    [[nodiscard]] const T* end() const noexcept { return Start + Count; }
+
+    /// @brief Replaces the contents with Size copies of Value.
+    void assign(size_t Size, const T& Value)
+    {
+        Prepare(Size);
+        std::fill_n(Start, Size, Value);
+        Count = Size;
+    }
+    /// @brief Changes the size, keeping the existing elements. New elements are value initialized (zero, for arithmetic types).
+    void resize(size_t Size)
+    {
+        if (Size > Capacity)
+        {
+            T* grown = AlignedAllocator<T>().allocate(Size);
+            std::copy_n(Start, Count, grown);
+            Release();
+            Start = grown;
+            Capacity = Size;
+        }
+
+        if (Size > Count)
+            std::fill(Start + Count, Start + Size, T());
+        Count = Size;
+    }
+};
+
+#endif //JASON_SMALLBUFFER_H
@@ -0,0 +1,653 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "SparseMatrix.h"
+#include "Matrix.h"
+#include "MathVector.h"
+#include "Scalar.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <system_error>
+#include <thread>
+
+namespace
+{
+    //Below this many multiply-adds, spinning up threads costs more than it saves.
+    constexpr size_t ParallelThreshold = static_cast<size_t>(1) << 20;
+
+    /// Calls Body(Begin, End) over contiguous slices of [0, Count), one per thread when Work is large enough to be worth it.
+    template<typename F>
+    void ForEachSlice(size_t Count, size_t Work, F&& Body)
+    {
+        size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        if (Work < ParallelThreshold)
+            threads = 1;
+        threads = std::min(threads, Count);
+
+        if (threads <= 1)
+        {
+            Body(static_cast<size_t>(0), Count);
+            return;
+        }
+
+        //The calling thread takes the last slice, along with any the system refused to start a thread for.
+        size_t slice = (Count + threads - 1) / threads;
+        std::vector<std::jthread> workers; //Joined on destruction, whichever way this function exits.
+        workers.reserve(threads);
+        size_t start = 0;
+        for (; start + slice < Count; start += slice)
+        {
+            try
+            {
+                workers.emplace_back([&Body, start, end = start + slice] { Body(start, end); });
+            }
+            catch (const std::system_error&)
+            {
+                break;
+            }
+        }
+
+        Body(start, Count);
+    }
+
+    /// The number of offsets stored for a non-empty Rows x Columns matrix in Format, checked before anything is allocated for a header read from a stream.
+    size_t OffsetCount(uint64_t Rows, uint64_t Columns, SparseFormat Format)
+    {
+        uint64_t major = Format == SF_CSR ? Rows : Columns;
+        if (major >= std::numeric_limits<size_t>::max() / sizeof(uint64_t))
+            throw FormatError(std::to_string(major), "too many rows or columns");
+
+        return static_cast<size_t>(major) + 1;
+    }
+
+    /// Regroups compressed arrays by their minor index (a counting sort), which turns CSR into CSC and back.
+    /// Entries are visited in major order, so the indices in each new group come out already sorted.
+    void Recompress(size_t Major, size_t Minor,
+                    const std::vector<size_t>& Offsets, const std::vector<size_t>& Indices, const std::vector<double>& Values,
+                    std::vector<size_t>& OutOffsets, std::vector<size_t>& OutIndices, std::vector<double>& OutValues)
+    {
+        size_t nnz = Values.size();
+        OutOffsets.assign(Minor + 1, 0);
+        OutIndices.resize(nnz);
+        OutValues.resize(nnz);
+
+        for (size_t k = 0; k < nnz; k++)
+            OutOffsets[Indices[k] + 1]++;
+        for (size_t j = 0; j < Minor; j++)
+            OutOffsets[j + 1] += OutOffsets[j];
+
+        std::vector<size_t> next(OutOffsets.begin(), OutOffsets.end() - 1);
+        for (size_t i = 0; i < Major; i++)
+        {
+            for (size_t k = Offsets[i]; k < Offsets[i + 1]; k++)
+            {
+                size_t dest = next[Indices[k]]++;
+                OutIndices[dest] = i;
+                OutValues[dest] = Values[k];
+            }
+        }
+    }
+}
+
+SparseMatrix::SparseMatrix() noexcept = default;
+SparseMatrix::SparseMatrix(size_t Rows, size_t Columns, SparseFormat Format) : rows(Rows), cols(Columns), format(Format)
+{
+    if (rows == 0 || cols == 0)
+        rows = cols = 0;
+
+    offsets.assign(Major() + 1, 0);
+}
+SparseMatrix::SparseMatrix(size_t Rows, size_t Columns, SparseFormat Format, std::vector<size_t> Offsets, std::vector<size_t> Indices, std::vector<double> Values) noexcept :
+    rows(Rows), cols(Columns), format(Format), offsets(std::move(Offsets)), indices(std::move(Indices)), values(std::move(Values))
+{
+
+}
+SparseMatrix::SparseMatrix(const Matrix& Dense, SparseFormat Format, double DropTolerance) : SparseMatrix(Dense.Rows(), Dense.Columns(), SF_CSR)
+{
+    for (size_t i = 0; i < rows; i++)
+    {
+        const double* row = Dense.RowData(i);
+        for (size_t j = 0; j < cols; j++)
+        {
+            if (row[j] != 0 && std::abs(row[j]) > DropTolerance)
+            {
+                indices.push_back(j);
+                values.push_back(row[j]);
+            }
+        }
+        offsets[i + 1] = values.size();
+    }
+
+    if (Format != SF_CSR)
+        *this = ToFormat(Format);
+}
+
+SparseMatrix SparseMatrix::FromTriplets(size_t Rows, size_t Columns, std::vector<SparseEntry> Entries, SparseFormat Format)
+{
+    SparseMatrix result(Rows, Columns, Format);
+    if (!result.IsValid())
+        return result;
+
+    for (const auto& entry : Entries)
+        if (entry.Row >= Rows || entry.Column >= Columns)
+            throw std::logic_error("Out of range");
+
+    bool csr = Format == SF_CSR;
+    auto major = [csr](const SparseEntry& e) { return csr ? e.Row : e.Column; };
+    auto minor = [csr](const SparseEntry& e) { return csr ? e.Column : e.Row; };
+
+    std::sort(Entries.begin(), Entries.end(), [&](const SparseEntry& a, const SparseEntry& b)
+    {
+        return major(a) != major(b) ? major(a) < major(b) : minor(a) < minor(b);
+    });
+
+    //Duplicates are now next to each other, so they can be summed in one pass.
+    result.indices.reserve(Entries.size());
+    result.values.reserve(Entries.size());
+    for (size_t k = 0; k < Entries.size(); )
+    {
+        double sum = 0;
+        size_t end = k;
+        for (; end < Entries.size() && major(Entries[end]) == major(Entries[k]) && minor(Entries[end]) == minor(Entries[k]); end++)
+            sum += Entries[end].Value;
+
+        if (sum != 0)
+        {
+            result.offsets[major(Entries[k]) + 1]++;
+            result.indices.push_back(minor(Entries[k]));
+            result.values.push_back(sum);
+        }
+        k = end;
+    }
+
+    for (size_t i = 0; i < result.Major(); i++)
+        result.offsets[i + 1] += result.offsets[i];
+
+    return result;
+}
+SparseMatrix SparseMatrix::Identity(size_t Size, SparseFormat Format)
+{
+    SparseMatrix result(Size, Size, Format);
+    result.indices.resize(Size);
+    result.values.assign(Size, 1.0);
+    for (size_t i = 0; i < Size; i++)
+    {
+        result.indices[i] = i;
+        result.offsets[i + 1] = i + 1;
+    }
+
+    return result;
+}
+SparseMatrix SparseMatrix::ErrorMatrix()
+{
+    return {};
+}
+
+double SparseMatrix::At(size_t i, size_t j) const
+{
+    if (i >= rows || j >= cols)
+        throw std::logic_error("Out of range");
+
+    size_t major = format == SF_CSR ? i : j, minor = format == SF_CSR ? j : i;
+    auto begin = indices.begin() + static_cast<ptrdiff_t>(offsets[major]), end = indices.begin() + static_cast<ptrdiff_t>(offsets[major + 1]);
+    auto found = std::lower_bound(begin, end, minor);
+
+    return found != end && *found == minor ? values[found - indices.begin()] : 0.0;
+}
+
+SparseMatrix SparseMatrix::Reinterpreted() const
+{
+    return { cols, rows, format == SF_CSR ? SF_CSC : SF_CSR, offsets, indices, values };
+}
+SparseMatrix SparseMatrix::ToFormat(SparseFormat Format) const
+{
+    if (Format == format)
+        return *this;
+
+    SparseMatrix result(rows, cols, Format);
+    if (IsValid())
+        Recompress(Major(), result.Major(), offsets, indices, values, result.offsets, result.indices, result.values);
+
+    return result;
+}
+Matrix SparseMatrix::ToDense() const
+{
+    if (!IsValid())
+        return Matrix::ErrorMatrix();
+
+    Matrix result(rows, cols);
+    for (size_t i = 0; i < Major(); i++)
+    {
+        for (size_t k = offsets[i]; k < offsets[i + 1]; k++)
+        {
+            if (format == SF_CSR)
+                result.RowData(i)[indices[k]] = values[k];
+            else
+                result.RowData(indices[k])[i] = values[k];
+        }
+    }
+
+    return result;
+}
+SparseMatrix SparseMatrix::Transpose() const
+{
+    //The CSR arrays of A are the CSC arrays of A^T, so the transpose only needs to be regrouped back into the original format.
+    return Reinterpreted().ToFormat(format);
+}
+
+std::unique_ptr<VariableType> SparseMatrix::Clone() const noexcept
+{
+    return std::make_unique<SparseMatrix>(*this);
+}
+
+void SparseMatrix::str_serialize(std::ostream& out) const noexcept
+{
+    out << VariableTypes::VT_Sparse << ' ' << rows << ' ' << cols << ' ' << (format == SF_CSR ? "CSR" : "CSC") << ' ' << values.size();
+    if (IsValid()) //Empty matrices are written as their header alone.
+        for (size_t offset : offsets)
+            out << ' ' << offset;
+    for (size_t k = 0; k < values.size(); k++)
+        out << ' ' << indices[k] << ' ' << values[k];
+}
+void SparseMatrix::str_deserialize(std::istream& in)
+{
+    VariableTypes type;
+    in >> type;
+    if (type != VT_Sparse)
+        throw FormatError("expected sparse matrix type");
+
+    size_t newRows, newCols, nnz;
+    std::string layout;
+    if (!(in >> newRows >> newCols >> layout >> nnz))
+        throw FormatError("incomplete sparse matrix header");
+    if (layout != "CSR" && layout != "CSC")
+        throw FormatError(layout, "invalid layout (expected CSR or CSC)");
+
+    if (newRows == 0 || newCols == 0)
+    {
+        *this = SparseMatrix();
+        return;
+    }
+
+    SparseFormat newFormat = layout == "CSR" ? SF_CSR : SF_CSC;
+    size_t count = OffsetCount(newRows, newCols, newFormat);
+
+    //The arrays grow as they are read, so a corrupt header runs out of input instead of requesting huge arrays.
+    std::vector<size_t> newOffsets, newIndices;
+    std::vector<double> newValues;
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t offset;
+        if (!(in >> offset))
+            throw FormatError("not enough offsets provided");
+        newOffsets.push_back(offset);
+    }
+
+    if (newOffsets.front() != 0 || newOffsets.back() != nnz)
+        throw FormatError("the offsets do not match the number of entries");
+
+    for (size_t k = 0; k < nnz; k++)
+    {
+        size_t index;
+        double value;
+        if (!(in >> index >> value))
+            throw FormatError("not enough entries provided");
+        newIndices.push_back(index);
+        newValues.push_back(value);
+    }
+
+    SparseMatrix result(newRows, newCols, newFormat, std::move(newOffsets), std::move(newIndices), std::move(newValues));
+    result.CheckStructure();
+    *this = std::move(result);
+}
+size_t SparseMatrix::bin_size() const noexcept
+{
+    size_t stored = IsValid() ? offsets.size() : 0;
+    return 3 * sizeof(uint64_t) + sizeof(uint8_t) + stored * sizeof(uint64_t) + values.size() * (sizeof(uint64_t) + sizeof(double));
+}
+void SparseMatrix::bin_serialize(BinaryWriter& out) const
+{
+    out.Write<uint64_t>(rows);
+    out.Write<uint64_t>(cols);
+    out.Write<uint8_t>(static_cast<uint8_t>(format));
+    out.Write<uint64_t>(values.size());
+    if (IsValid()) //Empty matrices are written as their header alone.
+        out.WriteSizes(offsets.data(), offsets.size());
+    out.WriteSizes(indices.data(), indices.size());
+    out.WriteDoubles(values.data(), values.size());
+}
+void SparseMatrix::bin_deserialize(BinaryReader& in)
+{
+    auto newRows = in.Read<uint64_t>(), newCols = in.Read<uint64_t>();
+    auto layout = in.Read<uint8_t>();
+    auto nnz = in.Read<uint64_t>();
+    if (layout != SF_CSR && layout != SF_CSC)
+        throw FormatError("binary data", "invalid sparse layout");
+    if (newRows == 0 || newCols == 0)
+    {
+        *this = SparseMatrix();
+        return;
+    }
+
+    //Checked before allocating, so corrupt data cannot request huge arrays.
+    size_t count = OffsetCount(newRows, newCols, static_cast<SparseFormat>(layout));
+    constexpr size_t entrySize = sizeof(uint64_t) + sizeof(double);
+    if (count > in.Remaining() / sizeof(uint64_t) || nnz > (in.Remaining() - count * sizeof(uint64_t)) / entrySize)
+        throw FormatError("binary data", "not enough entries provided");
+
+    SparseMatrix result(newRows, newCols, static_cast<SparseFormat>(layout));
+
+    in.ReadSizes(result.offsets.data(), result.offsets.size());
+    if (result.offsets.front() != 0 || result.offsets.back() != nnz)
+        throw FormatError("the offsets do not match the number of entries");
+
+    result.indices.resize(nnz);
+    result.values.resize(nnz);
+    in.ReadSizes(result.indices.data(), nnz);
+    in.ReadDoubles(result.values.data(), nnz);
+
+    result.CheckStructure();
+    *this = std::move(result);
+}
+void SparseMatrix::CheckStructure() const
+{
+    size_t minor = format == SF_CSR ? cols : rows;
+    for (size_t i = 0; i < Major(); i++)
+    {
+        if (offsets[i] > offsets[i + 1])
+            throw FormatError("the offsets must be non-decreasing");
+
+        for (size_t k = offsets[i]; k < offsets[i + 1]; k++)
+        {
+            if (indices[k] >= minor || (k > offsets[i] && indices[k] <= indices[k - 1]))
+                throw FormatError("the indices must be in range, and increasing within each row or column");
+            if (values[k] == 0)
+                throw FormatError("explicit zeroes cannot be stored");
+        }
+    }
+}
+
+void SparseMatrix::DropZeros() noexcept
+{
+    //Compacted in place. Offsets[i] is only overwritten once row (or column) i has been read.
+    size_t kept = 0, start = 0;
+    for (size_t i = 0; i < Major(); i++)
+    {
+        size_t end = offsets[i + 1];
+        for (size_t k = start; k < end; k++)
+        {
+            if (values[k] != 0)
+            {
+                indices[kept] = indices[k];
+                values[kept] = values[k];
+                kept++;
+            }
+        }
+
+        start = end;
+        offsets[i + 1] = kept;
+    }
+
+    indices.resize(kept);
+    values.resize(kept);
+}
+
+void SparseMatrix::dbg_fmt(std::ostream& out) const noexcept
+{
+    out << "(SparseMatrix:" << rows << "x" << cols << ", " << values.size() << " non-zero, " << (format == SF_CSR ? "CSR" : "CSC") << ")";
+}
+void SparseMatrix::dsp_fmt(std::ostream& out) const noexcept
+{
+    if (!IsValid())
+    {
+        out << "[empty sparse matrix]";
+        return;
+    }
+
+    out << "[ " << rows << "x" << cols << ":";
+    for (size_t i = 0; i < Major(); i++)
+    {
+        for (size_t k = offsets[i]; k < offsets[i + 1]; k++)
+        {
+            size_t r = format == SF_CSR ? i : indices[k], c = format == SF_CSR ? indices[k] : i;
+            out << " (" << r << ", " << c << ") " << values[k] << ";";
+        }
+    }
+    out << " ]";
+}
+
+MathVector SparseMatrix::operator*(const MathVector& Two) const
+{
+    if (!IsValid() || !Two.IsValid())
+        throw OperatorError('*', *this, Two, "one or both is empty");
+    if (cols != Two.Dim())
+        throw OperatorError('*', *this, Two, "dimension mismatch");
+
+    MathVector result(rows);
+    const double* x = Two.data();
+    double* y = result.data();
+
+    if (format == SF_CSR)
+    {
+        //Each row is an independent sparse dot product.
+        ForEachSlice(rows, values.size(), [&](size_t Begin, size_t End)
+        {
+            for (size_t i = Begin; i < End; i++)
+            {
+                double sum = 0;
+                for (size_t k = offsets[i]; k < offsets[i + 1]; k++)
+                    sum += values[k] * x[indices[k]];
+                y[i] = sum;
+            }
+        });
+    }
+    else
+    {
+        //Each column scatters into y, so columns cannot be split across threads without conflicting writes.
+        for (size_t j = 0; j < cols; j++)
+            for (size_t k = offsets[j]; k < offsets[j + 1]; k++)
+                y[indices[k]] += values[k] * x[j];
+    }
+
+    return result;
+}
+Matrix SparseMatrix::operator*(const Matrix& Two) const
+{
+    if (!IsValid() || !Two.IsValid())
+        throw OperatorError('*', *this, Two, "one or both is empty");
+    if (cols != Two.Rows())
+        throw OperatorError('*', *this, Two, "dimension mismatch");
+
+    size_t n = Two.Columns();
+    Matrix result(rows, n);
+    const auto& simd = SimdKernels();
+
+    //Row i of the result is the sum of v * (row j of Two) over the entries (i, j, v), so every entry is one axpy over a dense row.
+    if (format == SF_CSR)
+    {
+        ForEachSlice(rows, values.size() * n, [&](size_t Begin, size_t End)
+        {
+            for (size_t i = Begin; i < End; i++)
+                for (size_t k = offsets[i]; k < offsets[i + 1]; k++)
+                    simd.Axpy(result.RowData(i), values[k], Two.RowData(indices[k]), n);
+        });
+    }
+    else
+    {
+        for (size_t j = 0; j < cols; j++)
+            for (size_t k = offsets[j]; k < offsets[j + 1]; k++)
+                simd.Axpy(result.RowData(indices[k]), values[k], Two.RowData(j), n);
+    }
+
+    return result;
+}
+SparseMatrix SparseMatrix::operator*(const SparseMatrix& Two) const
+{
+    if (!IsValid() || !Two.IsValid())
+        throw OperatorError('*', *this, Two, "one or both is empty");
+    if (cols != Two.rows)
+        throw OperatorError('*', *this, Two, "dimension mismatch");
+
+    /*
+     * Gustavson's algorithm, on CSR operands: row i of the product is the sum of a * (row k of B) over the entries (i, k, a)
+     * of A. The row is accumulated in a dense array, with Marker recording which columns were touched for this row, so only
+     * those are visited (and reset) afterwards.
+     */
+    SparseMatrix a = ToFormat(SF_CSR), b = Two.ToFormat(SF_CSR);
+    size_t n = b.cols;
+    constexpr size_t Untouched = std::numeric_limits<size_t>::max();
+
+    std::vector<size_t> resultOffsets(rows + 1, 0), resultIndices;
+    std::vector<double> resultValues;
+    std::vector<double> accumulator(n, 0.0);
+    std::vector<size_t> marker(n, Untouched), touched;
+
+    for (size_t i = 0; i < rows; i++)
+    {
+        touched.clear();
+        for (size_t ka = a.offsets[i]; ka < a.offsets[i + 1]; ka++)
+        {
+            size_t k = a.indices[ka];
+            double fac = a.values[ka];
+            for (size_t kb = b.offsets[k]; kb < b.offsets[k + 1]; kb++)
+            {
+                size_t j = b.indices[kb];
+                if (marker[j] != i)
+                {
+                    marker[j] = i;
+                    accumulator[j] = 0;
+                    touched.push_back(j);
+                }
+                accumulator[j] += fac * b.values[kb];
+            }
+        }
+
+        std::sort(touched.begin(), touched.end());
+        for (size_t j : touched)
+        {
+            if (accumulator[j] != 0)
+            {
+                resultIndices.push_back(j);
+                resultValues.push_back(accumulator[j]);
+            }
+        }
+        resultOffsets[i + 1] = resultValues.size();
+    }
+
+    SparseMatrix result(rows, n, SF_CSR, std::move(resultOffsets), std::move(resultIndices), std::move(resultValues));
+    return format == SF_CSR ? result : result.ToFormat(format);
+}
+SparseMatrix SparseMatrix::operator*(double Fac) const
+{
+    if (Fac == 0)
+        return { rows, cols, format };
+
+    SparseMatrix result(*this);
+    if (!result.values.empty())
+        SimdKernels().Scale(result.values.data(), Fac, result.values.size());
+
+    result.DropZeros();
+    return result;
+}
+SparseMatrix SparseMatrix::operator/(double Fac) const
+{
+    if (Fac == 0)
+        throw OperatorError('/', *this, Scalar(0), "divide by zero");
+
+    SparseMatrix result(*this);
+    if (!result.values.empty())
+        SimdKernels().Divide(result.values.data(), Fac, result.values.size());
+
+    result.DropZeros();
+    return result;
+}
+
+SparseMatrix SparseMatrix::operator+(const SparseMatrix& Two) const
+{
+    if (!IsValid() || !Two.IsValid())
+        throw OperatorError('+', *this, Two, "one or both is empty");
+    if (rows != Two.rows || cols != Two.cols)
+        throw OperatorError('+', *this, Two, "dimension mismatch");
+
+    //Both operands are in the same format, so each row (or column) of the result is a merge of two sorted index lists.
+    SparseMatrix other = Two.ToFormat(format);
+    std::vector<size_t> resultOffsets(Major() + 1, 0), resultIndices;
+    std::vector<double> resultValues;
+    resultIndices.reserve(values.size() + other.values.size());
+    resultValues.reserve(values.size() + other.values.size());
+
+    for (size_t i = 0; i < Major(); i++)
+    {
+        size_t p = offsets[i], pEnd = offsets[i + 1], q = other.offsets[i], qEnd = other.offsets[i + 1];
+        while (p < pEnd || q < qEnd)
+        {
+            size_t index;
+            double value;
+            if (q == qEnd || (p < pEnd && indices[p] < other.indices[q]))
+            {
+                index = indices[p];
+                value = values[p++];
+            }
+            else if (p == pEnd || other.indices[q] < indices[p])
+            {
+                index = other.indices[q];
+                value = other.values[q++];
+            }
+            else
+            {
+                index = indices[p];
+                value = values[p++] + other.values[q++];
+            }
+
+            if (value != 0)
+            {
+                resultIndices.push_back(index);
+                resultValues.push_back(value);
+            }
+        }
+        resultOffsets[i + 1] = resultValues.size();
+    }
+
+    return { rows, cols, format, std::move(resultOffsets), std::move(resultIndices), std::move(resultValues) };
+}
+SparseMatrix SparseMatrix::operator-(const SparseMatrix& Two) const
+{
+    if (!IsValid() || !Two.IsValid())
+        throw OperatorError('-', *this, Two, "one or both is empty");
+    if (rows != Two.rows || cols != Two.cols)
+        throw OperatorError('-', *this, Two, "dimension mismatch");
+
+    return *this + Two * -1.0;
+}
+
+bool SparseMatrix::operator==(const VariableType& two) const noexcept
+{
+    const auto* conv = dynamic_cast<const SparseMatrix*>(&two);
+    return conv && *this == *conv;
+}
+bool SparseMatrix::operator!=(const VariableType& two) const noexcept
+{
+    return !(*this == two);
+}
+bool SparseMatrix::operator==(const SparseMatrix& two) const noexcept
+{
+    if (rows != two.rows || cols != two.cols)
+        return false;
+    if (!IsValid()) //Empty matrices may or may not hold their one offset, depending on how they were made.
+        return true;
+
+    //No zeroes are ever stored, so two equal matrices in the same format have identical arrays.
+    if (format == two.format)
+        return offsets == two.offsets && indices == two.indices && values == two.values;
+
+    SparseMatrix conv = two.ToFormat(format);
+    return offsets == conv.offsets && indices == conv.indices && values == conv.values;
+}
+bool SparseMatrix::operator!=(const SparseMatrix& two) const noexcept
+{
+    return !(*this == two);
+}
@@ -0,0 +1,142 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_SPARSEMATRIX_H
+#define JASON_SPARSEMATRIX_H
+
+#include "VariableType.h"
+#include "../Core/Errors.h"
+
+#include <vector>
+
+class Matrix;
+class MathVector;
+
+/// <summary>
+/// The compressed layout used by a SparseMatrix.
+/// </summary>
+enum SparseFormat
+{
+    SF_CSR = 0, //Compressed sparse row: the entries are grouped by row. Fast row access and matrix-vector products.
+    SF_CSC = 1, //Compressed sparse column: the entries are grouped by column. Fast column access, and the transpose of a CSR matrix.
+};
+
+/// <summary>
+/// One (row, column, value) entry, used to build a SparseMatrix.
+/// </summary>
+struct SparseEntry
+{
+    size_t Row;
+    size_t Column;
+    double Value;
+};
+
+/// <summary>
+/// A matrix that only stores its non-zero entries, in either CSR or CSC form.
+/// In CSR, the entries of row i are Indices()[k] (their columns) and Values()[k], for Offsets()[i] <= k < Offsets()[i + 1]. CSC is the same with rows and columns swapped.
+/// Within each row (or column), the indices are strictly increasing, and no explicit zeroes are stored.
+/// </summary>
+class SparseMatrix : public VariableType
+{
+private:
+    size_t rows = 0;
+    size_t cols = 0;
+    SparseFormat format = SF_CSR;
+    std::vector<size_t> offsets;
+    std::vector<size_t> indices;
+    std::vector<double> values;
+
+    SparseMatrix(size_t Rows, size_t Columns, SparseFormat Format, std::vector<size_t> Offsets, std::vector<size_t> Indices, std::vector<double> Values) noexcept;
+
+    /// <summary>
+    /// The number of rows in CSR, or columns in CSC.
+    /// </summary>
+    [[nodiscard]] size_t Major() const noexcept { return format == SF_CSR ? rows : cols; }
+    /// <summary>
+    /// The same arrays, read in the other format, which is the transpose of this matrix. No entries are moved.
+    /// </summary>
+    [[nodiscard]] SparseMatrix Reinterpreted() const;
+    /// <summary>
+    /// Throws FormatError unless the offsets are non-decreasing, the indices are in range and increasing within each row (or column), and no stored value is zero. Used when loading.
+    /// </summary>
+    void CheckStructure() const;
+    /// <summary>
+    /// Removes entries that have become zero, such as products that underflowed, so that no explicit zeroes are stored.
+    /// </summary>
+    void DropZeros() noexcept;
+
+public:
+    SparseMatrix() noexcept;
+    /// <summary>
+    /// Creates a Rows x Columns matrix of all zeroes.
+    /// </summary>
+    SparseMatrix(size_t Rows, size_t Columns, SparseFormat Format = SF_CSR);
+    /// <summary>
+    /// Compresses a dense matrix, dropping every entry whose absolute value is at or below DropTolerance.
+    /// </summary>
+    explicit SparseMatrix(const Matrix& Dense, SparseFormat Format = SF_CSR, double DropTolerance = 0);
+    SparseMatrix(const SparseMatrix& Other) = default;
+    SparseMatrix(SparseMatrix&& Other) noexcept = default;
+
+    SparseMatrix& operator=(const SparseMatrix& Other) = default;
+    SparseMatrix& operator=(SparseMatrix&& Other) noexcept = default;
+
+    /// <summary>
+    /// Builds a matrix from entries in any order. Entries at the same position are summed, and zeroes are dropped.
+    /// </summary>
+    [[nodiscard]] static SparseMatrix FromTriplets(size_t Rows, size_t Columns, std::vector<SparseEntry> Entries, SparseFormat Format = SF_CSR);
+    [[nodiscard]] static SparseMatrix Identity(size_t Size, SparseFormat Format = SF_CSR);
+    [[nodiscard]] static SparseMatrix ErrorMatrix();
+
+    [[nodiscard]] size_t Rows() const noexcept { return rows; }
+    [[nodiscard]] size_t Columns() const noexcept { return cols; }
+    [[nodiscard]] size_t NonZeros() const noexcept { return values.size(); }
+    [[nodiscard]] SparseFormat Format() const noexcept { return format; }
+    [[nodiscard]] bool IsValid() const noexcept { return rows != 0 && cols != 0; }
+    [[nodiscard]] bool IsSquare() const noexcept { return IsValid() && rows == cols; }
+
+    /// <summary>
+    /// The raw compressed arrays. See the class description for the layout.
+    /// </summary>
+    [[nodiscard]] const std::vector<size_t>& Offsets() const noexcept { return offsets; }
+    [[nodiscard]] const std::vector<size_t>& Indices() const noexcept { return indices; }
+    [[nodiscard]] const std::vector<double>& Values() const noexcept { return values; }
+
+    /// <summary>
+    /// Returns the element at (i, j), which is zero if it is not stored. Found by binary search within the row (or column).
+    /// </summary>
+    [[nodiscard]] double At(size_t i, size_t j) const;
+
+    [[nodiscard]] SparseMatrix ToFormat(SparseFormat Format) const;
+    [[nodiscard]] Matrix ToDense() const;
+    [[nodiscard]] SparseMatrix Transpose() const;
+
+    [[nodiscard]] std::unique_ptr<VariableType> Clone() const noexcept override;
+    [[nodiscard]] VariableTypes GetType() const noexcept override { return VT_Sparse; }
+
+    void str_serialize(std::ostream& out) const noexcept override;
+    void str_deserialize(std::istream& in) override;
+    [[nodiscard]] size_t bin_size() const noexcept override;
+    void bin_serialize(BinaryWriter& out) const override;
+    void bin_deserialize(BinaryReader& in) override;
+
+    void dbg_fmt(std::ostream& out) const noexcept override;
+    void dsp_fmt(std::ostream& out) const noexcept override;
+
+    MathVector operator*(const MathVector& Two) const;
+    Matrix operator*(const Matrix& Two) const;
+    SparseMatrix operator*(const SparseMatrix& Two) const;
+    SparseMatrix operator*(double Fac) const;
+    SparseMatrix operator/(double Fac) const;
+
+    SparseMatrix operator+(const SparseMatrix& Two) const;
+    SparseMatrix operator-(const SparseMatrix& Two) const;
+
+    bool operator==(const VariableType& two) const noexcept override;
+    bool operator!=(const VariableType& two) const noexcept override;
+    bool operator==(const SparseMatrix& two) const noexcept;
+    bool operator!=(const SparseMatrix& two) const noexcept;
+};
+
+#endif //JASON_SPARSEMATRIX_H
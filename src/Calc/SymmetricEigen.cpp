@@ -0,0 +1,190 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "SymmetricEigen.h"
+#include "Householder.h"
+#include "Tridiagonal.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    //The number of reflectors generated before the trailing submatrix is updated with GEMMs.
+    constexpr size_t BlockSize = 32;
+
+    /// @brief Reduces the symmetric matrix A to tridiagonal form Q^T A Q, reading and updating only its lower triangle.
+    /// @details Reflector j is stored in column j of A, below the subdiagonal, with its implicit 1 on the subdiagonal.
+    void Tridiagonalize(Matrix& A, std::vector<double>& Diagonal, std::vector<double>& OffDiagonal, std::vector<double>& Tau)
+    {
+        size_t n = A.Rows(), ld = A.LeadingDimension();
+        const auto& simd = SimdKernels();
+        Diagonal.assign(n, 0.0);
+        OffDiagonal.assign(n - 1, 0.0);
+        Tau.assign(n - 1, 0.0);
+
+        /*
+         * Blocked reduction. Within a panel, the reflectors are not applied to the trailing matrix right away. Instead, each
+         * one records a vector w, such that the trailing matrix is really A - V W^T - W V^T. Column j is brought up to date
+         * only when it is reached, and the product with the trailing matrix (needed for every w) subtracts the pending update
+         * on the fly. At the end of the panel, the whole update is applied at once with GEMMs, one block row at a time down
+         * to the diagonal, the same way Cholesky updates its trailing matrix.
+         *
+         * The product with the trailing matrix still reads all of it for every column, so half of the work is inherently
+         * memory bound; blocking removes the other half of the passes over memory, which the unblocked reduction spends
+         * writing rank 2 updates.
+         */
+        Matrix Vt(BlockSize, n), Wt(BlockSize, n);
+        std::vector<double> column(n);
+
+        for (size_t k0 = 0; k0 + 1 < n; k0 += BlockSize)
+        {
+            size_t nb = std::min(BlockSize, n - 1 - k0), next = k0 + nb;
+
+            for (size_t t = 0; t < nb; t++)
+            {
+                size_t j = k0 + t, len = n - j, rest = len - 1;
+
+                for (size_t i = 0; i < len; i++)
+                    column[i] = A.RowData(j + i)[j];
+                for (size_t s = 0; s < t; s++)
+                {
+                    simd.Axpy(column.data(), -Wt.RowData(s)[j], Vt.RowData(s) + j, len);
+                    simd.Axpy(column.data(), -Vt.RowData(s)[j], Wt.RowData(s) + j, len);
+                }
+                for (size_t i = 0; i < len; i++)
+                    A.RowData(j + i)[j] = column[i];
+
+                Diagonal[j] = column[0];
+                double* sub = A.RowData(j + 1) + j;
+                double tau = Tau[j] = GenerateReflector(*sub, sub + ld, rest - 1, ld);
+                OffDiagonal[j] = *sub;
+
+                double* v = Vt.RowData(t);
+                double* w = Wt.RowData(t);
+                std::fill(v, v + j + 1, 0.0);
+                std::fill(w, w + n, 0.0);
+                v[j + 1] = 1;
+                for (size_t i = j + 2; i < n; i++)
+                    v[i] = A.RowData(i)[j];
+
+                if (tau == 0)
+                    continue;
+
+                //w = A v, from the lower triangle only: row i contributes its dot product with v to w[i], and (as column i) v[i] times itself to the elements before i.
+                double* vr = v + j + 1;
+                double* wr = w + j + 1;
+                for (size_t i = j + 1; i < n; i++)
+                {
+                    const double* row = A.RowData(i) + j + 1;
+                    size_t before = i - j - 1;
+                    w[i] += simd.Dot(row, vr, before) + row[before] * v[i];
+                    simd.Axpy(wr, v[i], row, before);
+                }
+
+                for (size_t s = 0; s < t; s++)
+                {
+                    double vv = simd.Dot(Vt.RowData(s) + j + 1, vr, rest), wv = simd.Dot(Wt.RowData(s) + j + 1, vr, rest);
+                    simd.Axpy(wr, -wv, Vt.RowData(s) + j + 1, rest);
+                    simd.Axpy(wr, -vv, Wt.RowData(s) + j + 1, rest);
+                }
+
+                //w = tau (A v - 1/2 tau (v^T A v) v), which makes the two sided update H A H equal to A - v w^T - w v^T.
+                simd.Scale(wr, tau, rest);
+                simd.Axpy(wr, -0.5 * tau * simd.Dot(wr, vr, rest), vr, rest);
+            }
+
+            for (size_t i0 = next; i0 < n; i0 += BlockSize)
+            {
+                size_t ib = std::min(BlockSize, n - i0), width = i0 + ib - next;
+                MatrixView target = A.Block(i0, next, ib, width);
+                ViewMultiply(target, Vt.Block(0, i0, nb, ib).Transposed(), Wt.Block(0, next, nb, width), -1.0, 1.0);
+                ViewMultiply(target, Wt.Block(0, i0, nb, ib).Transposed(), Vt.Block(0, next, nb, width), -1.0, 1.0);
+            }
+        }
+
+        Diagonal[n - 1] = A.RowData(n - 1)[n - 1];
+    }
+
+    /// @brief Overwrites Z with Q Z, for the Q of Tridiagonalize.
+    void ApplyTridiagonalQ(const Matrix& Packed, const std::vector<double>& Tau, Matrix& Z)
+    {
+        //Q = H_0 H_1 ... H_(n-2), so the last block is applied first. Reflector j only touches rows j + 1 and below.
+        size_t n = Packed.Rows(), count = Tau.size(), k = Z.Columns();
+        for (size_t b = (count + BlockSize - 1) / BlockSize; b-- > 0; )
+        {
+            size_t s = b * BlockSize, w = std::min(BlockSize, count - s);
+            Matrix V = GatherReflectors(Packed.View(), s, w, 1);
+            ApplyReflectorBlock(V, ReflectorBlockT(V, Tau.data() + s), Z.Block(s + 1, 0, n - s - 1, k), false);
+        }
+    }
+}
+
+SymmetricEigen::SymmetricEigen(const Matrix& A, const SpectralOptions& Options) : Vectors(Matrix::ErrorMatrix())
+{
+    if (!A.IsValid())
+        throw OperationError("eigen decomposition", "empty matrix");
+    if (!A.IsSymmetric())
+        throw OperationError("eigen decomposition", "the matrix must be symmetric");
+    if (Options.Count > A.Rows())
+        throw OperationError("eigen decomposition", "more eigenvalues were requested than the matrix has");
+
+    Compute(A, Options);
+}
+
+void SymmetricEigen::Compute(const Matrix& Input, const SpectralOptions& Options)
+{
+    size_t n = Input.Rows(), count = Options.Count == 0 ? n : Options.Count;
+    if (n == 1)
+    {
+        Values = { Input.RowData(0)[0] };
+        if (Options.ComputeVectors)
+            Vectors = Matrix::Identity(1);
+        return;
+    }
+
+    Matrix A(Input);
+    std::vector<double> diagonal, offDiagonal, tau;
+    Tridiagonalize(A, diagonal, offDiagonal, tau);
+
+    if (!Options.ComputeVectors)
+    {
+        Values = TridiagonalEigen(diagonal, offDiagonal, n - count, count, nullptr);
+        return;
+    }
+
+    Matrix Z = Matrix::ErrorMatrix();
+    Values = TridiagonalEigen(diagonal, offDiagonal, n - count, count, &Z);
+    ApplyTridiagonalQ(A, tau, Z);
+    Vectors = std::move(Z);
+}
+
+Matrix SymmetricEigen::Pow(unsigned long long Power) const
+{
+    size_t n = Size();
+    if (!HasEigenvectors() || Vectors.Rows() != n)
+        throw OperationError("matrix power", "the full eigen decomposition is required");
+    if (Power == 0)
+        return Matrix::Identity(n);
+
+    //W = V * diag(Values^Power), then the result is W * V^T, which is symmetric, so only the upper half is computed.
+    Matrix W(Vectors);
+    for (size_t j = 0; j < n; j++)
+    {
+        double scale = std::pow(Values[j], static_cast<double>(Power));
+        for (size_t i = 0; i < n; i++)
+            W.RowData(i)[j] *= scale;
+    }
+
+    const auto& simd = SimdKernels();
+    Matrix result(n, n);
+    for (size_t i = 0; i < n; i++)
+    {
+        for (size_t j = i; j < n; j++)
+            result.RowData(i)[j] = result.RowData(j)[i] = simd.Dot(W.RowData(i), Vectors.RowData(j), n);
+    }
+
+    return result;
+}
@@ -0,0 +1,50 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_SYMMETRICEIGEN_H
+#define JASON_SYMMETRICEIGEN_H
+
+#include "Matrix.h"
+
+#include <vector>
+
+/// <summary>
+/// The decomposition A = V * diag(Values) * V^T of a real symmetric matrix, where V is orthogonal. Once computed, functions of the matrix (such as integer powers) cost one diagonal scaling and one product, no matter the power.
+/// The matrix is reduced to tridiagonal form with blocked Householder reflectors, the eigenvalues of that are found by implicit QL, and the eigenvectors by inverse iteration, transformed back through the reflectors.
+/// </summary>
+class SymmetricEigen
+{
+private:
+    /// <summary>
+    /// The eigenvalues, ascending.
+    /// </summary>
+    std::vector<double> Values;
+    /// <summary>
+    /// The eigenvectors, stored as the columns of the matrix. Column j belongs to Values[j]. Empty if they were not computed.
+    /// </summary>
+    Matrix Vectors;
+
+    void Compute(const Matrix& A, const SpectralOptions& Options);
+
+public:
+    /// <summary>
+    /// Decomposes the matrix. Throws if the matrix is empty, not square, or not symmetric, or if Options asks for more values than the matrix has.
+    /// </summary>
+    explicit SymmetricEigen(const Matrix& A, const SpectralOptions& Options = {});
+
+    /// <summary>
+    /// The number of eigenvalues computed, which is the size of the matrix unless SpectralOptions::Count limited it.
+    /// </summary>
+    [[nodiscard]] size_t Size() const noexcept { return Values.size(); }
+    [[nodiscard]] bool HasEigenvectors() const noexcept { return Vectors.IsValid(); }
+    [[nodiscard]] const std::vector<double>& Eigenvalues() const noexcept { return Values; }
+    [[nodiscard]] const Matrix& Eigenvectors() const noexcept { return Vectors; }
+
+    /// <summary>
+    /// Computes A^Power as V * diag(Values^Power) * V^T. Throws unless the full decomposition, with eigenvectors, was computed.
+    /// </summary>
+    [[nodiscard]] Matrix Pow(unsigned long long Power) const;
+};
+
+#endif //JASON_SYMMETRICEIGEN_H
@@ -0,0 +1,160 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "Transpose.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    //The largest block (in each dimension) handled without further splitting. 32 x 32 doubles is 8KB, so a source and destination tile fit in L1 together.
+    constexpr size_t Tile = 32;
+
+    /// Splits a dimension in half, keeping the first half a multiple of 4 so full 4x4 blocks line up.
+    size_t Half(size_t Size) noexcept
+    {
+        size_t h = (Size / 2) & ~static_cast<size_t>(3);
+        return h == 0 ? Size / 2 : h;
+    }
+
+    void TransposeTile(const SimdKernelTable& simd, const double* In, size_t LDI, double* Out, size_t LDO, size_t Rows, size_t Columns) noexcept
+    {
+        size_t fullRows = Rows & ~static_cast<size_t>(3), fullColumns = Columns & ~static_cast<size_t>(3);
+
+        for (size_t i = 0; i < fullRows; i += 4)
+            for (size_t j = 0; j < fullColumns; j += 4)
+                simd.Transpose4x4(In + i * LDI + j, LDI, Out + j * LDO + i, LDO);
+
+        //The ragged right edge and bottom edge.
+        for (size_t i = 0; i < Rows; i++)
+        {
+            size_t j = i < fullRows ? fullColumns : 0;
+            for (; j < Columns; j++)
+                Out[j * LDO + i] = In[i * LDI + j];
+        }
+    }
+    void TransposeRecursive(const SimdKernelTable& simd, const double* In, size_t LDI, double* Out, size_t LDO, size_t Rows, size_t Columns) noexcept
+    {
+        if (Rows <= Tile && Columns <= Tile)
+            TransposeTile(simd, In, LDI, Out, LDO, Rows, Columns);
+        else if (Rows >= Columns)
+        {
+            size_t h = Half(Rows);
+            TransposeRecursive(simd, In, LDI, Out, LDO, h, Columns);
+            TransposeRecursive(simd, In + h * LDI, LDI, Out + h, LDO, Rows - h, Columns);
+        }
+        else
+        {
+            size_t h = Half(Columns);
+            TransposeRecursive(simd, In, LDI, Out, LDO, Rows, h);
+            TransposeRecursive(simd, In + h, LDI, Out + h * LDO, LDO, Rows, Columns - h);
+        }
+    }
+
+    /// Swaps X[i][j] with Y[j][i], where X is Rows x Columns and Y is Columns x Rows, both with row stride LD.
+    void SwapTransposedTile(const SimdKernelTable& simd, double* X, double* Y, size_t LD, size_t Rows, size_t Columns) noexcept
+    {
+        size_t fullRows = Rows & ~static_cast<size_t>(3), fullColumns = Columns & ~static_cast<size_t>(3);
+
+        for (size_t i = 0; i < fullRows; i += 4)
+        {
+            for (size_t j = 0; j < fullColumns; j += 4)
+            {
+                double* x = X + i * LD + j, *y = Y + j * LD + i;
+                double tx[16], ty[16];
+                simd.Transpose4x4(x, LD, tx, 4);
+                simd.Transpose4x4(y, LD, ty, 4);
+                for (size_t r = 0; r < 4; r++)
+                {
+                    std::copy_n(tx + r * 4, 4, y + r * LD);
+                    std::copy_n(ty + r * 4, 4, x + r * LD);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < Rows; i++)
+        {
+            size_t j = i < fullRows ? fullColumns : 0;
+            for (; j < Columns; j++)
+                std::swap(X[i * LD + j], Y[j * LD + i]);
+        }
+    }
+    void SwapTransposedRecursive(const SimdKernelTable& simd, double* X, double* Y, size_t LD, size_t Rows, size_t Columns) noexcept
+    {
+        if (Rows <= Tile && Columns <= Tile)
+            SwapTransposedTile(simd, X, Y, LD, Rows, Columns);
+        else if (Rows >= Columns)
+        {
+            size_t h = Half(Rows);
+            SwapTransposedRecursive(simd, X, Y, LD, h, Columns);
+            SwapTransposedRecursive(simd, X + h * LD, Y + h, LD, Rows - h, Columns);
+        }
+        else
+        {
+            size_t h = Half(Columns);
+            SwapTransposedRecursive(simd, X, Y, LD, Rows, h);
+            SwapTransposedRecursive(simd, X + h, Y + h * LD, LD, Rows, Columns - h);
+        }
+    }
+    void SquareRecursive(const SimdKernelTable& simd, double* A, size_t LD, size_t N) noexcept
+    {
+        if (N <= Tile)
+        {
+            for (size_t i = 0; i < N; i++)
+                for (size_t j = i + 1; j < N; j++)
+                    std::swap(A[i * LD + j], A[j * LD + i]);
+            return;
+        }
+
+        //Transpose both diagonal quadrants in place, then swap the off diagonal quadrants while transposing them.
+        size_t h = Half(N);
+        SquareRecursive(simd, A, LD, h);
+        SquareRecursive(simd, A + h * LD + h, LD, N - h);
+        SwapTransposedRecursive(simd, A + h, A + h * LD, LD, h, N - h);
+    }
+}
+
+void TransposeCopy(const double* In, size_t LDI, double* Out, size_t LDO, size_t Rows, size_t Columns) noexcept
+{
+    if (Rows == 0 || Columns == 0)
+        return;
+
+    TransposeRecursive(SimdKernels(), In, LDI, Out, LDO, Rows, Columns);
+}
+void TransposeSquareInPlace(double* A, size_t LD, size_t N) noexcept
+{
+    SquareRecursive(SimdKernels(), A, LD, N);
+}
+void TransposePackedInPlace(double* A, size_t Rows, size_t Columns)
+{
+    /*
+     * In the packed layout, the element at index k = i * Columns + j belongs at j * Rows + i, which works out to
+     * k * Rows mod (N - 1) (the first and last elements never move). Following k -> k * Rows mod (N - 1) walks a
+     * cycle of elements, each moving into the slot of the next. Every slot that was written is marked, so each
+     * cycle is only walked once.
+     */
+    size_t N = Rows * Columns;
+    if (Rows <= 1 || Columns <= 1)
+        return; //A single row and a single column have the same packed layout.
+
+    std::vector<bool> moved(N, false);
+    for (size_t start = 1; start < N - 1; start++)
+    {
+        if (moved[start])
+            continue;
+
+        size_t k = start;
+        double carry = A[start];
+        do
+        {
+            size_t next = (k * Rows) % (N - 1);
+            std::swap(carry, A[next]);
+            moved[next] = true;
+            k = next;
+        } while (k != start);
+    }
+}
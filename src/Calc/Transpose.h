@@ -0,0 +1,29 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_TRANSPOSE_H
+#define JASON_TRANSPOSE_H
+
+#include <cstddef>
+
+/*
+ * TRANSPOSE
+ *
+ * Transpose kernels over raw row-major storage. The out-of-place and square in-place kernels are cache-oblivious:
+ * they recursively halve the larger dimension until a tile fits in L1, so both the reads and the writes stay
+ * cache friendly at every level of the memory hierarchy, without tuning for a specific cache size. Full 4x4
+ * tiles are transposed in registers through SimdKernels().Transpose4x4.
+ */
+
+/// @brief Writes the transpose of the Rows x Columns matrix In (row stride LDI) into Out, which is Columns x Rows (row stride LDO). In and Out must not overlap.
+void TransposeCopy(const double* In, size_t LDI, double* Out, size_t LDO, size_t Rows, size_t Columns) noexcept;
+
+/// @brief Transposes the N x N matrix A (row stride LD) in place.
+void TransposeSquareInPlace(double* A, size_t LD, size_t N) noexcept;
+
+/// @brief Transposes a densely packed (row stride == Columns) Rows x Columns matrix in place, leaving it densely packed as Columns x Rows.
+/// @details Uses cycle following, where each element is moved directly to its final position. Needs one bit of scratch per element.
+void TransposePackedInPlace(double* A, size_t Rows, size_t Columns);
+
+#endif //JASON_TRANSPOSE_H
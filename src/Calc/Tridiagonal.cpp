@@ -0,0 +1,305 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "Tridiagonal.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace
+{
+    constexpr double Epsilon = std::numeric_limits<double>::epsilon();
+    //The QL iteration almost always needs two or three sweeps per eigenvalue; this many means it is not converging.
+    constexpr unsigned MaxQLIterations = 30;
+    constexpr unsigned MaxInverseIterations = 5;
+    //Eigenvalues closer together than this (relative to the norm of their block) have their vectors reorthogonalized.
+    constexpr double ClusterTolerance = 1e-3;
+
+    struct UnreducedBlock
+    {
+        size_t Start;
+        size_t Size;
+        //The infinity norm of the block alone. Convergence within a block is judged against this, not the whole matrix, so that a block of tiny entries still gets accurate eigenvalues and orthogonal vectors.
+        double Norm;
+    };
+    struct TaggedEigenvalue
+    {
+        double Value;
+        size_t Block;
+    };
+
+    /// @brief Replaces the diagonal D of an unreduced block with its eigenvalues, by implicit QL with Wilkinson shifts.
+    /// @details E[i] couples rows i and i + 1, and E[n - 1] is scratch. E is destroyed. Off-diagonal entries at or below Negligible are treated as zero.
+    void ImplicitQL(double* D, double* E, size_t n, double Negligible)
+    {
+        E[n - 1] = 0;
+        for (size_t l = 0; l < n; l++)
+        {
+            unsigned iterations = 0;
+            while (true)
+            {
+                size_t m = l;
+                for (; m + 1 < n; m++)
+                    if (std::abs(E[m]) <= Epsilon * (std::abs(D[m]) + std::abs(D[m + 1])) || std::abs(E[m]) <= Negligible)
+                        break;
+
+                if (m == l)
+                    break;
+                if (++iterations > MaxQLIterations)
+                    throw OperationError("eigen decomposition", "the tridiagonal QL iteration did not converge");
+
+                //Shift by the eigenvalue of the leading 2x2 closer to D[l], then chase the bulge up from m to l with plane rotations.
+                double g = (D[l + 1] - D[l]) / (2 * E[l]);
+                double r = std::hypot(g, 1.0);
+                g = D[m] - D[l] + E[l] / (g + std::copysign(r, g));
+
+                double s = 1, c = 1, p = 0;
+                bool underflow = false;
+                for (size_t i = m; i-- > l; )
+                {
+                    double f = s * E[i], b = c * E[i];
+                    r = E[i + 1] = std::hypot(f, g);
+                    if (r == 0)
+                    {
+                        //The rotation underflowed, which splits the matrix at i. Restart on the smaller problem.
+                        D[i + 1] -= p;
+                        E[m] = 0;
+                        underflow = true;
+                        break;
+                    }
+
+                    s = f / r;
+                    c = g / r;
+                    g = D[i + 1] - p;
+                    r = (D[i] - g) * s + 2 * c * b;
+                    p = s * r;
+                    D[i + 1] = g + p;
+                    g = c * r - b;
+                }
+
+                if (underflow)
+                    continue;
+
+                D[l] -= p;
+                E[l] = g;
+                E[m] = 0;
+            }
+        }
+    }
+
+    /// @brief The LU factorization, with partial pivoting, of T - Shift * I for one unreduced block.
+    /// @details Row swaps give U a second superdiagonal, so U is held as three diagonals. Pivots smaller than the perturbation are replaced by it, since a shift equal to an eigenvalue is exactly what inverse iteration wants.
+    class ShiftedTridiagonalLU
+    {
+    private:
+        std::vector<double> U0, U1, U2, L;
+        std::vector<char> Swapped;
+
+    public:
+        void Factor(const double* D, const double* E, size_t n, double Shift, double Perturbation)
+        {
+            U0.resize(n);
+            U1.assign(n, 0.0);
+            U2.assign(n, 0.0);
+            L.assign(n, 0.0);
+            Swapped.assign(n, 0);
+
+            for (size_t i = 0; i < n; i++)
+                U0[i] = D[i] - Shift;
+            if (n > 1) //E has n - 1 entries, so a 1x1 (or empty) matrix has none.
+                std::copy_n(E, n - 1, U1.begin());
+
+            for (size_t i = 0; i + 1 < n; i++)
+            {
+                double sub = E[i];
+                if (std::abs(U0[i]) >= std::abs(sub))
+                {
+                    L[i] = U0[i] == 0 ? 0 : sub / U0[i];
+                    U0[i + 1] -= L[i] * U1[i];
+                }
+                else
+                {
+                    double fac = U0[i] / sub, above = U1[i];
+                    Swapped[i] = 1;
+                    L[i] = fac;
+                    U0[i] = sub;
+                    U1[i] = U0[i + 1];
+                    U0[i + 1] = above - fac * U0[i + 1];
+                    if (i + 2 < n)
+                    {
+                        U2[i] = U1[i + 1];
+                        U1[i + 1] *= -fac;
+                    }
+                }
+            }
+
+            for (double& pivot : U0)
+                if (std::abs(pivot) < Perturbation)
+                    pivot = pivot < 0 ? -Perturbation : Perturbation;
+        }
+
+        void Solve(double* X) const noexcept
+        {
+            size_t n = U0.size();
+            for (size_t i = 0; i + 1 < n; i++)
+            {
+                if (Swapped[i])
+                    std::swap(X[i], X[i + 1]);
+                X[i + 1] -= L[i] * X[i];
+            }
+
+            X[n - 1] /= U0[n - 1];
+            if (n > 1)
+                X[n - 2] = (X[n - 2] - U1[n - 2] * X[n - 1]) / U0[n - 2];
+            for (size_t i = n - 2; i-- > 0; )
+                X[i] = (X[i] - U1[i] * X[i + 1] - U2[i] * X[i + 2]) / U0[i];
+        }
+    };
+}
+
+std::vector<double> TridiagonalEigen(const std::vector<double>& Diagonal, const std::vector<double>& OffDiagonal, size_t First, size_t Count, Matrix* Vectors)
+{
+    size_t n = Diagonal.size();
+    if (n == 0 || OffDiagonal.size() + 1 != n)
+        throw OperationError("eigen decomposition", "dimension mismatch");
+    if (First + Count > n)
+        throw OperationError("eigen decomposition", "more eigenvalues were requested than the matrix has");
+
+    auto rowNorm = [&](size_t i, size_t Start, size_t End)
+    {
+        double sum = std::abs(Diagonal[i]);
+        if (i > Start)
+            sum += std::abs(OffDiagonal[i - 1]);
+        if (i + 1 < End)
+            sum += std::abs(OffDiagonal[i]);
+        return sum;
+    };
+
+    double norm = 0;
+    for (size_t i = 0; i < n; i++)
+        norm = std::max(norm, rowNorm(i, 0, n));
+
+    //Split wherever an off-diagonal entry is no bigger than rounding error on the whole matrix.
+    double negligible = Epsilon * norm;
+    std::vector<UnreducedBlock> blocks;
+    for (size_t start = 0, i = 0; i < n; i++)
+    {
+        if (i + 1 == n || std::abs(OffDiagonal[i]) <= negligible)
+        {
+            double blockNorm = 0;
+            for (size_t r = start; r <= i; r++)
+                blockNorm = std::max(blockNorm, rowNorm(r, start, i + 1));
+
+            blocks.push_back({ start, i + 1 - start, blockNorm });
+            start = i + 1;
+        }
+    }
+
+    std::vector<double> d(Diagonal), e(n);
+    std::vector<TaggedEigenvalue> all;
+    all.reserve(n);
+    for (size_t b = 0; b < blocks.size(); b++)
+    {
+        auto [start, size, blockNorm] = blocks[b];
+        if (size > 1)
+        {
+            std::copy_n(OffDiagonal.begin() + static_cast<std::ptrdiff_t>(start), size - 1, e.begin() + static_cast<std::ptrdiff_t>(start));
+            ImplicitQL(d.data() + start, e.data() + start, size, Epsilon * blockNorm);
+        }
+
+        for (size_t i = start; i < start + size; i++)
+            all.push_back({ d[i], b });
+    }
+
+    std::stable_sort(all.begin(), all.end(), [](const TaggedEigenvalue& x, const TaggedEigenvalue& y) { return x.Value < y.Value; });
+
+    std::vector<double> values(Count);
+    for (size_t j = 0; j < Count; j++)
+        values[j] = all[First + j].Value;
+
+    if (!Vectors)
+        return values;
+
+    //Each eigenvector is zero outside of its own block, so the vectors are found block by block.
+    std::vector<std::vector<size_t>> columns(blocks.size());
+    for (size_t j = 0; j < Count; j++)
+        columns[all[First + j].Block].push_back(j);
+
+    const auto& simd = SimdKernels();
+    Matrix result(n, Count);
+    ShiftedTridiagonalLU lu;
+    std::mt19937_64 random(0x5eed);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+
+    for (size_t b = 0; b < blocks.size(); b++)
+    {
+        if (columns[b].empty())
+            continue;
+
+        auto [first, size, blockNorm] = blocks[b];
+        if (size == 1)
+        {
+            result.RowData(first)[columns[b][0]] = 1;
+            continue;
+        }
+
+        double clusterGap = ClusterTolerance * blockNorm;
+        double separation = 10 * Epsilon * blockNorm;
+        double perturbation = Epsilon * blockNorm;
+        //Once the solve grows the iterate by this much, the shift is close enough to an eigenvalue that the iterate has converged.
+        double growth = 1 / (std::sqrt(Epsilon) * blockNorm);
+
+        std::vector<std::vector<double>> cluster;
+        std::vector<double> x(size);
+        double previous = 0;
+        for (size_t k = 0; k < columns[b].size(); k++)
+        {
+            size_t column = columns[b][k];
+            double shift = values[column];
+            if (k > 0)
+            {
+                if (shift - previous > clusterGap)
+                    cluster.clear();
+                //Equal shifts would converge to the same vector, so they are pushed apart slightly.
+                if (shift - previous < separation)
+                    shift = previous + separation;
+            }
+            previous = shift;
+
+            lu.Factor(Diagonal.data() + first, OffDiagonal.data() + first, size, shift, perturbation);
+            for (double& element : x)
+                element = uniform(random);
+
+            bool converged = false;
+            for (unsigned iteration = 0; iteration < MaxInverseIterations; iteration++)
+            {
+                double scale = std::sqrt(simd.Dot(x.data(), x.data(), size));
+                simd.Divide(x.data(), scale, size);
+                lu.Solve(x.data());
+
+                //Twice, since most of the iterate can cancel when the cluster is large, and one pass would leave it only roughly orthogonal.
+                for (int pass = 0; pass < 2; pass++)
+                    for (const auto& member : cluster)
+                        simd.Axpy(x.data(), -simd.Dot(x.data(), member.data(), size), member.data(), size);
+
+                double length = std::sqrt(simd.Dot(x.data(), x.data(), size));
+                if (converged)
+                    break;
+                converged = length >= growth;
+            }
+
+            simd.Divide(x.data(), std::sqrt(simd.Dot(x.data(), x.data(), size)), size);
+            for (size_t i = 0; i < size; i++)
+                result.RowData(first + i)[column] = x[i];
+
+            cluster.push_back(x);
+        }
+    }
+
+    *Vectors = std::move(result);
+    return values;
+}
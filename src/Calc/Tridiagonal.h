@@ -0,0 +1,32 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_TRIDIAGONAL_H
+#define JASON_TRIDIAGONAL_H
+
+#include "Matrix.h"
+
+#include <vector>
+
+/*
+ * SYMMETRIC TRIDIAGONAL EIGENSOLVER
+ *
+ * The last stage of the dense symmetric eigensolver and the SVD, both of which first reduce their input to tridiagonal form
+ * with Householder reflectors. The matrix is first split wherever an off-diagonal entry is negligible, then:
+ *  - The eigenvalues of each unreduced block come from implicit QL with Wilkinson shifts, which is O(n^2) in total.
+ *  - The eigenvectors come from inverse iteration with the computed eigenvalues as shifts, which is O(n) per vector. Vectors
+ *    of eigenvalues that are close together are reorthogonalized against each other, since inverse iteration alone cannot
+ *    tell them apart.
+ * This avoids accumulating the QL rotations, which would cost O(n^3) with a large constant, and lets a subset of the
+ * eigenvectors cost proportionally less than all of them.
+ */
+
+/// @brief Computes eigenvalues First to First + Count - 1 (counting in ascending order) of a symmetric tridiagonal matrix.
+/// @param Diagonal The n diagonal entries.
+/// @param OffDiagonal The n - 1 entries beside the diagonal.
+/// @param Vectors If not null, receives the matching eigenvectors as the columns of an n x Count matrix.
+/// @return The eigenvalues, ascending. Throws OperationError if QL fails to converge.
+[[nodiscard]] std::vector<double> TridiagonalEigen(const std::vector<double>& Diagonal, const std::vector<double>& OffDiagonal, size_t First, size_t Count, Matrix* Vectors);
+
+#endif //JASON_TRIDIAGONAL_H
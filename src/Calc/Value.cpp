@@ -0,0 +1,436 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "Value.h"
+#include "../Core/Errors.h"
+
+#include <cmath>
+#include <utility>
+
+namespace
+{
+    template<typename T>
+    constexpr bool IsNumber = std::is_same_v<T, double> || std::is_same_v<T, std::complex<double>>;
+
+    Value ApplyScalars(char Operator, double One, double Two)
+    {
+        switch (Operator)
+        {
+            case '+':
+                return One + Two;
+            case '-':
+                return One - Two;
+            case '*':
+                return One * Two;
+            case '/':
+                if (Two == 0)
+                    throw OperatorError('/', Scalar(One), Scalar(Two), "Divide by zero");
+
+                return One / Two;
+            case '%':
+            {
+                long long a, b;
+                try
+                {
+                    a = Scalar(One).ToLongNoRound();
+                    b = Scalar(Two).ToLongNoRound();
+                }
+                catch (std::logic_error& e)
+                {
+                    throw OperatorError('%', Scalar(One), Scalar(Two), "one or both operands are not integers");
+                }
+
+                if (b == 0)
+                    throw OperatorError('%', Scalar(One), Scalar(Two), "Divide by zero");
+
+                return static_cast<double>(a % b);
+            }
+            case '^':
+                return std::pow(One, Two);
+            default:
+                throw OperatorError(Operator, Scalar(One), Scalar(Two));
+        }
+    }
+    Value ApplyComplex(char Operator, std::complex<double> One, std::complex<double> Two)
+    {
+        switch (Operator)
+        {
+            case '+':
+                return One + Two;
+            case '-':
+                return One - Two;
+            case '*':
+                return One * Two;
+            case '/':
+                if (Two == 0.0)
+                    throw OperatorError('/', Complex(One.real(), One.imag()), Complex(Two.real(), Two.imag()), "magnitude of second operand is zero");
+
+                return One / Two;
+            case '^':
+                return std::pow(One, Two);
+            default:
+                throw OperatorError(Operator, Complex(One.real(), One.imag()), Complex(Two.real(), Two.imag()));
+        }
+    }
+
+    unsigned long long MatrixExponent(const Matrix& Base, double Exponent)
+    {
+        long long converted;
+        try
+        {
+            converted = Scalar(Exponent).ToLongNoRound();
+        }
+        catch (std::logic_error& e)
+        {
+            throw OperatorError('^', Base, Scalar(Exponent), "Cannot raise matrix to a non-integer power.");
+        }
+
+        if (converted < 0)
+            throw OperatorError('^', Base, Scalar(Exponent), "Cannot raise matrix to a negative power.");
+
+        return static_cast<unsigned long long>(converted);
+    }
+}
+
+Value::Value(MathVector Item) : Data(std::make_shared<MathVector>(std::move(Item)))
+{
+
+}
+Value::Value(Matrix Item) : Data(std::make_shared<Matrix>(std::move(Item)))
+{
+
+}
+Value::Value(std::unique_ptr<VariableType>&& Item)
+{
+    if (!Item)
+        return;
+
+    switch (Item->GetType())
+    {
+        case VT_Scalar:
+            Data = static_cast<const Scalar&>(*Item).Data;
+            break;
+        case VT_Complex:
+        {
+            const auto& number = static_cast<const Complex&>(*Item);
+            Data = std::complex<double>(number.a, number.b);
+            break;
+        }
+        case VT_Vector:
+            Data = std::make_shared<MathVector>(std::move(static_cast<MathVector&>(*Item)));
+            break;
+        case VT_Matrix:
+            Data = std::make_shared<Matrix>(std::move(static_cast<Matrix&>(*Item)));
+            break;
+        default:
+            Data = OtherPtr(std::move(Item));
+            break;
+    }
+}
+
+Value Value::FromVariable(const VariableType& Item)
+{
+    switch (Item.GetType())
+    {
+        case VT_Scalar:
+            return static_cast<const Scalar&>(Item);
+        case VT_Complex:
+            return static_cast<const Complex&>(Item);
+        case VT_Vector:
+            return static_cast<const MathVector&>(Item);
+        case VT_Matrix:
+            return static_cast<const Matrix&>(Item);
+        default:
+            return Value(Item.Clone());
+    }
+}
+std::unique_ptr<VariableType> Value::ToVariable() const
+{
+    return Visit([]<typename T>(const T& Item) -> std::unique_ptr<VariableType>
+    {
+        if constexpr (std::is_same_v<T, std::monostate>)
+            return nullptr;
+        else if constexpr (std::is_same_v<T, double>)
+            return std::make_unique<Scalar>(Item);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            return std::make_unique<Complex>(Item.real(), Item.imag());
+        else
+            return Item.Clone();
+    });
+}
+
+unsigned Value::RequiredUnits(unsigned char UnitSize) const noexcept
+{
+    return Visit([UnitSize]<typename T>(const T& Item) -> unsigned
+    {
+        if constexpr (std::is_same_v<T, std::monostate>)
+            return 0;
+        else if constexpr (std::is_same_v<T, double>)
+            return Scalar(Item).RequiredUnits(UnitSize);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            return Complex(Item.real(), Item.imag()).RequiredUnits(UnitSize);
+        else
+            return Item.RequiredUnits(UnitSize);
+    });
+}
+std::vector<Unit> Value::ToBinary(unsigned char UnitSize) const
+{
+    return Visit([UnitSize]<typename T>(const T& Item) -> std::vector<Unit>
+    {
+        if constexpr (std::is_same_v<T, std::monostate>)
+            return {};
+        else if constexpr (std::is_same_v<T, double>)
+            return Scalar(Item).ToBinary(UnitSize);
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            return Complex(Item.real(), Item.imag()).ToBinary(UnitSize);
+        else
+            return Item.ToBinary(UnitSize);
+    });
+}
+Value Value::FromBinary(const std::vector<Unit>& Units, VariableTypes Expected)
+{
+    return Value(VariableType::FromBinary(Units, Expected));
+}
+
+VariableTypes Value::GetType() const
+{
+    return Visit([]<typename T>(const T& Item) -> VariableTypes
+    {
+        if constexpr (std::is_same_v<T, std::monostate>)
+            throw std::logic_error("This value is empty");
+        else if constexpr (std::is_same_v<T, double>)
+            return VT_Scalar;
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            return VT_Complex;
+        else
+            return Item.GetType();
+    });
+}
+std::string Value::GetTypeString() const
+{
+    return Visit([]<typename T>(const T& Item) -> std::string
+    {
+        if constexpr (std::is_same_v<T, std::monostate>)
+            return "(Empty)";
+        else if constexpr (std::is_same_v<T, double>)
+            return Scalar(Item).GetTypeString();
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            return Complex(Item.real(), Item.imag()).GetTypeString();
+        else
+            return Item.GetTypeString();
+    });
+}
+
+double Value::AsScalar() const
+{
+    if (const double* item = std::get_if<double>(&Data))
+        return *item;
+
+    throw OperationError("read scalar", "the value is " + GetTypeString());
+}
+Complex Value::AsComplex() const
+{
+    if (const double* item = std::get_if<double>(&Data))
+        return { *item, 0.0 };
+    if (const auto* item = std::get_if<std::complex<double>>(&Data))
+        return { item->real(), item->imag() };
+
+    throw OperationError("read complex", "the value is " + GetTypeString());
+}
+const MathVector& Value::AsVector() const
+{
+    if (const VectorPtr* item = std::get_if<VectorPtr>(&Data))
+        return **item;
+
+    throw OperationError("read vector", "the value is " + GetTypeString());
+}
+const Matrix& Value::AsMatrix() const
+{
+    if (const MatrixPtr* item = std::get_if<MatrixPtr>(&Data))
+        return **item;
+
+    throw OperationError("read matrix", "the value is " + GetTypeString());
+}
+MathVector& Value::MutableVector()
+{
+    VectorPtr* item = std::get_if<VectorPtr>(&Data);
+    if (!item)
+        throw OperationError("write vector", "the value is " + GetTypeString());
+
+    if (item->use_count() != 1)
+        *item = std::make_shared<MathVector>(**item);
+
+    return **item;
+}
+Matrix& Value::MutableMatrix()
+{
+    MatrixPtr* item = std::get_if<MatrixPtr>(&Data);
+    if (!item)
+        throw OperationError("write matrix", "the value is " + GetTypeString());
+
+    if (item->use_count() != 1)
+        *item = std::make_shared<Matrix>(**item);
+
+    return **item;
+}
+bool Value::IsUnique() const noexcept
+{
+    if (const VectorPtr* item = std::get_if<VectorPtr>(&Data))
+        return item->use_count() == 1;
+    if (const MatrixPtr* item = std::get_if<MatrixPtr>(&Data))
+        return item->use_count() == 1;
+
+    return false;
+}
+
+Value Value::Apply(char Operator, Value One, const Value& Two)
+{
+    /*
+     * The supported combinations are the ones the calculator has always had:
+     *  1. Number op Number, for +, -, *, / and ^ (and % on integral scalars). A complex operand makes the result complex.
+     *  2. Vector +/- Vector, Vector * Scalar, Scalar * Vector, Vector / Scalar
+     *  3. Matrix +/- Matrix, Matrix * Matrix, Matrix * Scalar, Scalar * Matrix, Matrix / Scalar
+     *  4. Matrix * Vector and Matrix +/- Vector (and Vector +/- Matrix), treating the vector as a column matrix
+     *  5. Matrix ^ Scalar, for non-negative integer powers
+     * When One owns its buffer, compound assignment writes the result into it instead of allocating.
+     */
+    return std::visit([&]<typename A, typename B>(const A& a, const B& b) -> Value
+    {
+        if constexpr (std::is_same_v<A, double> && std::is_same_v<B, double>)
+            return ApplyScalars(Operator, a, b);
+        else if constexpr (IsNumber<A> && IsNumber<B>)
+            return ApplyComplex(Operator, a, b);
+        else if constexpr (std::is_same_v<A, VectorPtr> && std::is_same_v<B, VectorPtr>)
+        {
+            if (Operator == '+')
+                One.MutableVector() += *b;
+            else if (Operator == '-')
+                One.MutableVector() -= *b;
+            else
+                throw OperatorError(Operator, *a, *b);
+
+            return std::move(One);
+        }
+        else if constexpr (std::is_same_v<A, VectorPtr> && std::is_same_v<B, double>)
+        {
+            if (Operator == '*')
+                One.MutableVector() *= b;
+            else if (Operator == '/')
+                One.MutableVector() /= b;
+            else
+                throw OperatorError(Operator, *a, Scalar(b));
+
+            return std::move(One);
+        }
+        else if constexpr (std::is_same_v<A, double> && std::is_same_v<B, VectorPtr>)
+        {
+            if (Operator != '*')
+                throw OperatorError(Operator, Scalar(a), *b);
+
+            return MathVector(*b * a);
+        }
+        else if constexpr (std::is_same_v<A, MatrixPtr> && std::is_same_v<B, MatrixPtr>)
+        {
+            switch (Operator)
+            {
+                case '+':
+                    One.MutableMatrix() += *b;
+                    return std::move(One);
+                case '-':
+                    One.MutableMatrix() -= *b;
+                    return std::move(One);
+                case '*':
+                    return *a * *b;
+                default:
+                    throw OperatorError(Operator, *a, *b);
+            }
+        }
+        else if constexpr (std::is_same_v<A, MatrixPtr> && std::is_same_v<B, double>)
+        {
+            switch (Operator)
+            {
+                case '*':
+                    One.MutableMatrix() *= b;
+                    return std::move(One);
+                case '/':
+                    One.MutableMatrix() /= b;
+                    return std::move(One);
+                case '^':
+                    return a->Pow(MatrixExponent(*a, b));
+                default:
+                    throw OperatorError(Operator, *a, Scalar(b));
+            }
+        }
+        else if constexpr (std::is_same_v<A, double> && std::is_same_v<B, MatrixPtr>)
+        {
+            if (Operator != '*')
+                throw OperatorError(Operator, Scalar(a), *b);
+
+            return Matrix(*b * a);
+        }
+        else if constexpr (std::is_same_v<A, MatrixPtr> && std::is_same_v<B, VectorPtr>)
+        {
+            switch (Operator)
+            {
+                case '+':
+                    One.MutableMatrix() += Matrix(*b);
+                    return std::move(One);
+                case '-':
+                    One.MutableMatrix() -= Matrix(*b);
+                    return std::move(One);
+                case '*':
+                    return *a * Matrix(*b);
+                default:
+                    throw OperatorError(Operator, *a, *b);
+            }
+        }
+        else if constexpr (std::is_same_v<A, VectorPtr> && std::is_same_v<B, MatrixPtr>)
+        {
+            if (Operator == '+')
+                return Matrix(Matrix(*a) + *b);
+            else if (Operator == '-')
+                return Matrix(Matrix(*a) - *b);
+            else
+                throw OperatorError(Operator, *a, *b);
+        }
+        else
+            throw OperatorError(Operator, One.GetTypeString(), Two.GetTypeString());
+    }, One.Data, Two.Data);
+}
+
+bool Value::operator==(const Value& Two) const noexcept
+{
+    if (this->Data.index() != Two.Data.index())
+        return false;
+
+    return std::visit([&]<typename T>(const T& a) -> bool
+    {
+        const T& b = std::get<T>(Two.Data);
+        if constexpr (std::is_same_v<T, std::monostate> || std::is_same_v<T, double> || std::is_same_v<T, std::complex<double>>)
+            return a == b;
+        else
+            return a == b || *a == *b;
+    }, this->Data);
+}
+bool Value::operator!=(const Value& Two) const noexcept
+{
+    return !(*this == Two);
+}
+
+std::ostream& operator<<(std::ostream& out, const Value& Obj)
+{
+    Obj.Visit([&out]<typename T>(const T& Item)
+    {
+        if constexpr (std::is_same_v<T, std::monostate>)
+            out << "NULL";
+        else if constexpr (std::is_same_v<T, double>)
+            out << display_print(Scalar(Item));
+        else if constexpr (std::is_same_v<T, std::complex<double>>)
+            out << display_print(Complex(Item.real(), Item.imag()));
+        else
+            out << display_print(Item);
+    });
+
+    return out;
+}
@@ -0,0 +1,142 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_VALUE_H
+#define JASON_VALUE_H
+
+#include "VariableType.h"
+#include "Scalar.h"
+#include "Complex.h"
+#include "MathVector.h"
+#include "Matrix.h"
+
+#include <complex>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+/// <summary>
+/// A calculator value, held by value instead of behind a std::unique_ptr&lt;VariableType&gt;.
+/// Scalars and complex numbers are stored inline, so passing them around needs no allocation and no virtual calls.
+/// Vectors and matrices are reference counted and copy-on-write: copying a Value shares the buffer, and the buffer is only duplicated when a shared value is modified.
+/// Any other VariableType (such as SparseMatrix) is kept as a shared, immutable object so that it can still pass through.
+/// A default constructed Value is empty, which stands for "no data".
+/// </summary>
+class Value
+{
+public:
+    using VectorPtr = std::shared_ptr<MathVector>;
+    using MatrixPtr = std::shared_ptr<Matrix>;
+    using OtherPtr = std::shared_ptr<const VariableType>;
+    using Storage = std::variant<std::monostate, double, std::complex<double>, VectorPtr, MatrixPtr, OtherPtr>;
+
+private:
+    Storage Data;
+
+public:
+    Value() noexcept = default;
+    Value(double Item) noexcept : Data(Item) { }
+    Value(const Scalar& Item) noexcept : Data(Item.Data) { }
+    Value(std::complex<double> Item) noexcept : Data(Item) { }
+    Value(const Complex& Item) noexcept : Data(std::complex<double>(Item.a, Item.b)) { }
+    Value(MathVector Item);
+    Value(Matrix Item);
+    /// <summary>
+    /// Takes ownership of a heap allocated VariableType. Numeric types are moved into place, so nothing is copied.
+    /// </summary>
+    explicit Value(std::unique_ptr<VariableType>&& Item);
+
+    /// <summary>
+    /// Copies any VariableType into a value.
+    /// </summary>
+    [[nodiscard]] static Value FromVariable(const VariableType& Item);
+    /// <summary>
+    /// Copies the value back out as a VariableType, for code that still works with those. Returns nullptr for an empty value.
+    /// </summary>
+    [[nodiscard]] std::unique_ptr<VariableType> ToVariable() const;
+
+    /// <summary>
+    /// The number of units of UnitSize bytes that ToBinary fills. Zero for an empty value.
+    /// </summary>
+    [[nodiscard]] unsigned RequiredUnits(unsigned char UnitSize) const noexcept;
+    /// <summary>
+    /// Writes the value in the VariableType binary format, directly from its storage. An empty value writes no units.
+    /// </summary>
+    [[nodiscard]] std::vector<Unit> ToBinary(unsigned char UnitSize) const;
+    /// <summary>
+    /// Reads a value written by ToBinary (or VariableType::ToBinary). Throws FormatError if the data is malformed, or its type is not Expected.
+    /// </summary>
+    [[nodiscard]] static Value FromBinary(const std::vector<Unit>& Units, VariableTypes Expected);
+
+    [[nodiscard]] bool IsEmpty() const noexcept { return std::holds_alternative<std::monostate>(Data); }
+    [[nodiscard]] bool IsScalar() const noexcept { return std::holds_alternative<double>(Data); }
+    [[nodiscard]] bool IsComplex() const noexcept { return std::holds_alternative<std::complex<double>>(Data); }
+    [[nodiscard]] bool IsVector() const noexcept { return std::holds_alternative<VectorPtr>(Data); }
+    [[nodiscard]] bool IsMatrix() const noexcept { return std::holds_alternative<MatrixPtr>(Data); }
+
+    /// <summary>
+    /// The type of the value. Throws if the value is empty.
+    /// </summary>
+    [[nodiscard]] VariableTypes GetType() const;
+    [[nodiscard]] std::string GetTypeString() const;
+
+    /// <summary>
+    /// The scalar held. Throws if the value is not a scalar.
+    /// </summary>
+    [[nodiscard]] double AsScalar() const;
+    /// <summary>
+    /// The number held, with scalars promoted to complex. Throws if the value is not a number.
+    /// </summary>
+    [[nodiscard]] Complex AsComplex() const;
+    [[nodiscard]] const MathVector& AsVector() const;
+    [[nodiscard]] const Matrix& AsMatrix() const;
+    /// <summary>
+    /// Write access to the vector held. If the buffer is shared with other values, it is copied first, so the others do not change.
+    /// </summary>
+    [[nodiscard]] MathVector& MutableVector();
+    /// <summary>
+    /// Write access to the matrix held. If the buffer is shared with other values, it is copied first, so the others do not change.
+    /// </summary>
+    [[nodiscard]] Matrix& MutableMatrix();
+    /// <summary>
+    /// True if this value owns its vector or matrix buffer alone, so writing to it will not copy.
+    /// </summary>
+    [[nodiscard]] bool IsUnique() const noexcept;
+
+    /// <summary>
+    /// Calls Visitor with the contents of the value: std::monostate, double, std::complex&lt;double&gt;, const MathVector&amp;, const Matrix&amp;, or const VariableType&amp;.
+    /// </summary>
+    template<typename F>
+    decltype(auto) Visit(F&& Visitor) const
+    {
+        return std::visit([&](const auto& Item) -> decltype(auto)
+        {
+            using T = std::decay_t<decltype(Item)>;
+            if constexpr (std::is_same_v<T, VectorPtr> || std::is_same_v<T, MatrixPtr> || std::is_same_v<T, OtherPtr>)
+                return Visitor(*Item);
+            else
+                return Visitor(Item);
+        }, Data);
+    }
+
+    /// <summary>
+    /// Applies a binary calculator operator (+, -, *, /, % or ^). One is taken by value, so that when the caller passes a temporary that owns its buffer, the result is computed in that buffer.
+    /// Throws OperatorError if the operator is not defined for the two types.
+    /// </summary>
+    [[nodiscard]] static Value Apply(char Operator, Value One, const Value& Two);
+
+    Value operator+(const Value& Two) const { return Apply('+', *this, Two); }
+    Value operator-(const Value& Two) const { return Apply('-', *this, Two); }
+    Value operator*(const Value& Two) const { return Apply('*', *this, Two); }
+    Value operator/(const Value& Two) const { return Apply('/', *this, Two); }
+
+    bool operator==(const Value& Two) const noexcept;
+    bool operator!=(const Value& Two) const noexcept;
+};
+
+std::ostream& operator<<(std::ostream& out, const Value& Obj);
+
+#endif //JASON_VALUE_H
@@ -9,6 +9,7 @@
 #include "Complex.h"
 #include "MathVector.h"
 #include "Matrix.h"
+#include "SparseMatrix.h"
 
 #include "../Core/Errors.h"
 
@@ -17,6 +18,69 @@ std::string VariableType::GetTypeString() const noexcept
     return static_cast<const DebugPrint&>(*this).dbg_fmt_string(); 
 }
 
+unsigned VariableType::RequiredUnits(unsigned char UnitSize) const noexcept
+{
+    if (UnitSize == 0)
+        return 0;
+
+    return static_cast<unsigned>((BinaryHeaderSize + this->bin_size() + UnitSize - 1) / UnitSize);
+}
+std::vector<Unit> VariableType::ToBinary(unsigned char UnitSize) const
+{
+    size_t payload = this->bin_size();
+    BinaryWriter out(UnitSize, BinaryHeaderSize + payload);
+    out.Write<uint8_t>(BinaryFormatVersion);
+    out.Write<uint8_t>(static_cast<uint8_t>(this->GetType()));
+    out.Write<uint64_t>(payload);
+
+    this->bin_serialize(out);
+    return std::move(out).Release();
+}
+std::unique_ptr<VariableType> VariableType::FromBinary(const std::vector<Unit>& Units, VariableTypes Expected)
+{
+    BinaryReader in(Units);
+    auto version = in.Read<uint8_t>();
+    if (version != BinaryFormatVersion)
+        throw FormatError("binary data", "unsupported format version " + std::to_string(version));
+
+    auto type = static_cast<VariableTypes>(in.Read<uint8_t>());
+    if (type != Expected)
+        throw FormatError("binary data", "type mismatch");
+
+    auto length = in.Read<uint64_t>();
+    if (length > in.Remaining())
+        throw FormatError("binary data", "the payload is truncated");
+
+    std::unique_ptr<VariableType> result;
+    switch (type)
+    {
+        case VT_Scalar:
+            result = std::make_unique<Scalar>();
+            break;
+        case VT_Vector:
+            result = std::make_unique<MathVector>();
+            break;
+        case VT_Matrix:
+            result = std::make_unique<Matrix>(Matrix::ErrorMatrix());
+            break;
+        case VT_Complex:
+            result = std::make_unique<Complex>();
+            break;
+        case VT_Sparse:
+            result = std::make_unique<SparseMatrix>();
+            break;
+        default:
+            throw FormatError("binary data", "invalid type");
+    }
+
+    size_t before = in.Remaining();
+    result->bin_deserialize(in);
+    if (before - in.Remaining() != length)
+        throw FormatError("binary data", "the payload length does not match its contents");
+
+    return result;
+}
+
 /*
 std::unique_ptr<VariableType> VariableType::ApplyOperation(const VariableType& One, const VariableType& Two, char oper)
 {
@@ -186,6 +250,9 @@ std::ostream& operator<<(std::ostream& out, const VariableTypes& obj)
 {
     switch (obj)
     {
+        case VT_None:
+            out << "NON";
+            break;
         case VT_Scalar:
             out << "SCA";
             break;
@@ -198,6 +265,9 @@ std::ostream& operator<<(std::ostream& out, const VariableTypes& obj)
         case VT_Complex:
             out << "CMP";
             break;
+        case VT_Sparse:
+            out << "SPR";
+            break;
     }
     
     return out;
@@ -210,7 +280,9 @@ std::istream& operator>>(std::istream& in, VariableTypes& obj)
     
     str = r_str;
     
-    if (str == "SCA")
+    if (str == "NON")
+        obj = VT_None;
+    else if (str == "SCA")
         obj = VT_Scalar;
     else if (str == "MAT")
         obj = VT_Matrix;
@@ -218,8 +290,10 @@ std::istream& operator>>(std::istream& in, VariableTypes& obj)
         obj = VT_Vector;
     else if (str == "CMP")
         obj = VT_Complex;
+    else if (str == "SPR")
+        obj = VT_Sparse;
     else
-        throw FormatError(str, "invalid option (expected SCA, MAT, VEC, or CMP)");
+        throw FormatError(str, "invalid option (expected NON, SCA, MAT, VEC, CMP, or SPR)");
     
     return in;
 }
@@ -10,26 +10,54 @@
 #include <string>
 #include <optional>
 #include <memory>
+#include <vector>
 
-#include "../Core/BinaryUnit.h"
+#include "../Core/Serialize.h"
 #include "../Core/Log.h"
 
 enum VariableTypes
 {
+    VT_None = 0,
     VT_Scalar = 1,
     VT_Vector = 2,
     VT_Matrix = 3,
     VT_Complex = 4,
+    VT_Sparse = 5,
 };
 std::ostream& operator<<(std::ostream& out, const VariableTypes& obj);
 std::istream& operator>>(std::istream& in, VariableTypes& obj);
 
-class VariableType : public DebugPrint, public DisplayPrint, public StringSerializable
+/*
+ * Binary format
+ *
+ * ToBinary writes a 10 byte header, then the payload from bin_serialize, all little-endian:
+ *  - byte 0: the format version, BinaryFormatVersion
+ *  - byte 1: the VariableTypes value
+ *  - bytes 2 to 9: the payload length in bytes, as a 64-bit unsigned integer
+ * The payloads are:
+ *  - Scalar: the value, as a 64-bit IEEE double
+ *  - Complex: the real part, then the imaginary part
+ *  - MathVector: the dimension (u64), then every component
+ *  - Matrix: rows and columns (u64 each), then the elements row by row, without the row padding
+ *  - SparseMatrix: rows and columns (u64 each), the format (u8), the entry count (u64), then the offsets, indices (u64 each) and values
+ * Doubles are copied bit for bit, so values survive a save and load exactly. Any padding after the payload is ignored.
+ */
+constexpr unsigned char BinaryFormatVersion = 1;
+constexpr size_t BinaryHeaderSize = 10;
+
+class VariableType : public DebugPrint, public DisplayPrint, public StringSerializable, public BinarySerializable
 {
 public:
     [[nodiscard]] virtual VariableTypes GetType() const noexcept = 0;
     [[nodiscard]] virtual std::unique_ptr<VariableType> Clone() const noexcept = 0;
     [[nodiscard]] std::string GetTypeString() const noexcept;
+
+    /// @brief The number of units of UnitSize bytes that ToBinary fills.
+    [[nodiscard]] unsigned RequiredUnits(unsigned char UnitSize) const noexcept;
+    /// @brief Writes the header and payload directly into units of UnitSize bytes.
+    [[nodiscard]] std::vector<Unit> ToBinary(unsigned char UnitSize) const;
+    /// @brief Reads a value written by ToBinary. Throws FormatError if the data is truncated or malformed, or if its type is not Expected.
+    [[nodiscard]] static std::unique_ptr<VariableType> FromBinary(const std::vector<Unit>& Units, VariableTypes Expected);
     
     // [[nodiscard]] static std::unique_ptr<VariableType> ApplyOperation(const VariableType& One, const VariableType& Two, char oper);
 
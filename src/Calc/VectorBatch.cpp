@@ -0,0 +1,231 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "VectorBatch.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <utility>
+
+VectorBatch::VectorBatch(size_t Dim, size_t Count) : Components(Dim, Count)
+{
+
+}
+VectorBatch::VectorBatch(Matrix&& Columns) : Components(std::move(Columns))
+{
+
+}
+VectorBatch::VectorBatch(const Matrix& Columns) : Components(Columns)
+{
+
+}
+
+VectorBatch VectorBatch::FromVectors(const std::vector<MathVector>& Vectors)
+{
+    if (Vectors.empty())
+        return VectorBatch(Matrix::ErrorMatrix());
+
+    size_t dim = Vectors.front().Dim();
+    VectorBatch result(dim, Vectors.size());
+    for (size_t i = 0; i < Vectors.size(); i++)
+    {
+        if (Vectors[i].Dim() != dim)
+            throw OperationError("vector batch", "all vectors must have the same dimension");
+
+        const double* src = Vectors[i].data();
+        for (size_t c = 0; c < dim; c++)
+            result.Components.RowData(c)[i] = src[c];
+    }
+
+    return result;
+}
+std::vector<MathVector> VectorBatch::ToVectors() const
+{
+    std::vector<MathVector> result;
+    result.reserve(Count());
+    for (size_t i = 0; i < Count(); i++)
+        result.push_back(Get(i));
+
+    return result;
+}
+Matrix VectorBatch::ToMatrix() &&
+{
+    return std::move(Components);
+}
+
+MathVector VectorBatch::Get(size_t i) const
+{
+    if (i >= Count())
+        throw std::logic_error("Out of range");
+
+    MathVector result(Dim());
+    double* dest = result.data();
+    for (size_t c = 0; c < Dim(); c++)
+        dest[c] = Components.RowData(c)[i];
+
+    return result;
+}
+void VectorBatch::Set(size_t i, const MathVector& Value)
+{
+    if (i >= Count())
+        throw std::logic_error("Out of range");
+    if (Value.Dim() != Dim())
+        throw OperationError("vector batch", "dimension mismatch");
+
+    const double* src = Value.data();
+    for (size_t c = 0; c < Dim(); c++)
+        Components.RowData(c)[i] = src[c];
+}
+
+void VectorBatch::RequireSameShape(const VectorBatch& Other, const char* Action) const
+{
+    if (!IsValid() || !Other.IsValid())
+        throw OperationError(Action, "empty vector batch");
+    if (Dim() != Other.Dim() || Count() != Other.Count())
+        throw OperationError(Action, "dimension mismatch");
+}
+
+VectorBatch VectorBatch::operator+(const VectorBatch& Other) const
+{
+    VectorBatch result(*this);
+    result += Other;
+    return result;
+}
+VectorBatch VectorBatch::operator-(const VectorBatch& Other) const
+{
+    VectorBatch result(*this);
+    result -= Other;
+    return result;
+}
+VectorBatch VectorBatch::operator*(double Fac) const
+{
+    VectorBatch result(*this);
+    result *= Fac;
+    return result;
+}
+VectorBatch VectorBatch::operator/(double Fac) const
+{
+    VectorBatch result(*this);
+    result /= Fac;
+    return result;
+}
+
+VectorBatch& VectorBatch::operator+=(const VectorBatch& Other)
+{
+    RequireSameShape(Other, "vector batch addition");
+
+    const auto& simd = SimdKernels();
+    for (size_t c = 0; c < Dim(); c++)
+        simd.Add(Components.RowData(c), Other.Components.RowData(c), Count());
+
+    return *this;
+}
+VectorBatch& VectorBatch::operator-=(const VectorBatch& Other)
+{
+    RequireSameShape(Other, "vector batch subtraction");
+
+    const auto& simd = SimdKernels();
+    for (size_t c = 0; c < Dim(); c++)
+        simd.Subtract(Components.RowData(c), Other.Components.RowData(c), Count());
+
+    return *this;
+}
+VectorBatch& VectorBatch::operator*=(double Fac)
+{
+    const auto& simd = SimdKernels();
+    for (size_t c = 0; c < Dim(); c++)
+        simd.Scale(Components.RowData(c), Fac, Count());
+
+    return *this;
+}
+VectorBatch& VectorBatch::operator/=(double Fac)
+{
+    const auto& simd = SimdKernels();
+    for (size_t c = 0; c < Dim(); c++)
+        simd.Divide(Components.RowData(c), Fac, Count());
+
+    return *this;
+}
+VectorBatch& VectorBatch::AddScaled(const VectorBatch& Other, double Fac)
+{
+    RequireSameShape(Other, "vector batch addition");
+
+    const auto& simd = SimdKernels();
+    for (size_t c = 0; c < Dim(); c++)
+        simd.Axpy(Components.RowData(c), Fac, Other.Components.RowData(c), Count());
+
+    return *this;
+}
+
+std::vector<double> VectorBatch::DotProduct(const VectorBatch& One, const VectorBatch& Two)
+{
+    One.RequireSameShape(Two, "dot");
+
+    const auto& simd = SimdKernels();
+    std::vector<double> result(One.Count(), 0.0);
+    for (size_t s = 0; s < One.Count(); s += ChunkSize)
+    {
+        size_t len = std::min(ChunkSize, One.Count() - s);
+        for (size_t c = 0; c < One.Dim(); c++)
+            simd.MultiplyAdd(result.data() + s, One.Components.RowData(c) + s, Two.Components.RowData(c) + s, len);
+    }
+
+    return result;
+}
+VectorBatch VectorBatch::CrossProduct(const VectorBatch& One, const VectorBatch& Two)
+{
+    One.RequireSameShape(Two, "cross");
+    if (One.Dim() != 2 && One.Dim() != 3)
+        throw OperationError("cross", "cross is only defined for d={2,3}");
+
+    const auto& simd = SimdKernels();
+    const size_t count = One.Count();
+    VectorBatch result(3, count);
+    double* x = result.Components.RowData(0), * y = result.Components.RowData(1), * z = result.Components.RowData(2);
+    const double* ax = One.Components.RowData(0), * ay = One.Components.RowData(1);
+    const double* bx = Two.Components.RowData(0), * by = Two.Components.RowData(1);
+
+    //z = ax*by - ay*bx is shared by both cases. In 2D the x and y rows stay zero.
+    simd.MultiplyAdd(z, ax, by, count);
+    simd.MultiplySubtract(z, ay, bx, count);
+    if (One.Dim() == 3)
+    {
+        const double* az = One.Components.RowData(2), * bz = Two.Components.RowData(2);
+        simd.MultiplyAdd(x, ay, bz, count);
+        simd.MultiplySubtract(x, az, by, count);
+        simd.MultiplyAdd(y, az, bx, count);
+        simd.MultiplySubtract(y, ax, bz, count);
+    }
+
+    return result;
+}
+std::vector<double> VectorBatch::Magnitudes() const
+{
+    std::vector<double> result = DotProduct(*this, *this);
+    SimdKernels().Sqrt(result.data(), result.size());
+    return result;
+}
+void VectorBatch::Normalize()
+{
+    if (!IsValid())
+        return;
+
+    const auto& simd = SimdKernels();
+    std::vector<double> norms(std::min(ChunkSize, Count()));
+    for (size_t s = 0; s < Count(); s += ChunkSize)
+    {
+        size_t len = std::min(ChunkSize, Count() - s);
+        std::fill_n(norms.data(), len, 0.0);
+        for (size_t c = 0; c < Dim(); c++)
+        {
+            const double* row = Components.RowData(c) + s;
+            simd.MultiplyAdd(norms.data(), row, row, len);
+        }
+        simd.Sqrt(norms.data(), len);
+        std::replace(norms.begin(), norms.begin() + static_cast<std::ptrdiff_t>(len), 0.0, 1.0); //Leaves zero vectors at zero, instead of 0/0.
+
+        for (size_t c = 0; c < Dim(); c++)
+            simd.DivideElements(Components.RowData(c) + s, norms.data(), len);
+    }
+}
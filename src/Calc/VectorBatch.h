@@ -0,0 +1,117 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_VECTORBATCH_H
+#define JASON_VECTORBATCH_H
+
+#include "Matrix.h"
+#include "MathVector.h"
+
+#include <vector>
+
+/// <summary>
+/// Many vectors of the same dimension, stored as a structure of arrays: component c of every vector lives in one contiguous, aligned row.
+/// Each operation then runs the SIMD kernels along those rows, instead of doing a handful of flops per separately allocated MathVector.
+/// The storage is a Dim() x Count() Matrix whose columns are the vectors, so a matrix of column points can be adopted or handed back without copying.
+/// </summary>
+class VectorBatch
+{
+private:
+    /// <summary>
+    /// Row c holds component c of every vector, column i is vector i.
+    /// </summary>
+    Matrix Components;
+
+    void RequireSameShape(const VectorBatch& Other, const char* Action) const;
+
+public:
+    /// <summary>
+    /// The number of vectors processed at once by the operations that combine several components per vector. The partial results for one chunk stay in L1 cache while each component row streams past.
+    /// </summary>
+    static constexpr size_t ChunkSize = 2048;
+
+    /// <summary>
+    /// Creates Count zero vectors of dimension Dim.
+    /// </summary>
+    VectorBatch(size_t Dim, size_t Count);
+    /// <summary>
+    /// Takes over a matrix whose columns are the vectors, without copying it.
+    /// </summary>
+    explicit VectorBatch(Matrix&& Columns);
+    /// <summary>
+    /// Copies the vectors of a matrix whose columns are the vectors.
+    /// </summary>
+    explicit VectorBatch(const Matrix& Columns);
+
+    /// <summary>
+    /// Gathers a list of vectors into a batch. Throws if the vectors do not share one dimension.
+    /// </summary>
+    [[nodiscard]] static VectorBatch FromVectors(const std::vector<MathVector>& Vectors);
+    [[nodiscard]] std::vector<MathVector> ToVectors() const;
+
+    /// <summary>
+    /// The batch as a matrix whose columns are the vectors.
+    /// </summary>
+    [[nodiscard]] const Matrix& AsMatrix() const noexcept { return Components; }
+    /// <summary>
+    /// Releases the storage as a matrix whose columns are the vectors, without copying it. The batch is left empty.
+    /// </summary>
+    [[nodiscard]] Matrix ToMatrix() &&;
+
+    [[nodiscard]] size_t Dim() const noexcept { return Components.Rows(); }
+    [[nodiscard]] size_t Count() const noexcept { return Components.Columns(); }
+    [[nodiscard]] bool IsValid() const noexcept { return Components.IsValid(); }
+
+    /// <summary>
+    /// Component c of every vector, as a contiguous array of Count() doubles.
+    /// </summary>
+    [[nodiscard]] const double* Component(size_t c) const noexcept { return Components.RowData(c); }
+    [[nodiscard]] double* Component(size_t c) noexcept { return Components.RowData(c); }
+    [[nodiscard]] ConstMatrixView View() const noexcept { return Components.View(); }
+    [[nodiscard]] MatrixView View() noexcept { return Components.View(); }
+    /// <summary>
+    /// Vector i, viewed in place as a Dim() x 1 strided column.
+    /// </summary>
+    [[nodiscard]] ConstMatrixView Point(size_t i) const { return Components.Column(i); }
+    [[nodiscard]] MatrixView Point(size_t i) { return Components.Column(i); }
+
+    /// <summary>
+    /// Copies vector i out of the batch.
+    /// </summary>
+    [[nodiscard]] MathVector Get(size_t i) const;
+    /// <summary>
+    /// Overwrites vector i. Throws if the dimension does not match.
+    /// </summary>
+    void Set(size_t i, const MathVector& Value);
+
+    VectorBatch operator+(const VectorBatch& Other) const;
+    VectorBatch operator-(const VectorBatch& Other) const;
+    VectorBatch operator*(double Fac) const;
+    VectorBatch operator/(double Fac) const;
+
+    VectorBatch& operator+=(const VectorBatch& Other);
+    VectorBatch& operator-=(const VectorBatch& Other);
+    VectorBatch& operator*=(double Fac);
+    VectorBatch& operator/=(double Fac);
+    /// <summary>
+    /// Computes this += Fac * Other in a single pass.
+    /// </summary>
+    VectorBatch& AddScaled(const VectorBatch& Other, double Fac);
+
+    /// <summary>
+    /// The dot product of each pair of vectors, One[i] . Two[i].
+    /// </summary>
+    [[nodiscard]] static std::vector<double> DotProduct(const VectorBatch& One, const VectorBatch& Two);
+    /// <summary>
+    /// The cross product of each pair of vectors, One[i] x Two[i]. The batches must be 2D or 3D, and the result is always 3D, as with MathVector::CrossProduct.
+    /// </summary>
+    [[nodiscard]] static VectorBatch CrossProduct(const VectorBatch& One, const VectorBatch& Two);
+    [[nodiscard]] std::vector<double> Magnitudes() const;
+    /// <summary>
+    /// Scales every vector to unit length. Zero vectors are left as they are.
+    /// </summary>
+    void Normalize();
+};
+
+#endif //JASON_VECTORBATCH_H
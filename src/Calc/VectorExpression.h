@@ -0,0 +1,231 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_VECTOREXPRESSION_H
+#define JASON_VECTOREXPRESSION_H
+
+#include "MathVector.h"
+#include "ExpressionOperators.h"
+#include "../Core/Errors.h"
+
+#include <algorithm>
+#include <concepts>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Lazy element-wise arithmetic for MathVector, following MatrixExpression.h.
+ *
+ * Vectors of different dimensions can be added and subtracted, with the shorter one treated as zero past its end. Each node therefore knows both
+ * its dimension (the longest operand), and its overlap (the shortest operand). Elements inside the overlap are computed without bounds checks,
+ * so that loop vectorizes, and only the remaining elements check each operand's length.
+ */
+
+/// <summary>
+/// The base of every lazy vector expression. Derived types provide Dim(), Overlap(), Element(i) for i < Overlap(), and PaddedElement(i) for any i < Dim().
+/// </summary>
+template<typename Derived>
+class VectorExpression
+{
+public:
+    [[nodiscard]] const Derived& Self() const noexcept { return static_cast<const Derived&>(*this); }
+
+    [[nodiscard]] bool IsValid() const noexcept { return Self().Dim() != 0; }
+    [[nodiscard]] std::string GetTypeString() const { return "(Vector:" + std::to_string(Self().Dim()) + ")"; }
+    /// <summary>
+    /// Computes a single element. Evaluating the whole expression is cheaper when more than one element is needed.
+    /// </summary>
+    [[nodiscard]] double operator[](size_t i) const { return i < Self().Dim() ? Self().PaddedElement(i) : throw std::logic_error("Out of range"); }
+
+    /// <summary>
+    /// Computes the expression into a new vector.
+    /// </summary>
+    [[nodiscard]] MathVector Evaluate() const { return MathVector(*this); }
+};
+
+/// <summary>
+/// A leaf referring to a vector owned elsewhere.
+/// </summary>
+class VectorReference : public VectorExpression<VectorReference>
+{
+private:
+    const MathVector& Target;
+
+public:
+    explicit VectorReference(const MathVector& Target) noexcept : Target(Target) { }
+
+    [[nodiscard]] size_t Dim() const noexcept { return Target.Dim(); }
+    [[nodiscard]] size_t Overlap() const noexcept { return Target.Dim(); }
+    [[nodiscard]] double Element(size_t i) const noexcept { return Target.data()[i]; }
+    [[nodiscard]] double PaddedElement(size_t i) const noexcept { return i < Target.Dim() ? Target.data()[i] : 0.0; }
+};
+/// <summary>
+/// A leaf owning a temporary vector.
+/// </summary>
+class VectorValue : public VectorExpression<VectorValue>
+{
+private:
+    MathVector Target;
+
+public:
+    explicit VectorValue(MathVector&& Target) noexcept : Target(std::move(Target)) { }
+
+    [[nodiscard]] size_t Dim() const noexcept { return Target.Dim(); }
+    [[nodiscard]] size_t Overlap() const noexcept { return Target.Dim(); }
+    [[nodiscard]] double Element(size_t i) const noexcept { return Target.data()[i]; }
+    [[nodiscard]] double PaddedElement(size_t i) const noexcept { return i < Target.Dim() ? Target.data()[i] : 0.0; }
+};
+
+template<typename T>
+concept IsMathVector = std::same_as<std::remove_cvref_t<T>, MathVector>;
+template<typename T>
+concept VectorOperand = IsMathVector<T> || std::derived_from<std::remove_cvref_t<T>, VectorExpression<std::remove_cvref_t<T>>>;
+
+/// <summary>
+/// Turns an operator argument into a node: a reference for vector lvalues, an owning leaf for vector temporaries, and the expression itself otherwise.
+/// </summary>
+template<VectorOperand T>
+[[nodiscard]] auto AsVectorNode(T&& Value)
+{
+    if constexpr (IsMathVector<T> && std::is_lvalue_reference_v<T>)
+        return VectorReference(Value);
+    else if constexpr (IsMathVector<T>)
+        return VectorValue(std::move(Value));
+    else
+        return std::remove_cvref_t<T>(std::forward<T>(Value));
+}
+template<typename T>
+using VectorNode = decltype(AsVectorNode(std::declval<T>()));
+
+/// <summary>
+/// One + Two or One - Two, element by element, with the shorter operand padded by zeroes.
+/// </summary>
+template<typename L, typename R, typename Op>
+class VectorBinaryExpression : public VectorExpression<VectorBinaryExpression<L, R, Op>>
+{
+private:
+    L One;
+    R Two;
+
+public:
+    VectorBinaryExpression(L&& One, R&& Two) : One(std::move(One)), Two(std::move(Two))
+    {
+        if (!this->One.IsValid() && !this->Two.IsValid())
+            throw OperatorError(Op::Symbol, this->One.GetTypeString(), this->Two.GetTypeString(), "cannot combine error vectors");
+    }
+
+    [[nodiscard]] size_t Dim() const noexcept { return std::max(One.Dim(), Two.Dim()); }
+    [[nodiscard]] size_t Overlap() const noexcept { return std::min(One.Overlap(), Two.Overlap()); }
+    [[nodiscard]] double Element(size_t i) const noexcept { return Op::Apply(One.Element(i), Two.Element(i)); }
+    [[nodiscard]] double PaddedElement(size_t i) const noexcept { return Op::Apply(One.PaddedElement(i), Two.PaddedElement(i)); }
+};
+
+/// <summary>
+/// Inner * Fac or Inner / Fac, element by element.
+/// </summary>
+template<typename E, typename Op>
+class VectorScalarExpression : public VectorExpression<VectorScalarExpression<E, Op>>
+{
+private:
+    E Inner;
+    double Fac;
+
+public:
+    VectorScalarExpression(E&& Inner, double Fac) : Inner(std::move(Inner)), Fac(Fac)
+    {
+        if (!this->Inner.IsValid())
+            throw OperatorError(Op::Symbol, this->Inner.GetTypeString(), "(Scalar:" + std::to_string(Fac) + ")", "cannot scale an error vector.");
+        if (std::is_same_v<Op, ExpressionDivide> && Fac == 0)
+            throw OperatorError(Op::Symbol, this->Inner.GetTypeString(), "(Scalar:0)", "cannot divide by zero");
+    }
+
+    [[nodiscard]] size_t Dim() const noexcept { return Inner.Dim(); }
+    [[nodiscard]] size_t Overlap() const noexcept { return Inner.Overlap(); }
+    [[nodiscard]] double Element(size_t i) const noexcept { return Op::Apply(Inner.Element(i), Fac); }
+    [[nodiscard]] double PaddedElement(size_t i) const noexcept { return Op::Apply(Inner.PaddedElement(i), Fac); }
+};
+
+template<VectorOperand L, VectorOperand R>
+[[nodiscard]] auto operator+(L&& One, R&& Two)
+{
+    return VectorBinaryExpression<VectorNode<L>, VectorNode<R>, ExpressionAdd>(AsVectorNode(std::forward<L>(One)), AsVectorNode(std::forward<R>(Two)));
+}
+template<VectorOperand L, VectorOperand R>
+[[nodiscard]] auto operator-(L&& One, R&& Two)
+{
+    return VectorBinaryExpression<VectorNode<L>, VectorNode<R>, ExpressionSubtract>(AsVectorNode(std::forward<L>(One)), AsVectorNode(std::forward<R>(Two)));
+}
+template<VectorOperand L, ExpressionFactor T>
+[[nodiscard]] auto operator*(L&& One, const T& Fac)
+{
+    return VectorScalarExpression<VectorNode<L>, ExpressionMultiply>(AsVectorNode(std::forward<L>(One)), static_cast<double>(Fac));
+}
+template<ExpressionFactor T, VectorOperand R>
+[[nodiscard]] auto operator*(const T& Fac, R&& Two)
+{
+    return VectorScalarExpression<VectorNode<R>, ExpressionMultiply>(AsVectorNode(std::forward<R>(Two)), static_cast<double>(Fac));
+}
+template<VectorOperand L, ExpressionFactor T>
+[[nodiscard]] auto operator/(L&& One, const T& Fac)
+{
+    return VectorScalarExpression<VectorNode<L>, ExpressionDivide>(AsVectorNode(std::forward<L>(One)), static_cast<double>(Fac));
+}
+template<VectorOperand E>
+[[nodiscard]] auto operator-(E&& One)
+{
+    return VectorScalarExpression<VectorNode<E>, ExpressionMultiply>(AsVectorNode(std::forward<E>(One)), -1.0);
+}
+
+template<typename E>
+MathVector::MathVector(const VectorExpression<E>& Expr) : MathVector(Expr.Self().Dim())
+{
+    Assign(Expr, ExpressionAssign());
+}
+template<typename E>
+MathVector& MathVector::operator=(const VectorExpression<E>& Expr)
+{
+    //As with matrices, each element only reads the same element of the operands, so v = v + w can be written in place.
+    if (this->Dim() != Expr.Self().Dim())
+        return *this = MathVector(Expr);
+
+    Assign(Expr, ExpressionAssign());
+    return *this;
+}
+template<typename E>
+MathVector& MathVector::operator+=(const VectorExpression<E>& Expr)
+{
+    if (!this->IsValid() || !Expr.IsValid())
+        throw OperatorError('+', this->GetTypeString(), Expr.GetTypeString(), "cannot combine error vectors");
+    if (this->Dim() != Expr.Self().Dim())
+        throw OperatorError('+', this->GetTypeString(), Expr.GetTypeString(), "dimension mismatch");
+
+    Assign(Expr, ExpressionAdd());
+    return *this;
+}
+template<typename E>
+MathVector& MathVector::operator-=(const VectorExpression<E>& Expr)
+{
+    if (!this->IsValid() || !Expr.IsValid())
+        throw OperatorError('-', this->GetTypeString(), Expr.GetTypeString(), "cannot combine error vectors");
+    if (this->Dim() != Expr.Self().Dim())
+        throw OperatorError('-', this->GetTypeString(), Expr.GetTypeString(), "dimension mismatch");
+
+    Assign(Expr, ExpressionSubtract());
+    return *this;
+}
+template<typename E, typename Op>
+void MathVector::Assign(const VectorExpression<E>& Expr, Op)
+{
+    const E& expr = Expr.Self();
+    double* out = this->Data.data();
+    size_t overlap = expr.Overlap(), dim = this->Dim();
+
+    for (size_t i = 0; i < overlap; i++)
+        out[i] = Op::Apply(out[i], expr.Element(i));
+    for (size_t i = overlap; i < dim; i++)
+        out[i] = Op::Apply(out[i], expr.PaddedElement(i));
+}
+
+#endif //JASON_VECTOREXPRESSION_H
@@ -0,0 +1,229 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "VectorMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define JASON_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    /*
+     * Portable implementation, for targets without a vector path: libm, one element at a time.
+     */
+
+    void PortableSin(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::sin(X[i]);
+    }
+    void PortableCos(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::cos(X[i]);
+    }
+    void PortableTan(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::tan(X[i]);
+    }
+    void PortableAsin(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::asin(X[i]);
+    }
+    void PortableAcos(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::acos(X[i]);
+    }
+    void PortableAtan(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::atan(X[i]);
+    }
+    void PortableExp(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::exp(X[i]);
+    }
+    void PortableExpBase(double* X, double Base, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::pow(Base, X[i]);
+    }
+    void PortableLog(double* X, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::log(X[i]);
+    }
+    void PortableLogBase(double* X, double Base, size_t Count) noexcept
+    {
+        double LnBase = std::log(Base);
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::log(X[i]) / LnBase;
+    }
+    void PortablePow(double* X, const double* Y, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::pow(X[i], Y[i]);
+    }
+    void PortablePowConst(double* X, double N, size_t Count) noexcept
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::pow(X[i], N);
+    }
+
+    [[maybe_unused]] constexpr VectorMathTable PortableTable = {
+        "portable", PortableSin, PortableCos, PortableTan, PortableAsin, PortableAcos, PortableAtan,
+        PortableExp, PortableExpBase, PortableLog, PortableLogBase, PortablePow, PortablePowConst
+    };
+}
+
+#ifdef JASON_SIMD_X86
+/*
+ * The vector implementation is written once, in VectorMathKernels.tpp, and compiled here for each instruction set. Every function in a namespace,
+ * including the ones from the shared file, is compiled for that namespace's instruction set, so only the entry points in the tables may be called
+ * before the CPU has been checked.
+ */
+
+#if !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi" //The vector types are only passed between functions of the same namespace.
+#endif
+
+namespace
+{
+namespace VectorMathSse2
+{
+    constexpr size_t Width = 2;
+    typedef double Vd __attribute__((vector_size(16)));
+    typedef std::int64_t Vi __attribute__((vector_size(16)));
+
+    inline Vd Sqrt(Vd X) noexcept { return (Vd)_mm_sqrt_pd((__m128d)X); }
+    //Without a fused multiply, the error is found by Dekker's splitting of a and b into 26 bit halves.
+    inline Vd ProductError(Vd A, Vd B, Vd P) noexcept
+    {
+        Vd ca = A * 134217729.0, cb = B * 134217729.0;
+        Vd ah = ca - (ca - A), bh = cb - (cb - B);
+        Vd al = A - ah, bl = B - bh;
+        return ((ah * bh - P) + ah * bl + al * bh) + al * bl;
+    }
+
+#include "VectorMathKernels.tpp"
+}
+}
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+namespace
+{
+namespace VectorMathAvx2
+{
+    constexpr size_t Width = 4;
+    typedef double Vd __attribute__((vector_size(32)));
+    typedef std::int64_t Vi __attribute__((vector_size(32)));
+
+    inline Vd Sqrt(Vd X) noexcept { return (Vd)_mm256_sqrt_pd((__m256d)X); }
+    inline Vd ProductError(Vd A, Vd B, Vd P) noexcept { return (Vd)_mm256_fmsub_pd((__m256d)A, (__m256d)B, (__m256d)P); }
+
+#include "VectorMathKernels.tpp"
+}
+}
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#pragma GCC diagnostic push
+//GCC 12's avx512fintrin.h starts _mm512_sqrt_pd from _mm512_undefined_pd, which -Wall reports as uninitialized.
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+namespace
+{
+namespace VectorMathAvx512
+{
+    constexpr size_t Width = 8;
+    typedef double Vd __attribute__((vector_size(64)));
+    typedef std::int64_t Vi __attribute__((vector_size(64)));
+
+    inline Vd Sqrt(Vd X) noexcept { return (Vd)_mm512_sqrt_pd((__m512d)X); }
+    inline Vd ProductError(Vd A, Vd B, Vd P) noexcept { return (Vd)_mm512_fmsub_pd((__m512d)A, (__m512d)B, (__m512d)P); }
+
+#include "VectorMathKernels.tpp"
+}
+}
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+#if !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace
+{
+    constexpr VectorMathTable Sse2Table = {
+        "sse2", VectorMathSse2::Sin, VectorMathSse2::Cos, VectorMathSse2::Tan, VectorMathSse2::Asin, VectorMathSse2::Acos,
+        VectorMathSse2::Atan, VectorMathSse2::Exp, VectorMathSse2::ExpBase, VectorMathSse2::Log, VectorMathSse2::LogBase,
+        VectorMathSse2::Pow, VectorMathSse2::PowConst
+    };
+    constexpr VectorMathTable Avx2Table = {
+        "avx2", VectorMathAvx2::Sin, VectorMathAvx2::Cos, VectorMathAvx2::Tan, VectorMathAvx2::Asin, VectorMathAvx2::Acos,
+        VectorMathAvx2::Atan, VectorMathAvx2::Exp, VectorMathAvx2::ExpBase, VectorMathAvx2::Log, VectorMathAvx2::LogBase,
+        VectorMathAvx2::Pow, VectorMathAvx2::PowConst
+    };
+    constexpr VectorMathTable Avx512Table = {
+        "avx512", VectorMathAvx512::Sin, VectorMathAvx512::Cos, VectorMathAvx512::Tan, VectorMathAvx512::Asin, VectorMathAvx512::Acos,
+        VectorMathAvx512::Atan, VectorMathAvx512::Exp, VectorMathAvx512::ExpBase, VectorMathAvx512::Log, VectorMathAvx512::LogBase,
+        VectorMathAvx512::Pow, VectorMathAvx512::PowConst
+    };
+}
+#endif
+
+namespace
+{
+    const VectorMathTable& SelectVectorMath() noexcept
+    {
+#ifdef JASON_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return Avx512Table;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return Avx2Table;
+
+        return Sse2Table;
+#else
+        return PortableTable;
+#endif
+    }
+}
+
+const VectorMathTable& VectorMath() noexcept
+{
+    static const VectorMathTable& table = SelectVectorMath();
+    return table;
+}
@@ -0,0 +1,545 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+/*
+ * The branch-free kernels behind VectorMath(), written once over GCC vector types and compiled once per instruction set.
+ * VectorMath.cpp includes this file inside a namespace compiled for that instruction set, which must already define:
+ *      Width                   The number of lanes.
+ *      Vd, Vi                  Width doubles, and Width 64 bit integers.
+ *      Sqrt(Vd)                The correctly rounded square root.
+ *      ProductError(a, b, p)   a * b - p exactly, where p is the rounded product a * b.
+ */
+
+// ---------------------------------------------------------------- Lane helpers
+
+inline Vd Broadcast(double Value) noexcept { return Vd{} + Value; }
+inline Vd Load(const double* Src) noexcept
+{
+    Vd Result;
+    std::memcpy(&Result, Src, sizeof(Vd));
+    return Result;
+}
+inline void Store(double* Dest, Vd Value) noexcept { std::memcpy(Dest, &Value, sizeof(Vd)); }
+
+inline Vi Bits(Vd X) noexcept { return (Vi)X; }
+inline Vd FromBits(Vi X) noexcept { return (Vd)X; }
+inline Vd Select(Vi Mask, Vd IfSet, Vd IfClear) noexcept { return Mask ? IfSet : IfClear; }
+
+inline Vd Abs(Vd X) noexcept { return FromBits(Bits(X) & 0x7fffffffffffffffLL); }
+inline Vd SignOf(Vd X) noexcept { return FromBits(Bits(X) & (long long)0x8000000000000000ULL); }
+inline Vd FlipSign(Vd X, Vi Mask) noexcept { return FromBits(Bits(X) ^ (Mask & (long long)0x8000000000000000ULL)); }
+/// X with the low 32 bits of its significand cleared, so that products of two such values are exact.
+inline Vd Truncate(Vd X) noexcept { return FromBits(Bits(X) & (long long)0xffffffff00000000ULL); }
+
+inline bool Any(Vi Mask) noexcept
+{
+    for (size_t i = 0; i < Width; i++)
+        if (Mask[i])
+            return true;
+
+    return false;
+}
+
+//Adding and removing 1.5 * 2^52 rounds to the nearest integer, for |X| < 2^51. The integer is then in the low bits.
+constexpr double RoundMagic = 6755399441055744.0;
+inline Vd Round(Vd X) noexcept { return (X + RoundMagic) - RoundMagic; }
+/// The integer value of a rounded double, for |X| < 2^51.
+inline Vi ToInt(Vd Rounded) noexcept { return Bits(Rounded + RoundMagic) - Bits(Broadcast(RoundMagic)); }
+inline Vd ToDouble(Vi Value) noexcept { return FromBits(Value + Bits(Broadcast(RoundMagic))) - RoundMagic; }
+/// 2^N, for -1022 <= N <= 1023.
+inline Vd Pow2(Vi N) noexcept { return FromBits((N + 1023) << 52); }
+
+// ---------------------------------------------------------------- Double-double arithmetic
+
+struct Vdd
+{
+    Vd Hi, Lo;
+};
+
+inline Vdd TwoSum(Vd A, Vd B) noexcept
+{
+    Vd S = A + B;
+    Vd V = S - A;
+    return { S, (A - (S - V)) + (B - V) };
+}
+/// Requires |A| >= |B|.
+inline Vdd FastTwoSum(Vd A, Vd B) noexcept
+{
+    Vd S = A + B;
+    return { S, B - (S - A) };
+}
+inline Vdd TwoProduct(Vd A, Vd B) noexcept
+{
+    Vd P = A * B;
+    return { P, ProductError(A, B, P) };
+}
+inline Vdd Add(Vdd A, Vdd B) noexcept
+{
+    Vdd S = TwoSum(A.Hi, B.Hi);
+    return FastTwoSum(S.Hi, S.Lo + (A.Lo + B.Lo));
+}
+inline Vdd Multiply(Vdd A, Vdd B) noexcept
+{
+    Vdd P = TwoProduct(A.Hi, B.Hi);
+    return FastTwoSum(P.Hi, P.Lo + (A.Hi * B.Lo + A.Lo * B.Hi));
+}
+inline Vdd Multiply(Vdd A, Vd B) noexcept
+{
+    Vdd P = TwoProduct(A.Hi, B);
+    return FastTwoSum(P.Hi, P.Lo + A.Lo * B);
+}
+
+// ---------------------------------------------------------------- Exponential and logarithm
+
+constexpr double Ln2Hi = 6.93147180369123816490e-01; //32 significant bits, so that k * Ln2Hi is exact for |k| < 2^21.
+constexpr double Ln2Lo = 1.90821492927058770002e-10;
+constexpr double Log2E = 1.44269504088896338700e+00;
+
+/// e^(Z.Hi + Z.Lo), for any Z.Hi (out of range values give infinity or zero, and NaN gives NaN).
+inline Vd ExpCore(Vdd Z) noexcept
+{
+    Vi Over = Z.Hi > 710.0, Under = Z.Hi < -746.0;
+    Vd Hi = Select(Over, Broadcast(710.0), Select(Under, Broadcast(-746.0), Z.Hi));
+    Vd Lo = Select(Over | Under, Broadcast(0.0), Z.Lo);
+
+    //e^z = 2^q e^r, with |r| <= ln(2) / 2. Hi - q * Ln2Hi is exact, and r is carried as R.Hi + R.Lo.
+    Vd q = Round(Hi * Log2E);
+    Vdd R = TwoSum(Hi - q * Ln2Hi, Lo - q * Ln2Lo);
+    Vd r = R.Hi;
+
+    //e^r - 1 - r, from its Taylor series. The first omitted term is below 2^-57.
+    Vd p = Broadcast(1.0 / 6227020800.0);
+    p = p * r + 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = (r * r) * p;
+
+    //1 + r is exact as a pair, so e^r is rounded only once. (e^R.Lo is taken as 1 + R.Lo, which is off by less than 2^-108.)
+    Vdd One = FastTwoSum(Broadcast(1.0), r);
+    Vd e = One.Hi + (One.Lo + (p + R.Lo));
+
+    //2^q is applied in two halves, so that results in the subnormal range (q < -1022) and just below overflow (q = 1024) are exact.
+    Vi n = ToInt(q);
+    Vi n1 = n >> 1;
+    return (e * Pow2(n1)) * Pow2(n - n1);
+}
+
+/// ln(X) as a double-double, accurate to about 2^-100 relative. X must be positive, normal and finite.
+inline Vdd LogCore(Vd X) noexcept
+{
+    //X = 2^k m, with sqrt(1/2) <= m < sqrt(2).
+    Vi XBits = Bits(X);
+    Vi k = ((XBits >> 52) & 0x7ff) - 1023;
+    Vd m = FromBits((XBits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+    Vi Big = m > 1.41421356237309504880;
+    m = Select(Big, m * 0.5, m);
+    k = k - Big; //Big is -1 where set.
+    Vd kd = ToDouble(k);
+
+    //ln(m) = 2 atanh(s) = 2 (s + s^3 / 3 + s^5 / 5 + ...), with s = (m - 1) / (m + 1), |s| <= 0.1716. m - 1 is exact.
+    Vd f = m - 1.0;
+    Vdd d = TwoSum(m, Broadcast(1.0));
+    Vd Inverse = 1.0 / d.Hi;
+    Vd sHi = f * Inverse;
+    Vdd q = TwoProduct(sHi, d.Hi);
+    Vd sLo = (((f - q.Hi) - q.Lo) - sHi * d.Lo) * Inverse; //The residual is exact, so one division serves both parts.
+    Vdd s = { sHi, sLo };
+
+    //The series after its first term: s^3 (2/3 + s^2 (2/5 + s^2 (2/7 + ...))). The first omitted term is below 2^-60 of the total.
+    Vdd z = Multiply(s, s);
+    Vd t = Broadcast(2.0 / 23.0);
+    t = t * z.Hi + 2.0 / 21.0;
+    t = t * z.Hi + 2.0 / 19.0;
+    t = t * z.Hi + 2.0 / 17.0;
+    t = t * z.Hi + 2.0 / 15.0;
+    t = t * z.Hi + 2.0 / 13.0;
+    t = t * z.Hi + 2.0 / 11.0;
+    t = t * z.Hi + 2.0 / 9.0;
+    t = t * z.Hi + 2.0 / 7.0;
+    t = t * z.Hi + 2.0 / 5.0;
+    Vdd c = Add(Vdd{ Broadcast(6.666666666666666296592e-01), Broadcast(3.700743415417188e-17) }, Vdd{ t * z.Hi, Broadcast(0.0) });
+    Vdd Tail = Multiply(Multiply(z, s), c);
+
+    Vdd Result = Add(Vdd{ kd * Ln2Hi, kd * Ln2Lo }, Vdd{ 2.0 * s.Hi, 2.0 * s.Lo });
+    return Add(Result, Tail);
+}
+
+/// Lanes of Pow that the vector path handles: X finite, normal and non-zero, and |Y| < 2^51.
+inline Vi PowRegular(Vd X, Vd Y) noexcept
+{
+    Vd AX = Abs(X);
+    return (AX >= 2.2250738585072014e-308) & (AX <= 1.7976931348623157e308) & (Abs(Y) < 2251799813685248.0);
+}
+/// X^Y on the regular lanes. Negative X is allowed when Y is an integer, and gives NaN otherwise.
+inline Vd PowCore(Vd X, Vd Y) noexcept
+{
+    Vdd L = LogCore(Abs(X));
+    Vdd Z = TwoProduct(Y, L.Hi);
+    Z.Lo = Z.Lo + Y * L.Lo;
+    Vd Result = ExpCore(FastTwoSum(Z.Hi, Z.Lo));
+
+    Vd YRounded = Round(Y);
+    Vi Negative = X < 0.0;
+    Vi Odd = (ToInt(YRounded) & 1) != 0;
+    Result = FlipSign(Result, Negative & Odd);
+    return Select(Negative & (YRounded != Y), Broadcast(std::numeric_limits<double>::quiet_NaN()), Result);
+}
+
+// ---------------------------------------------------------------- Trigonometry
+
+constexpr double InvPio2 = 6.36619772367581382433e-01;
+//pi / 2 in four parts. The first three have 33 significant bits, so their products with the quadrant (|q| <= 2^20) are exact.
+constexpr double Pio2_1 = 1.57079632673412561417e+00;
+constexpr double Pio2_2 = 6.07710050630396597660e-11;
+constexpr double Pio2_3 = 2.02226624871116645580e-21;
+constexpr double Pio2_3t = 8.47842766036889956997e-32;
+constexpr double TrigLimit = 1048576.0;
+
+/// Reduces X to R.Hi + R.Lo = X - q pi / 2 with |R| <= pi / 4 (slightly more when rounding picks the other quadrant). Requires |X| <= TrigLimit.
+inline Vdd ReduceTrig(Vd X, Vi& Quadrant) noexcept
+{
+    Vd q = Round(X * InvPio2);
+    Quadrant = ToInt(q);
+
+    Vd r = X - q * Pio2_1; //Exact
+    Vdd R = TwoSum(r, -(q * Pio2_2));
+    Vdd S = TwoSum(R.Hi, -(q * Pio2_3));
+    return FastTwoSum(S.Hi, (S.Lo + R.Lo) - q * Pio2_3t);
+}
+
+/// sin(X + Y) for |X| <= pi / 4, where Y is a small correction to X. (fdlibm __kernel_sin)
+inline Vd KernelSin(Vd X, Vd Y) noexcept
+{
+    constexpr double S1 = -1.66666666666666324348e-01, S2 = 8.33333333332248946124e-03, S3 = -1.98412698298579493134e-04,
+        S4 = 2.75573137070700676789e-06, S5 = -2.50507602534068634195e-08, S6 = 1.58969099521155010221e-10;
+
+    Vd z = X * X;
+    Vd v = z * X;
+    Vd r = S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)));
+    return X - ((z * (0.5 * Y - v * r) - Y) - v * S1);
+}
+/// cos(X + Y) for |X| <= pi / 4. (fdlibm __kernel_cos)
+inline Vd KernelCos(Vd X, Vd Y) noexcept
+{
+    constexpr double C1 = 4.16666666666666019037e-02, C2 = -1.38888888888741095749e-03, C3 = 2.48015872894767294178e-05,
+        C4 = -2.75573143513906633035e-07, C5 = 2.08757232129817482790e-09, C6 = -1.13596475577881948265e-11;
+
+    Vd z = X * X;
+    Vd r = z * (C1 + z * (C2 + z * (C3 + z * (C4 + z * (C5 + z * C6)))));
+    Vd hz = 0.5 * z;
+    Vd w = 1.0 - hz;
+    return w + (((1.0 - w) - hz) + (z * r - X * Y));
+}
+
+inline Vi TrigRegular(Vd X) noexcept { return Abs(X) <= TrigLimit; }
+
+/// sin(X) when Shift is 0, and cos(X) (= sin(X + pi / 2)) when Shift is 1.
+inline Vd SinCore(Vd X, long long Shift) noexcept
+{
+    Vi q;
+    Vdd R = ReduceTrig(X, q);
+    q = q + Shift;
+
+    Vd s = KernelSin(R.Hi, R.Lo), c = KernelCos(R.Hi, R.Lo);
+    Vd Result = FlipSign(Select((q & 1) != 0, c, s), (q & 2) != 0);
+    return Shift == 0 ? Select(X == 0.0, X, Result) : Result; //sin(-0) is -0
+}
+/// tan(X + Y) for |X| <= pi / 4 when Odd is clear, and -1 / tan(X + Y) when it is set. (fdlibm __kernel_tan)
+inline Vd KernelTan(Vd X, Vd Y, Vi Odd) noexcept
+{
+    constexpr double T0 = 3.33333333333334091986e-01, T1 = 1.33333333333201242699e-01, T2 = 5.39682539762260521377e-02,
+        T3 = 2.18694882948595424599e-02, T4 = 8.86323982359930005737e-03, T5 = 3.59207910759131235356e-03, T6 = 1.45620945432529025516e-03,
+        T7 = 5.88041240820264096874e-04, T8 = 2.46463134818469906812e-04, T9 = 7.81794442939557092300e-05, T10 = 7.14072491382608190305e-05,
+        T11 = -1.85586374855275456654e-05, T12 = 2.59073051863633712884e-05;
+    constexpr double Pio4 = 7.85398163397448278999e-01, Pio4Lo = 3.06161699786838301793e-17;
+
+    //Near pi / 4 the polynomial is evaluated at pi / 4 - |x| instead, and the identity for tan(pi / 4 - x) undoes it.
+    Vi Big = Abs(X) >= 0.6744;
+    Vi Negative = X < 0.0;
+    Vd AX = FlipSign(X, Negative), AY = FlipSign(Y, Negative);
+    X = Select(Big, (Pio4 - AX) + (Pio4Lo - AY), X);
+    Y = Select(Big, Broadcast(0.0), Y);
+
+    Vd z = X * X;
+    Vd w = z * z;
+    Vd r = T1 + w * (T3 + w * (T5 + w * (T7 + w * (T9 + w * T11))));
+    Vd v = z * (T2 + w * (T4 + w * (T6 + w * (T8 + w * (T10 + w * T12)))));
+    Vd s = z * X;
+    r = Y + z * (s * (r + v) + Y);
+    r = r + T0 * s;
+    w = X + r;
+
+    Vd iy = Select(Odd, Broadcast(-1.0), Broadcast(1.0));
+    Vd Reflected = FlipSign(iy - 2.0 * (X - (w * w / (w + iy) - r)), Negative);
+
+    //-1 / (X + r), with the division corrected using truncated operands.
+    Vd wt = Truncate(w);
+    Vd vt = r - (wt - X);
+    Vd a = -1.0 / w;
+    Vd t = Truncate(a);
+    Vd Reciprocal = t + a * ((1.0 + t * wt) + t * vt);
+
+    return Select(Big, Reflected, Select(Odd, Reciprocal, w));
+}
+inline Vd TanCore(Vd X) noexcept
+{
+    Vi q;
+    Vdd R = ReduceTrig(X, q);
+    return Select(X == 0.0, X, KernelTan(R.Hi, R.Lo, (q & 1) != 0));
+}
+
+// ---------------------------------------------------------------- Inverse trigonometry
+
+constexpr double Pio2Hi = 1.57079632679489655800e+00;
+constexpr double Pio2Lo = 6.12323399573676603587e-17;
+constexpr double Pio4Hi = 7.85398163397448278999e-01;
+
+/// The rational approximation shared by asin and acos: asin(x) = x + x R(x^2) for |x| <= 0.5. (fdlibm e_asin.c)
+inline Vd AsinRational(Vd z) noexcept
+{
+    constexpr double pS0 = 1.66666666666666657415e-01, pS1 = -3.25565818622400915405e-01, pS2 = 2.01212532134862925881e-01,
+        pS3 = -4.00555345006794114027e-02, pS4 = 7.91534994289814532176e-04, pS5 = 3.47933107596021167570e-05,
+        qS1 = -2.40339491173441421878e+00, qS2 = 2.02094576023350569471e+00, qS3 = -6.88283971605453293030e-01, qS4 = 7.70381505559019352791e-02;
+
+    Vd p = z * (pS0 + z * (pS1 + z * (pS2 + z * (pS3 + z * (pS4 + z * pS5)))));
+    Vd q = 1.0 + z * (qS1 + z * (qS2 + z * (qS3 + z * qS4)));
+    return p / q;
+}
+
+inline Vi AsinRegular(Vd X) noexcept { return Abs(X) <= 1.0; }
+/// acos(1) divides zero by zero on the x >= 0.5 path, so both ends go to libm.
+inline Vi AcosRegular(Vd X) noexcept { return Abs(X) < 1.0; }
+
+inline Vd AsinCore(Vd X) noexcept
+{
+    Vd AX = Abs(X);
+
+    //|x| < 0.5
+    Vd Small = X + X * AsinRational(X * X);
+
+    //|x| >= 0.5: asin(x) = pi / 2 - 2 asin(sqrt((1 - x) / 2))
+    Vd t = (1.0 - AX) * 0.5;
+    Vd r = AsinRational(t);
+    Vd s = Sqrt(t);
+    Vd Near = Pio2Hi - (2.0 * (s + s * r) - Pio2Lo); //|x| >= 0.975
+    Vd w = Truncate(s);
+    Vd c = (t - w * w) / (s + w);
+    Vd Mid = Pio4Hi - ((2.0 * s * r - (Pio2Lo - 2.0 * c)) - (Pio4Hi - 2.0 * w));
+    Vd Large = Select(AX >= 0.975, Near, Mid);
+    Large = FromBits(Bits(Large) | Bits(SignOf(X)));
+
+    return Select(AX < 0.5, Small, Large);
+}
+inline Vd AcosCore(Vd X) noexcept
+{
+    //|x| < 0.5
+    Vd Small = Pio2Hi - (X - (Pio2Lo - X * AsinRational(X * X)));
+
+    //x <= -0.5
+    Vd zn = (1.0 + X) * 0.5;
+    Vd sn = Sqrt(zn);
+    Vd Negative = 3.14159265358979311600e+00 - 2.0 * (sn + (AsinRational(zn) * sn - Pio2Lo));
+
+    //x >= 0.5
+    Vd zp = (1.0 - X) * 0.5;
+    Vd sp = Sqrt(zp);
+    Vd df = Truncate(sp);
+    Vd c = (zp - df * df) / (sp + df);
+    Vd Positive = 2.0 * (df + (AsinRational(zp) * sp + c));
+
+    return Select(Abs(X) < 0.5, Small, Select(X < 0.0, Negative, Positive));
+}
+
+/// (fdlibm s_atan.c) The argument is reduced by one of four identities, selected per lane, so that the polynomial only sees |u| < 7/16.
+inline Vd AtanCore(Vd X) noexcept
+{
+    constexpr double aT0 = 3.33333333333329318027e-01, aT1 = -1.99999999998764832476e-01, aT2 = 1.42857142725034663711e-01,
+        aT3 = -1.11111104054623557880e-01, aT4 = 9.09088713343650656196e-02, aT5 = -7.69187620504482999495e-02,
+        aT6 = 6.66107313738753120669e-02, aT7 = -5.83357013379057348645e-02, aT8 = 4.97687799461593236017e-02,
+        aT9 = -3.65315727442169155270e-02, aT10 = 1.62858201153657823623e-02;
+
+    Vd AX = Abs(X);
+    Vi Id0 = AX >= 0.4375, Id1 = AX >= 0.6875, Id2 = AX >= 1.1875, Id3 = AX >= 2.4375;
+
+    //atan(x) = atan(c) + atan((x - c) / (1 + x c)), for c = 0.5, 1, 1.5 and infinity.
+    Vd Num = Select(Id3, Broadcast(-1.0), Select(Id2, AX - 1.5, Select(Id1, AX - 1.0, Select(Id0, 2.0 * AX - 1.0, AX))));
+    Vd Den = Select(Id3, AX, Select(Id2, 1.0 + 1.5 * AX, Select(Id1, AX + 1.0, Select(Id0, 2.0 + AX, Broadcast(1.0)))));
+    Vd Hi = Select(Id3, Broadcast(1.57079632679489655800e+00), Select(Id2, Broadcast(9.82793723247329054082e-01),
+        Select(Id1, Broadcast(7.85398163397448278999e-01), Select(Id0, Broadcast(4.63647609000806093515e-01), Broadcast(0.0)))));
+    Vd Lo = Select(Id3, Broadcast(6.12323399573676603587e-17), Select(Id2, Broadcast(1.39033110312309984516e-17),
+        Select(Id1, Broadcast(3.06161699786838301793e-17), Select(Id0, Broadcast(2.26987774529616870924e-17), Broadcast(0.0)))));
+
+    Vd u = Num / Den;
+    Vd z = u * u;
+    Vd w = z * z;
+    Vd s1 = z * (aT0 + w * (aT2 + w * (aT4 + w * (aT6 + w * (aT8 + w * aT10)))));
+    Vd s2 = w * (aT1 + w * (aT3 + w * (aT5 + w * (aT7 + w * aT9))));
+    Vd Result = Hi - ((u * (s1 + s2) - Lo) - u);
+
+    return FromBits(Bits(Result) | Bits(SignOf(X)));
+}
+
+// ---------------------------------------------------------------- Drivers
+
+/// Applies Kernel to every element of X, in place. Lanes where Regular(x) is clear are recomputed one at a time with Fallback, which is the
+/// libm function. The last Count % Width elements are padded to a full vector with Pad, which must be a regular argument.
+template<typename KernelT, typename RegularT, typename FallbackT>
+inline void Map(double* X, size_t Count, KernelT Kernel, RegularT Regular, FallbackT Fallback, double Pad) noexcept
+{
+    auto Block = [&](double* Data, size_t Length)
+    {
+        Vd In = Load(Data);
+        Vi Special = ~Regular(In);
+        Store(Data, Kernel(In));
+        if (Any(Special))
+            for (size_t j = 0; j < Length; j++)
+                if (Special[j])
+                    Data[j] = Fallback(In[j]);
+    };
+
+    size_t i = 0;
+    for (; i + Width <= Count; i += Width)
+        Block(X + i, Width);
+
+    if (i < Count)
+    {
+        double Tail[Width];
+        for (size_t j = 0; j < Width; j++)
+            Tail[j] = i + j < Count ? X[i + j] : Pad;
+
+        Block(Tail, Count - i);
+        std::copy(Tail, Tail + (Count - i), X + i);
+    }
+}
+
+/// Map for functions of two arguments: X[i] = Kernel(X[i], Y[i]).
+template<typename KernelT, typename RegularT, typename FallbackT>
+inline void Map(double* X, const double* Y, size_t Count, KernelT Kernel, RegularT Regular, FallbackT Fallback, double Pad) noexcept
+{
+    auto Block = [&](double* Data, const double* Other, size_t Length)
+    {
+        Vd In = Load(Data), InY = Load(Other);
+        Vi Special = ~Regular(In, InY);
+        Store(Data, Kernel(In, InY));
+        if (Any(Special))
+            for (size_t j = 0; j < Length; j++)
+                if (Special[j])
+                    Data[j] = Fallback(In[j], InY[j]);
+    };
+
+    size_t i = 0;
+    for (; i + Width <= Count; i += Width)
+        Block(X + i, Y + i, Width);
+
+    if (i < Count)
+    {
+        double Tail[Width], TailY[Width];
+        for (size_t j = 0; j < Width; j++)
+        {
+            Tail[j] = i + j < Count ? X[i + j] : Pad;
+            TailY[j] = i + j < Count ? Y[i + j] : Pad;
+        }
+
+        Block(Tail, TailY, Count - i);
+        std::copy(Tail, Tail + (Count - i), X + i);
+    }
+}
+
+inline Vi NotNaN(Vd X) noexcept { return X == X; }
+inline Vi LogRegular(Vd X) noexcept { return (X >= 2.2250738585072014e-308) & (X <= 1.7976931348623157e308); }
+/// True for bases with a finite, non-zero logarithm.
+inline bool RegularBase(double Base) noexcept { return Base >= 2.2250738585072014e-308 && Base <= 1.7976931348623157e308 && Base != 1.0; }
+
+void Sin(double* X, size_t Count) noexcept
+{
+    Map(X, Count, [](Vd x) { return SinCore(x, 0); }, TrigRegular, [](double x) { return std::sin(x); }, 0.0);
+}
+void Cos(double* X, size_t Count) noexcept
+{
+    Map(X, Count, [](Vd x) { return SinCore(x, 1); }, TrigRegular, [](double x) { return std::cos(x); }, 0.0);
+}
+void Tan(double* X, size_t Count) noexcept
+{
+    Map(X, Count, TanCore, TrigRegular, [](double x) { return std::tan(x); }, 0.0);
+}
+void Asin(double* X, size_t Count) noexcept
+{
+    Map(X, Count, AsinCore, AsinRegular, [](double x) { return std::asin(x); }, 0.0);
+}
+void Acos(double* X, size_t Count) noexcept
+{
+    Map(X, Count, AcosCore, AcosRegular, [](double x) { return std::acos(x); }, 0.0);
+}
+void Atan(double* X, size_t Count) noexcept
+{
+    Map(X, Count, AtanCore, NotNaN, [](double x) { return std::atan(x); }, 0.0);
+}
+
+void Exp(double* X, size_t Count) noexcept
+{
+    Map(X, Count, [](Vd x) { return ExpCore(Vdd{ x, Broadcast(0.0) }); }, NotNaN, [](double x) { return std::exp(x); }, 0.0);
+}
+void ExpBase(double* X, double Base, size_t Count) noexcept
+{
+    if (!RegularBase(Base))
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::pow(Base, X[i]);
+        return;
+    }
+
+    //Base^x = e^(x ln(Base)), with ln(Base) and the product carried in double-double.
+    Vdd L = LogCore(Broadcast(Base));
+    auto Kernel = [L](Vd x)
+    {
+        Vdd Z = TwoProduct(x, L.Hi);
+        return ExpCore(FastTwoSum(Z.Hi, Z.Lo + x * L.Lo));
+    };
+    //Where x ln(Base) overflows, its error term would be infinite as well, so those lanes (whose results are zero or infinity) go to libm.
+    auto Regular = [L](Vd x) { return Abs(x * L.Hi) <= 1000.0; };
+    Map(X, Count, Kernel, Regular, [Base](double x) { return std::pow(Base, x); }, 0.0);
+}
+void Log(double* X, size_t Count) noexcept
+{
+    Map(X, Count, [](Vd x) { return LogCore(x).Hi; }, LogRegular, [](double x) { return std::log(x); }, 1.0);
+}
+void LogBase(double* X, double Base, size_t Count) noexcept
+{
+    if (!RegularBase(Base))
+    {
+        for (size_t i = 0; i < Count; i++)
+            X[i] = std::log(X[i]) / std::log(Base);
+        return;
+    }
+
+    //ln(x) / ln(Base), with the division carried out in double-double.
+    Vdd B = LogCore(Broadcast(Base));
+    auto Kernel = [B](Vd x)
+    {
+        Vdd L = LogCore(x);
+        Vd q = L.Hi / B.Hi;
+        Vdd Back = Multiply(B, q);
+        return q + ((L.Hi - Back.Hi) - Back.Lo + L.Lo) / B.Hi;
+    };
+    double LnBase = std::log(Base);
+    Map(X, Count, Kernel, LogRegular, [LnBase](double x) { return std::log(x) / LnBase; }, 1.0);
+}
+
+void Pow(double* X, const double* Y, size_t Count) noexcept
+{
+    Map(X, Y, Count, PowCore, PowRegular, [](double x, double y) { return std::pow(x, y); }, 1.0);
+}
+void PowConst(double* X, double N, size_t Count) noexcept
+{
+    Vd Y = Broadcast(N);
+    Map(X, Count, [Y](Vd x) { return PowCore(x, Y); }, [Y](Vd x) { return PowRegular(x, Y); }, [N](double x) { return std::pow(x, N); }, 1.0);
+}
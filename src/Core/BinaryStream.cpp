@@ -0,0 +1,106 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "BinaryStream.h"
+#include "Errors.h"
+
+BinaryWriter::BinaryWriter(unsigned char UnitSize, size_t Capacity) : unitSize(UnitSize)
+{
+    if (UnitSize == 0)
+        throw std::logic_error("The unit size cannot be zero");
+
+    units.reserve((Capacity + UnitSize - 1) / UnitSize);
+}
+
+void BinaryWriter::WriteBytes(const void* Data, size_t Count)
+{
+    const char* source = static_cast<const char*>(Data);
+    while (Count != 0)
+    {
+        if (units.empty() || used == unitSize)
+        {
+            units.emplace_back(unitSize);
+            used = 0;
+        }
+
+        size_t chunk = std::min<size_t>(Count, unitSize - used);
+        std::memcpy(units.back().Expose() + used, source, chunk);
+
+        used += chunk;
+        written += chunk;
+        source += chunk;
+        Count -= chunk;
+    }
+}
+void BinaryWriter::WriteDoubles(const double* Data, size_t Count)
+{
+    if constexpr (std::endian::native == std::endian::little)
+        WriteBytes(Data, Count * sizeof(double));
+    else
+    {
+        for (size_t i = 0; i < Count; i++)
+            Write(Data[i]);
+    }
+}
+void BinaryWriter::WriteSizes(const size_t* Data, size_t Count)
+{
+    if constexpr (std::endian::native == std::endian::little && sizeof(size_t) == sizeof(uint64_t))
+        WriteBytes(Data, Count * sizeof(uint64_t));
+    else
+    {
+        for (size_t i = 0; i < Count; i++)
+            Write(static_cast<uint64_t>(Data[i]));
+    }
+}
+
+BinaryReader::BinaryReader(const std::vector<Unit>& Units) noexcept : units(Units)
+{
+    for (const Unit& item : Units)
+        remaining += item.GetSize();
+}
+
+void BinaryReader::ReadBytes(void* Out, size_t Count)
+{
+    if (Count > remaining)
+        throw FormatError("binary data", "unexpected end of data");
+
+    char* target = static_cast<char*>(Out);
+    remaining -= Count;
+    while (Count != 0)
+    {
+        if (offset == units[unit].GetSize())
+        {
+            unit++;
+            offset = 0;
+            continue;
+        }
+
+        size_t chunk = std::min<size_t>(Count, units[unit].GetSize() - offset);
+        std::memcpy(target, units[unit].Expose() + offset, chunk);
+
+        offset += chunk;
+        target += chunk;
+        Count -= chunk;
+    }
+}
+void BinaryReader::ReadDoubles(double* Out, size_t Count)
+{
+    if constexpr (std::endian::native == std::endian::little)
+        ReadBytes(Out, Count * sizeof(double));
+    else
+    {
+        for (size_t i = 0; i < Count; i++)
+            Out[i] = Read<double>();
+    }
+}
+void BinaryReader::ReadSizes(size_t* Out, size_t Count)
+{
+    if constexpr (std::endian::native == std::endian::little && sizeof(size_t) == sizeof(uint64_t))
+        ReadBytes(Out, Count * sizeof(uint64_t));
+    else
+    {
+        for (size_t i = 0; i < Count; i++)
+            Out[i] = static_cast<size_t>(Read<uint64_t>());
+    }
+}
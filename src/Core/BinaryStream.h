@@ -0,0 +1,92 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_BINARYSTREAM_H
+#define JASON_BINARYSTREAM_H
+
+#include "BinaryUnit.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Binary streams
+ *
+ * BinaryWriter and BinaryReader move a byte stream in and out of a list of Units, so that serialized data goes straight into the units the
+ * package pager writes, with no intermediate string or buffer. Numbers are always stored little-endian, whatever the host's byte order, so
+ * packages can move between machines. On little-endian hosts (nearly all of them), arrays of doubles are copied unit by unit with memcpy.
+ */
+
+/// @brief Writes a little-endian byte stream across units of a fixed size, allocating units as it goes. The last unit is padded with zeroes.
+class BinaryWriter
+{
+private:
+    std::vector<Unit> units;
+    unsigned char unitSize;
+    size_t used = 0; //The bytes written into the last unit
+    size_t written = 0;
+
+public:
+    /// @brief Creates a writer for units of UnitSize bytes, reserving room for Capacity bytes. Throws if UnitSize is zero.
+    explicit BinaryWriter(unsigned char UnitSize, size_t Capacity = 0);
+
+    void WriteBytes(const void* Data, size_t Count);
+    template<typename T> requires std::is_arithmetic_v<T>
+    void Write(T Item)
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &Item, sizeof(T));
+        if constexpr (std::endian::native == std::endian::big)
+            std::reverse(bytes, bytes + sizeof(T));
+
+        WriteBytes(bytes, sizeof(T));
+    }
+    void WriteDoubles(const double* Data, size_t Count);
+    /// @brief Writes each value as a 64-bit unsigned integer.
+    void WriteSizes(const size_t* Data, size_t Count);
+
+    /// @brief The number of bytes written so far
+    [[nodiscard]] size_t Size() const noexcept { return written; }
+    /// @brief Hands over the units written.
+    [[nodiscard]] std::vector<Unit> Release() && noexcept { return std::move(units); }
+};
+
+/// @brief Reads a little-endian byte stream back out of a list of units. Reading past the end throws FormatError.
+class BinaryReader
+{
+private:
+    const std::vector<Unit>& units;
+    size_t unit = 0;
+    size_t offset = 0; //The bytes read from the current unit
+    size_t remaining = 0;
+
+public:
+    explicit BinaryReader(const std::vector<Unit>& Units) noexcept;
+
+    void ReadBytes(void* Out, size_t Count);
+    template<typename T> requires std::is_arithmetic_v<T>
+    [[nodiscard]] T Read()
+    {
+        char bytes[sizeof(T)];
+        ReadBytes(bytes, sizeof(T));
+        if constexpr (std::endian::native == std::endian::big)
+            std::reverse(bytes, bytes + sizeof(T));
+
+        T result;
+        std::memcpy(&result, bytes, sizeof(T));
+        return result;
+    }
+    void ReadDoubles(double* Out, size_t Count);
+    /// @brief Reads Count 64-bit unsigned integers.
+    void ReadSizes(size_t* Out, size_t Count);
+
+    /// @brief The number of bytes left in the units, including any padding
+    [[nodiscard]] size_t Remaining() const noexcept { return remaining; }
+};
+
+#endif //JASON_BINARYSTREAM_H
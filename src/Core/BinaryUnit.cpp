@@ -4,91 +4,42 @@
 
 #include "BinaryUnit.h"
 
-/*
- BinaryUnit::BinaryUnit() : Data(nullptr), blockSize(0) {}
- BinaryUnit::BinaryUnit(const BinaryUnit& obj) noexcept
- {
- Allocate(obj.Data, obj.blockSize, true);
- }
- BinaryUnit::BinaryUnit(BinaryUnit&& obj) noexcept : Data(std::exchange(obj.Data, nullptr)), blockSize(std::exchange(obj.blockSize, 0))
- {
- Allocate(obj.Data, obj.blockSize, false);
- obj.Data = nullptr;
- obj.blockSize = 0;
- }
- BinaryUnit::~BinaryUnit()
- {
- Deallocate();
- }
- 
- BinaryUnit BinaryUnit::FromSize(unsigned char size) noexcept
- {
- BinaryUnit result;
- if (size != 0)
- {
- result.Data = new char[size];
- memset(result.Data, 0, size);
- }
- 
- return result;
- }
- BinaryUnit BinaryUnit::FromCharPtr(char* data, unsigned char size, bool copy) noexcept
- {
- BinaryUnit result;
- result.Allocate(data, size, copy);
- 
- return result;
- }
- 
- void BinaryUnit::Deallocate()
- {
- delete[] Data;
- Data = nullptr;
- blockSize = 0;
- }
- void BinaryUnit::Allocate(char* data, unsigned char size, bool copy)
- {
- if (!size || !data)
- return;
- 
- this->blockSize = size;
- if (copy)
- {
- this->Data = new char[size];
- memcpy(this->Data, data, size);
- }
- else
- this->Data = data;
- }
- 
- BinaryUnit& BinaryUnit::operator=(const BinaryUnit& obj) noexcept
- {
- if (this == &obj)
- return *this;
- 
- if (Data)
- Deallocate();
- 
- Allocate(obj.Data, obj.blockSize, true);
- return *this;
- }
- BinaryUnit& BinaryUnit::operator=(BinaryUnit&& obj) noexcept
- {
- if (Data)
- Deallocate();
- 
- Allocate(obj.Data, obj.blockSize, false);
- obj.Data = nullptr;
- obj.blockSize = 0;
- return *this;
- }
- 
- const char* BinaryUnit::Expose() const noexcept
- {
- return this->Data;
- }
- unsigned char BinaryUnit::GetSize() const noexcept
- {
- return this->blockSize;
- }
- */
+#include <cstring>
+#include <utility>
+
+Unit::Unit(unsigned char Size) : data(Size == 0 ? nullptr : new char[Size]()), size(Size)
+{
+
+}
+Unit::Unit(char* Data, unsigned char Size, bool Copy) : size(Size)
+{
+    if (!Copy)
+        data.reset(Data);
+    else if (Size != 0)
+    {
+        data.reset(new char[Size]);
+        std::memcpy(data.get(), Data, Size);
+    }
+}
+Unit::Unit(const Unit& obj) : Unit(const_cast<char*>(obj.Expose()), obj.size, true)
+{
+
+}
+Unit::Unit(Unit&& obj) noexcept : data(std::move(obj.data)), size(std::exchange(obj.size, 0))
+{
+
+}
+
+Unit& Unit::operator=(const Unit& obj)
+{
+    if (this != &obj)
+        *this = Unit(obj);
+
+    return *this;
+}
+Unit& Unit::operator=(Unit&& obj) noexcept
+{
+    this->data = std::move(obj.data);
+    this->size = std::exchange(obj.size, 0);
+    return *this;
+}
@@ -8,7 +8,9 @@
 #ifndef JASON_SERIALIZE_H
 #define JASON_SERIALIZE_H
 
-#include "BinaryUnit.h"
+#include "BinaryStream.h"
+
+#include <iostream>
 
 class StringSerializable
 {
@@ -34,17 +36,13 @@ public:
 sst<const StringSerializable> StrSerialize(const StringSerializable& obj) noexcept;
 sst<StringSerializable> StrDeserialize(StringSerializable& obj) noexcept;
 
-/*
 class BinarySerializable
 {
 public:
-    std::vector<BinaryUnit> distribute_sizes(unsigned char byte_sizes, const std::vector<BinaryUnit>& data) const noexcept;
-    std::vector<BinaryUnit> binary_align(unsigned char byte_sizes, const std::vector<BinaryUnit>& data) const noexcept;
-    std::vector<BinaryUnit> binary_align(const std::vector<unsigned char>& byte_sizes, const std::vector<BinaryUnit>& data) const noexcept;
-    
-    virtual std::vector<BinaryUnit> binary_serialize(unsigned char bytes_size) const noexcept = 0;
-    virtual void binary_deserialize(unsigned char bytes_size, const std::vector<BinaryUnit>& data) = 0;
+    /// @brief The number of bytes bin_serialize writes.
+    [[nodiscard]] virtual size_t bin_size() const noexcept = 0;
+    virtual void bin_serialize(BinaryWriter& out) const = 0;
+    virtual void bin_deserialize(BinaryReader& in) = 0;
 };
- */
 
 #endif
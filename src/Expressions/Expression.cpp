@@ -8,14 +8,14 @@
 
 #include "../IO/Session.h"
 
-std::unique_ptr<VariableType> Expression::Compute(Session& on) const
+Value Expression::Compute(Session& on) const
 {
-    std::unique_ptr<VariableType> result;
+    Value result;
     if (this->elements.empty())
-        result = std::make_unique<Scalar>(0.00f);
+        result = 0.00;
     else
     {
-        std::stack<std::unique_ptr<VariableType>> work;
+        std::stack<Value> work;
         for (const auto& elem: this->elements)
         {
             switch (elem->ElementType())
@@ -32,14 +32,13 @@ std::unique_ptr<VariableType> Expression::Compute(Session& on) const
                     auto a = std::move(work.top());
                     work.pop();
 
-                    auto operResult = oper.Evaluate(*a, *b);
-                    work.emplace(std::move(operResult));
+                    work.emplace(oper.Evaluate(std::move(a), b));
                     break;
                 }
                 case SubExpr:
                 {
                     const auto& subExpr = dynamic_cast<const class SubExpression&>(*elem);
-                    work.push(subExpr.GetValue(on).Clone());
+                    work.push(subExpr.GetValue(on));
                     break;
                 }
             }
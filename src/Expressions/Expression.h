@@ -9,7 +9,7 @@
 
 #include "SubExpression.h"
 #include "Operator.h"
-#include "../Calc/VariableType.h"
+#include "../Calc/Value.h"
 
 class DelimitedExpression
 {
@@ -66,7 +66,7 @@ public:
 
     [[nodiscard]] static Expression Parse(DelimitedExpression&& delExpr);
 
-    std::unique_ptr<VariableType> Compute(class Session& on) const;
+    Value Compute(class Session& on) const;
 };
 
 std::ostream& operator<<(std::ostream& out, const Expression& e);
@@ -4,13 +4,20 @@
 
 #include "Operator.h"
 
+Operator::Operator(char symbol, unsigned precedence) : symbol(symbol), precedence(precedence), eval()
+{
+
+}
 Operator::Operator(char symbol, unsigned precedence, OperatorFunc eval) : symbol(symbol), precedence(precedence), eval(std::move(eval))
 {
 
 }
 
-[[nodiscard]] std::unique_ptr<VariableType> Operator::Evaluate(const VariableType& a, const VariableType& b) const
+[[nodiscard]] Value Operator::Evaluate(Value a, const Value& b) const
 {
+    if (!this->eval)
+        return Value::Apply(this->symbol, std::move(a), b);
+
     return this->eval(a, b);
 }
 [[nodiscard]] constexpr unsigned Operator::GetPrecedence() const noexcept
@@ -7,12 +7,12 @@
 
 #include "ExpressionElement.h"
 
-#include "../Calc/VariableType.h"
+#include "../Calc/Value.h"
 
 #include <functional>
 #include <utility>
 
-using OperatorFunc = std::function<std::unique_ptr<VariableType>(const VariableType&, const VariableType&)>;
+using OperatorFunc = std::function<Value(const Value&, const Value&)>;
 
 class Operator : public ExpressionElement
 {
@@ -22,6 +22,8 @@ private:
     OperatorFunc eval;
 
 public:
+    /// @brief An operator evaluated by Value::Apply, which covers the built in arithmetic without going through a std::function.
+    Operator(char symbol, unsigned precedence);
     Operator(char symbol, unsigned precedence, OperatorFunc eval);
     Operator(const Operator& obj) = default;
     Operator(Operator&& obj) noexcept = default;
@@ -29,7 +31,8 @@ public:
     Operator& operator=(const Operator& obj) = default;
     Operator& operator=(Operator&& obj) = default;
 
-    [[nodiscard]] std::unique_ptr<VariableType> Evaluate(const VariableType& a, const VariableType& b) const;
+    /// @brief Applies the operator. The left operand is taken by value so that a temporary can be reused for the result.
+    [[nodiscard]] Value Evaluate(Value a, const Value& b) const;
 
     [[nodiscard]] constexpr unsigned GetPrecedence() const noexcept;
 
@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "../Calc/VariableType.h"
+#include "../Calc/Value.h"
 #include "../Calc/Numerics/Scalar.h"
 #include "../IO/PackageEntryKey.h"
 #include "ExpressionElement.h"
@@ -33,7 +34,8 @@ public:
         return ExpressionElementT::SubExpr;
     }
 
-    [[nodiscard]] virtual const VariableType& GetValue(Session& host) const = 0;
+    /// @brief Returns the value of the sub expression. Vectors and matrices are shared with their source, not copied.
+    [[nodiscard]] virtual Value GetValue(Session& host) const = 0;
 
     [[nodiscard]] static ParsedSubExpression Parse(std::istream& in, const Session& session) noexcept;
 };
@@ -41,10 +43,10 @@ public:
 class NumericExpr : public SubExpression
 {
 private:
-    Scalar Value;
+    Scalar Number;
 
 public:
-    explicit NumericExpr(Scalar Value) : Value(std::move(Value)) { }
+    explicit NumericExpr(Scalar Number) : Number(std::move(Number)) { }
 
     static bool IsNumericalString(std::istream& in) noexcept;
 
@@ -54,12 +56,12 @@ public:
     }
     void Print(std::ostream& out) const noexcept override
     {
-        out << Value;
+        out << Number;
     }
 
-    [[nodiscard]] const VariableType& GetValue(Session& host) const override
+    [[nodiscard]] Value GetValue(Session& host) const override
     {
-        return Value;
+        return Number;
     }
 
     [[nodiscard]] std::unique_ptr<ExpressionElement> Clone() const noexcept override
@@ -84,7 +86,7 @@ public:
     }
     void Print(std::ostream& out) const noexcept override;
 
-    [[nodiscard]] const VariableType& GetValue(Session& host) const override;
+    [[nodiscard]] Value GetValue(Session& host) const override;
 
     [[nodiscard]] std::unique_ptr<ExpressionElement> Clone() const noexcept override
     {
@@ -125,15 +127,15 @@ public:
         return std::make_unique<DeclarationExpr>(*this);
     }
 
-    [[nodiscard]] const VariableType& GetValue(Session& host) const override;
+    [[nodiscard]] Value GetValue(Session& host) const override;
 };
 class IntermediateExpr : public SubExpression
 {
 private:
-    std::string Value;
+    std::string Text;
 
 public:
-    explicit IntermediateExpr(std::string Value) : Value(std::move(Value)) { }
+    explicit IntermediateExpr(std::string Text) : Text(std::move(Text)) { }
 
     [[nodiscard]] SubExpressionType GetType() const noexcept override
     {
@@ -141,16 +143,16 @@ public:
     }
     void Print(std::ostream& out) const noexcept override
     {
-        out << Value;
+        out << Text;
     }
 
-    [[nodiscard]] const VariableType& GetValue(Session& host) const override
+    [[nodiscard]] Value GetValue(Session& host) const override
     {
         throw std::logic_error("Invalid access");
     }
     [[nodiscard]] const std::string& Access() const noexcept
     {
-        return Value;
+        return Text;
     }
 
     [[nodiscard]] std::unique_ptr<ExpressionElement> Clone() const noexcept override
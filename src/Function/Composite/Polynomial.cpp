@@ -1,4 +1,8 @@
 #include "Polynomial.h"
+#include "../FunctionProgram.h"
+#include "../../Calc/SimdKernels.h"
+
+#include <algorithm>
 
 Polynomial::Polynomial(unsigned int InputDim, unsigned int OutputDim) : FunctionBase(InputDim, OutputDim)
 {
@@ -92,6 +96,114 @@ MathVector Polynomial::Evaluate(const MathVector& Obj, bool& Exists) const noexc
     return Output;
 }
 
+void Polynomial::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (this->ChildCount() == 0)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    //The first term is evaluated in place, and the rest are added to it.
+    const auto& simd = SimdKernels();
+    auto end = this->LastChild();
+    auto iter = this->FirstChild();
+    const FunctionBase& first = *iter;
+    first.EvaluateBlock(X, Count, Out, Exists, Scratch);
+    if (first.FlagActive(FunctionFlags::FF_Poly_Neg))
+        for (unsigned r = 0; r < OutputDim; r++)
+            simd.Scale(Out[r], -1.0, Count);
+
+    if (this->ChildCount() == 1)
+        return;
+
+    BlockFrame Term(Scratch, OutputDim);
+    for (iter++; iter != end; iter++)
+    {
+        const FunctionBase& func = *iter;
+        func.EvaluateBlock(X, Count, Term.Rows(), Term.Exists(), Scratch);
+        CombineExists(Exists, Term.Exists(), Count);
+
+        bool Negate = func.FlagActive(FunctionFlags::FF_Poly_Neg);
+        for (unsigned r = 0; r < OutputDim; r++)
+        {
+            if (Negate)
+                simd.Subtract(Out[r], Term.Rows()[r], Count);
+            else
+                simd.Add(Out[r], Term.Rows()[r], Count);
+        }
+    }
+}
+unsigned Polynomial::BlockScratchRows() const noexcept
+{
+    //The terms after the first are evaluated into OutputDim rows of their own.
+    return (this->ChildCount() > 1 ? OutputDim : 0) + FunctionBase::BlockScratchRows();
+}
+bool Polynomial::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (this->ChildCount() == 0)
+        return false;
+
+    for (unsigned r = 0; r < OutputDim; r++)
+        Out[r] = Dual(0.0, Directions);
+
+    std::vector<Dual> Term(OutputDim);
+    try
+    {
+        auto end = this->LastChild();
+        for (auto iter = this->FirstChild(); iter != end; iter++)
+        {
+            const FunctionBase& func = *iter;
+            if (!func.EvaluateDual(X, Directions, Term.data()))
+                return false;
+
+            bool Negate = func.FlagActive(FunctionFlags::FF_Poly_Neg);
+            for (unsigned r = 0; r < OutputDim; r++)
+            {
+                if (Negate)
+                    Out[r] -= Term[r];
+                else
+                    Out[r] += Term[r];
+            }
+        }
+    }
+    catch (std::logic_error&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void Polynomial::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    if (this->ChildCount() == 0)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    //The first term is computed in place, and the rest are added to it. Negated terms have their sign folded into their factor.
+    unsigned Term = this->ChildCount() > 1 ? Out.Allocate(OutputDim) : 0;
+    bool First = true;
+    auto end = this->LastChild();
+    for (auto iter = this->FirstChild(); iter != end; iter++)
+    {
+        const FunctionBase& func = *iter;
+        double TermFactor = func.FlagActive(FunctionFlags::FF_Poly_Neg) ? -Factor : Factor;
+        if (First)
+        {
+            Out.Emit(func, Dest, TermFactor);
+            First = false;
+            continue;
+        }
+
+        Out.Emit(func, Term, TermFactor);
+        for (unsigned i = 0; i < OutputDim; i++)
+            Out.Push(FO_Add, Dest + i, Dest + i, Term + i);
+    }
+}
+
 bool Polynomial::ComparesTo(const FunctionBase* Obj) const noexcept
 {
     const auto* conv = dynamic_cast<const Polynomial*>(Obj);
@@ -13,6 +13,7 @@ class MATH_LIB Polynomial : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Child) noexcept override {}
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
 public:
     Polynomial(unsigned int InputDim, unsigned int OutputDim);
@@ -44,6 +45,9 @@ public:
     [[maybe_unused]] [[nodiscard]] bool RemoveFunction(FunctionBase* Obj, bool Delete);
 
     MathVector Evaluate(const MathVector& Obj, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    [[nodiscard]] unsigned BlockScratchRows() const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
@@ -1,4 +1,8 @@
 #include "RationalFunction.h"
+#include "../FunctionProgram.h"
+#include "../../Calc/SimdKernels.h"
+
+#include <algorithm>
 
 RationalFunction::RationalFunction(unsigned int InputDim) : FunctionBase(InputDim, 1)
 {
@@ -63,7 +67,111 @@ MathVector RationalFunction::Evaluate(const MathVector& X, bool& Exists) const n
         return MathVector::ErrorVector();
     }
 
-    return MathVector(Return);
+    return MathVector::FromList(Return);
+}
+
+void RationalFunction::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (this->ChildCount() == 0)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    const auto& simd = SimdKernels();
+    auto end = this->LastChild();
+    auto iter = this->FirstChild();
+    const FunctionBase& first = *iter;
+    first.EvaluateBlock(X, Count, Out, Exists, Scratch);
+
+    double* y = Out[0];
+    if (first.FlagActive(FunctionFlags::FF_Rat_Inv))
+        for (size_t i = 0; i < Count; i++)
+            y[i] = 1 / y[i];
+
+    if (this->ChildCount() == 1)
+        return;
+
+    BlockFrame Term(Scratch, 1);
+    for (iter++; iter != end; iter++)
+    {
+        const FunctionBase& func = *iter;
+        func.EvaluateBlock(X, Count, Term.Rows(), Term.Exists(), Scratch);
+        CombineExists(Exists, Term.Exists(), Count);
+
+        if (func.FlagActive(FunctionFlags::FF_Rat_Inv))
+            simd.DivideElements(y, Term.Rows()[0], Count);
+        else
+            simd.MultiplyElements(y, Term.Rows()[0], Count);
+    }
+}
+unsigned RationalFunction::BlockScratchRows() const noexcept
+{
+    return (this->ChildCount() > 1 ? 1 : 0) + FunctionBase::BlockScratchRows();
+}
+bool RationalFunction::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (this->ChildCount() == 0)
+        return false;
+
+    Out[0] = Dual(1.0, Directions);
+    Dual Term;
+    try
+    {
+        auto end = this->LastChild();
+        for (auto iter = this->FirstChild(); iter != end; iter++)
+        {
+            const FunctionBase& func = *iter;
+            if (!func.EvaluateDual(X, Directions, &Term))
+                return false;
+
+            if (func.FlagActive(FunctionFlags::FF_Rat_Inv))
+                Out[0] /= Term;
+            else
+                Out[0] *= Term;
+        }
+    }
+    catch (std::logic_error&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void RationalFunction::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    if (this->ChildCount() == 0)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    unsigned Term = this->ChildCount() > 1 ? Out.Allocate() : 0;
+    bool First = true;
+    auto end = this->LastChild();
+    for (auto iter = this->FirstChild(); iter != end; iter++)
+    {
+        const FunctionBase& func = *iter;
+        bool Inverted = func.FlagActive(FunctionFlags::FF_Rat_Inv);
+        if (First)
+        {
+            //The factor goes into the first term, or into its reciprocal.
+            if (Inverted)
+            {
+                Out.Emit(func, Dest, 1.0);
+                Out.Push(FO_Recip, Dest, Dest, 0, Factor);
+            }
+            else
+                Out.Emit(func, Dest, Factor);
+
+            First = false;
+            continue;
+        }
+
+        Out.Emit(func, Term, 1.0);
+        Out.Push(Inverted ? FO_Div : FO_Mul, Dest, Dest, Term);
+    }
 }
 
 bool RationalFunction::ComparesTo(const FunctionBase* Obj) const noexcept
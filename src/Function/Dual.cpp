@@ -0,0 +1,207 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "Dual.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+    void CheckDirections(const Dual& a, const Dual& b)
+    {
+        if (a.Directions() != b.Directions())
+            throw std::logic_error("Cannot combine dual numbers with different numbers of directions.");
+    }
+
+    /// Returns the dual with value F and derivatives SlopeA * a' + SlopeB * b'.
+    Dual Combine(double F, const Dual& a, double SlopeA, const Dual& b, double SlopeB)
+    {
+        CheckDirections(a, b);
+
+        Dual Result(F, a.Directions());
+        double* D = Result.Derivatives.data();
+        const double* DA = a.Derivatives.data(), * DB = b.Derivatives.data();
+        for (size_t i = 0; i < Result.Directions(); i++)
+            D[i] = SlopeA * DA[i] + SlopeB * DB[i];
+
+        return Result;
+    }
+}
+
+Dual::Dual(double Value, size_t Directions) : Value(Value), Derivatives(Directions)
+{
+
+}
+
+Dual Dual::Variable(double Value, size_t Directions, size_t Index)
+{
+    if (Index >= Directions)
+        throw std::logic_error("The index of a dual variable must be less than its number of directions.");
+
+    Dual Result(Value, Directions);
+    Result.Derivatives[Index] = 1.0;
+    return Result;
+}
+
+Dual Dual::Chain(double F, double Slope) const
+{
+    Dual Result(F, Directions());
+    double* D = Result.Derivatives.data();
+    const double* DX = Derivatives.data();
+    for (size_t i = 0; i < Directions(); i++)
+        D[i] = Slope * DX[i];
+
+    return Result;
+}
+
+Dual& Dual::operator+=(const Dual& Obj)
+{
+    CheckDirections(*this, Obj);
+
+    Value += Obj.Value;
+    double* D = Derivatives.data();
+    const double* DO = Obj.Derivatives.data();
+    for (size_t i = 0; i < Directions(); i++)
+        D[i] += DO[i];
+
+    return *this;
+}
+Dual& Dual::operator-=(const Dual& Obj)
+{
+    CheckDirections(*this, Obj);
+
+    Value -= Obj.Value;
+    double* D = Derivatives.data();
+    const double* DO = Obj.Derivatives.data();
+    for (size_t i = 0; i < Directions(); i++)
+        D[i] -= DO[i];
+
+    return *this;
+}
+Dual& Dual::operator*=(const Dual& Obj)
+{
+    //(uv)' = u'v + uv'
+    CheckDirections(*this, Obj);
+
+    double* D = Derivatives.data();
+    const double* DO = Obj.Derivatives.data();
+    for (size_t i = 0; i < Directions(); i++)
+        D[i] = D[i] * Obj.Value + Value * DO[i];
+
+    Value *= Obj.Value;
+    return *this;
+}
+Dual& Dual::operator/=(const Dual& Obj)
+{
+    //(u/v)' = (u' - (u/v) v') / v
+    CheckDirections(*this, Obj);
+
+    Value /= Obj.Value;
+    double* D = Derivatives.data();
+    const double* DO = Obj.Derivatives.data();
+    for (size_t i = 0; i < Directions(); i++)
+        D[i] = (D[i] - Value * DO[i]) / Obj.Value;
+
+    return *this;
+}
+Dual& Dual::operator*=(double Fac) noexcept
+{
+    Value *= Fac;
+    double* D = Derivatives.data();
+    for (size_t i = 0; i < Directions(); i++)
+        D[i] *= Fac;
+
+    return *this;
+}
+
+Dual Dual::operator-() const
+{
+    return Chain(-Value, -1.0);
+}
+
+Dual Dual::Pow(const Dual& X, double N)
+{
+    //N x^(N - 1) is undefined at zero when N is zero, but x^0 is constant.
+    double Slope = N == 0.0 ? 0.0 : N * pow(X.Value, N - 1.0);
+    return X.Chain(pow(X.Value, N), Slope);
+}
+Dual Dual::Pow(const Dual& X, const Dual& N)
+{
+    //d(x^n) = n x^(n - 1) dx + x^n ln(x) dn. The second term is only defined for positive x, and is dropped otherwise.
+    double F = pow(X.Value, N.Value);
+    double SlopeX = N.Value == 0.0 ? 0.0 : N.Value * pow(X.Value, N.Value - 1.0);
+    double SlopeN = X.Value > 0.0 ? F * log(X.Value) : 0.0;
+    return Combine(F, X, SlopeX, N, SlopeN);
+}
+Dual Dual::Pow(double Base, const Dual& X)
+{
+    double F = pow(Base, X.Value);
+    return X.Chain(F, F * log(Base));
+}
+Dual Dual::Log(const Dual& X)
+{
+    return X.Chain(log(X.Value), 1.0 / X.Value);
+}
+Dual Dual::Abs(const Dual& X)
+{
+    double Sign = X.Value > 0.0 ? 1.0 : X.Value < 0.0 ? -1.0 : 0.0;
+    return X.Chain(fabs(X.Value), Sign);
+}
+Dual Dual::Sin(const Dual& X)
+{
+    return X.Chain(sin(X.Value), cos(X.Value));
+}
+Dual Dual::Cos(const Dual& X)
+{
+    return X.Chain(cos(X.Value), -sin(X.Value));
+}
+Dual Dual::Tan(const Dual& X)
+{
+    double F = tan(X.Value);
+    return X.Chain(F, 1.0 + F * F);
+}
+Dual Dual::Asin(const Dual& X)
+{
+    return X.Chain(asin(X.Value), 1.0 / sqrt(1.0 - X.Value * X.Value));
+}
+Dual Dual::Acos(const Dual& X)
+{
+    return X.Chain(acos(X.Value), -1.0 / sqrt(1.0 - X.Value * X.Value));
+}
+Dual Dual::Atan(const Dual& X)
+{
+    return X.Chain(atan(X.Value), 1.0 / (1.0 + X.Value * X.Value));
+}
+
+Dual operator+(Dual a, const Dual& b)
+{
+    a += b;
+    return a;
+}
+Dual operator-(Dual a, const Dual& b)
+{
+    a -= b;
+    return a;
+}
+Dual operator*(Dual a, const Dual& b)
+{
+    a *= b;
+    return a;
+}
+Dual operator/(Dual a, const Dual& b)
+{
+    a /= b;
+    return a;
+}
+Dual operator*(Dual a, double b) noexcept
+{
+    a *= b;
+    return a;
+}
+Dual operator*(double a, Dual b) noexcept
+{
+    b *= a;
+    return b;
+}
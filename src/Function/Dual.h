@@ -0,0 +1,73 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_DUAL_H
+#define JASON_DUAL_H
+
+#include "FunctionCommon.h"
+#include "../Calc/MathVector.h"
+
+/*
+ * DUAL NUMBERS
+ *
+ * A dual number is a value v together with its derivatives along some number of directions, v + D e where e * e = 0. Carrying duals through
+ * arithmetic applies the chain rule at every step, so evaluating a function on duals gives its value and its derivatives in one pass, exactly up to
+ * rounding (forward mode automatic differentiation). FunctionBase::EvaluateDual does this for every function, and FunctionBase::EvaluateJacobian
+ * seeds input j with the j-th unit direction to get the whole Jacobian at once, in place of InputDim + 1 evaluations for finite differences.
+ *
+ * At points where a function is not differentiable, the derivative is that of the branch the value came from: |x| has slope zero at zero, and
+ * powers with a non-positive base ignore the derivative of the exponent.
+ */
+
+/// \brief A value with its derivatives along Directions() directions, usually the partial derivatives with respect to each input of a function.
+class MATH_LIB Dual
+{
+public:
+    Dual() = default;
+    /// \brief A constant: Value, with all Directions derivatives zero.
+    Dual(double Value, size_t Directions);
+
+    /// \brief The input Index of Directions inputs: Value, with derivative one along Index and zero along every other direction.
+    [[nodiscard]] static Dual Variable(double Value, size_t Directions, size_t Index);
+
+    double Value = 0.0;
+    MathVector Derivatives;
+
+    [[nodiscard]] size_t Directions() const noexcept { return Derivatives.Dim(); }
+
+    /// \brief Returns f(*this) for some function f, given F = f(Value) and Slope = f'(Value). This is the chain rule, and the elementary functions below are built on it.
+    [[nodiscard]] Dual Chain(double F, double Slope) const;
+
+    Dual& operator+=(const Dual& Obj);
+    Dual& operator-=(const Dual& Obj);
+    Dual& operator*=(const Dual& Obj);
+    Dual& operator/=(const Dual& Obj);
+    Dual& operator*=(double Fac) noexcept;
+
+    [[nodiscard]] Dual operator-() const;
+
+    /// \brief X ^ N for a constant N.
+    [[nodiscard]] static Dual Pow(const Dual& X, double N);
+    /// \brief X ^ N.
+    [[nodiscard]] static Dual Pow(const Dual& X, const Dual& N);
+    /// \brief Base ^ X for a constant Base.
+    [[nodiscard]] static Dual Pow(double Base, const Dual& X);
+    [[nodiscard]] static Dual Log(const Dual& X);
+    [[nodiscard]] static Dual Abs(const Dual& X);
+    [[nodiscard]] static Dual Sin(const Dual& X);
+    [[nodiscard]] static Dual Cos(const Dual& X);
+    [[nodiscard]] static Dual Tan(const Dual& X);
+    [[nodiscard]] static Dual Asin(const Dual& X);
+    [[nodiscard]] static Dual Acos(const Dual& X);
+    [[nodiscard]] static Dual Atan(const Dual& X);
+};
+
+[[nodiscard]] Dual operator+(Dual a, const Dual& b);
+[[nodiscard]] Dual operator-(Dual a, const Dual& b);
+[[nodiscard]] Dual operator*(Dual a, const Dual& b);
+[[nodiscard]] Dual operator/(Dual a, const Dual& b);
+[[nodiscard]] Dual operator*(Dual a, double b) noexcept;
+[[nodiscard]] Dual operator*(double a, Dual b) noexcept;
+
+#endif //JASON_DUAL_H
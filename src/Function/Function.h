@@ -6,6 +6,8 @@
 
 //Base
 #include "FunctionBase.h"
+#include "FunctionBatch.h"
+#include "Dual.h"
 
 //Impls
 #include "Impls/CoreFunctions.h"
@@ -14,4 +16,8 @@
 
 //Composite Functions
 #include "Composite/Polynomial.h"
-#include "Composite/RationalFunction.h"
\ No newline at end of file
+#include "Composite/RationalFunction.h"
+
+//Compilation
+#include "FunctionProgram.h"
+#include "FunctionTape.h"
\ No newline at end of file
@@ -1,4 +1,8 @@
 #include "FunctionBase.h"
+#include "FunctionProgram.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 FunctionBase::FunctionBase(unsigned int Input, unsigned int Output) : InputDim(Input), OutputDim(Output)
@@ -26,7 +30,7 @@ FunctionBase::~FunctionBase()
 
 [[nodiscard]] bool FunctionBase::PushChild(FunctionBase* New) noexcept
 {
-    if (!New || New->Parent == this || New->InputDim != this->InputDim || New->OutputDim != this->OutputDim) //Empty, already contained, or full.
+    if (!New || New->Parent == this || !AcceptsChild(*New)) //Empty, already contained, or the wrong dimensions.
         return false;
 
     if (New->Parent != nullptr && !New->RemoveParent())
@@ -47,14 +51,19 @@ FunctionBase::~FunctionBase()
     }
     else
     {
-        New->Previous = Last->Previous;
+        New->Previous = Last;
         New->Next = nullptr;
-        Last->Next = Last = New;
+        Last->Next = New;
+        Last = New;
     }
 
     Children++;
     return true;
 }
+bool FunctionBase::AcceptsChild(const FunctionBase& New) const noexcept
+{
+    return New.InputDim == this->InputDim && New.OutputDim == this->OutputDim;
+}
 [[nodiscard]] bool FunctionBase::PopChild(FunctionBase* obj, bool Delete) noexcept
 {
     if (!obj || obj->Parent != this) //Null or not contained
@@ -197,7 +206,7 @@ FunctionIterator FunctionBase::FirstChild() noexcept
 }
 FunctionIterator FunctionBase::LastChild() noexcept
 {
-    return FunctionIterator(Last);
+    return FunctionIterator(nullptr); //One past the last child, so that loops up to LastChild() visit every child.
 }
 ConstFunctionIterator FunctionBase::FirstChild() const noexcept
 {
@@ -205,7 +214,7 @@ ConstFunctionIterator FunctionBase::FirstChild() const noexcept
 }
 ConstFunctionIterator FunctionBase::LastChild() const noexcept
 {
-    return ConstFunctionIterator(Last);
+    return ConstFunctionIterator(nullptr);
 }
 
 [[nodiscard]] bool FunctionBase::FlagActive(FunctionFlags Flag) const noexcept
@@ -218,19 +227,14 @@ void FunctionBase::SetFlag(FunctionFlags Flag, bool Active) noexcept
     if (Prev == Active)
         return;
 
-    unsigned char NewFlag = Active ? Flag : ~Flag;
-    this->Flags &= NewFlag;
+    if (Active)
+        this->Flags |= static_cast<unsigned char>(Flag);
+    else
+        this->Flags &= static_cast<unsigned char>(~Flag);
 }
 void FunctionBase::InvertFlag(FunctionFlags Flag) noexcept
 {
-    bool Prev = FlagActive(Flag);
-    unsigned char Result;
-    if (Prev)
-        Result = static_cast<unsigned char>(~Flag);
-    else
-        Result = static_cast<unsigned char>(Flag);
-
-    this->Flags &= Result;
+    this->Flags ^= static_cast<unsigned char>(Flag);
 }
 
 FunctionBase& FunctionBase::Get(FunctionBase* Binding)
@@ -241,7 +245,165 @@ FunctionBase& FunctionBase::Get(FunctionBase* Binding)
     return *Binding;
 }
 
+void FunctionBase::EvaluateMany(const VectorBatch& X, VectorBatch& Out, ExistsMask& Exists) const
+{
+    size_t Count = X.Count();
+    Exists.Reset(Count, false);
+    if (X.Dim() != InputDim || Count == 0)
+        return;
+
+    if (Out.Dim() != OutputDim || Out.Count() != Count)
+        Out = VectorBatch(OutputDim, Count);
+
+    std::vector<const double*> In(InputDim);
+    std::vector<double*> Result(OutputDim);
+    unsigned char Flags[BlockSize];
+    BlockScratch Scratch(BlockScratchRows(), std::min(BlockSize, Count));
+    for (size_t Start = 0; Start < Count; Start += BlockSize)
+    {
+        size_t Length = std::min(BlockSize, Count - Start);
+        for (unsigned c = 0; c < InputDim; c++)
+            In[c] = X.Component(c) + Start;
+        for (unsigned r = 0; r < OutputDim; r++)
+            Result[r] = Out.Component(r) + Start;
+
+        EvaluateBlock(In.data(), Length, Result.data(), Flags, Scratch);
+        Exists.Store(Start, Flags, Length);
+    }
+}
+void FunctionBase::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    MathVector Point(InputDim);
+    for (size_t i = 0; i < Count; i++)
+    {
+        for (unsigned c = 0; c < InputDim; c++)
+            Point[c] = X[c][i];
+
+        bool Exist = false;
+        MathVector Result = Evaluate(Point, Exist);
+        Exists[i] = Exist && Result.Dim() == OutputDim;
+        if (Exists[i])
+            for (unsigned r = 0; r < OutputDim; r++)
+                Out[r][i] = Result[r];
+    }
+}
+
+unsigned FunctionBase::BlockScratchRows() const noexcept
+{
+    unsigned Rows = 0;
+    auto end = this->LastChild();
+    for (auto iter = this->FirstChild(); iter != end; iter++)
+        Rows = std::max(Rows, iter->BlockScratchRows());
+
+    return Rows;
+}
+
+void FunctionBase::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    Out.Call(*this, Dest, Factor);
+}
+
 FunctionBase& FunctionBase::operator-()
 {
     A = -A; return *this;
-}
\ No newline at end of file
+}
+
+bool FunctionBase::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    MathVector Point(InputDim);
+    for (unsigned j = 0; j < InputDim; j++)
+        Point[j] = X[j].Value;
+
+    bool Exists = false;
+    MathVector Value = Evaluate(Point, Exists);
+    if (!Exists || Value.Dim() != OutputDim)
+        return false;
+
+    for (unsigned r = 0; r < OutputDim; r++)
+        Out[r] = Dual(Value[r], Directions);
+
+    //The slope along each input, by central differences (one sided where only one side exists), applied to the derivatives of that input.
+    static const double Step = std::cbrt(std::numeric_limits<double>::epsilon());
+    for (unsigned j = 0; j < InputDim; j++)
+    {
+        double x = X[j].Value, h = Step * std::max(1.0, fabs(x));
+        bool PlusExists = false, MinusExists = false;
+        Point[j] = x + h;
+        MathVector Plus = Evaluate(Point, PlusExists);
+        Point[j] = x - h;
+        MathVector Minus = Evaluate(Point, MinusExists);
+        Point[j] = x;
+
+        double Width = 2 * h;
+        if (!PlusExists)
+        {
+            Plus = Value;
+            Width = h;
+        }
+        if (!MinusExists)
+        {
+            Minus = Value;
+            Width = PlusExists ? h : 0.0;
+        }
+        if (Width == 0.0)
+            return false;
+
+        for (unsigned r = 0; r < OutputDim; r++)
+        {
+            double Slope = (Plus[r] - Minus[r]) / Width;
+            double* D = Out[r].Derivatives.data();
+            const double* DX = X[j].Derivatives.data();
+            for (size_t k = 0; k < Directions; k++)
+                D[k] += Slope * DX[k];
+        }
+    }
+
+    return true;
+}
+MathVector FunctionBase::EvaluateJacobian(const MathVector& X, Matrix& Jacobian, bool& Exists) const noexcept
+{
+    Exists = X.Dim() == InputDim;
+    std::vector<Dual> In, Out(OutputDim);
+    if (Exists)
+    {
+        In.reserve(InputDim);
+        for (unsigned j = 0; j < InputDim; j++)
+            In.push_back(Dual::Variable(X[j], InputDim, j));
+
+        Exists = EvaluateDual(In.data(), InputDim, Out.data());
+    }
+
+    if (!Exists)
+    {
+        Jacobian = Matrix::ErrorMatrix();
+        return MathVector::ErrorVector();
+    }
+
+    MathVector Result(OutputDim);
+    Jacobian = Matrix(OutputDim, InputDim);
+    for (unsigned r = 0; r < OutputDim; r++)
+    {
+        Result[r] = Out[r].Value;
+        for (unsigned c = 0; c < InputDim; c++)
+            Jacobian[r][c] = Out[r].Derivatives[c];
+    }
+
+    return Result;
+}
+MathVector FunctionBase::Gradient(const MathVector& X, bool& Exists) const noexcept
+{
+    Exists = OutputDim == 1;
+    if (!Exists)
+        return MathVector::ErrorVector();
+
+    Matrix Jacobian = Matrix::ErrorMatrix();
+    (void)EvaluateJacobian(X, Jacobian, Exists);
+    if (!Exists)
+        return MathVector::ErrorVector();
+
+    MathVector Result(InputDim);
+    for (unsigned c = 0; c < InputDim; c++)
+        Result[c] = Jacobian[0][c];
+
+    return Result;
+}
@@ -6,9 +6,12 @@
 #define JASON_FUNCTIONBASE_H
 
 #include "FunctionIterator.h"
-#include "../Calc/StdCalc.h"
-#include "../Calc/Numerics/MathVector.h"
-#include "../Calc/Numerics/Matrix.h"
+#include "FunctionBatch.h"
+#include "Dual.h"
+#include "FunctionCommon.h"
+#include "../Calc/MathVector.h"
+#include "../Calc/Matrix.h"
+#include "../Calc/VectorBatch.h"
 
 enum FunctionFlags
 {
@@ -16,6 +19,8 @@ enum FunctionFlags
     FF_Rat_Inv = 2, //For inversion, rational functions
 };
 
+class MATH_LIB FunctionCompiler;
+
 /// \brief Represents a function, or a mathematical object with a specified number of inputs and output. This class also handles all children of a function.
 class MATH_LIB FunctionBase
 {
@@ -37,8 +42,10 @@ protected:
     /// \param Child The child being removed.
     virtual void ChildRemoved(FunctionBase* Child) noexcept = 0;
 
-    /// \breif Inserts a child into the list, and calls New->RemoveParent() if New->Parent != nullptr. Fails if The dimensions do not match.
+    /// \breif Inserts a child into the list, and calls New->RemoveParent() if New->Parent != nullptr. Fails if AcceptsChild(*New) is false.
     [[nodiscard]] bool PushChild(FunctionBase* New) noexcept;
+    /// \brief Determines if New has the right dimensions to be a child of this function. The default requires the same input and output dimensions.
+    [[nodiscard]] virtual bool AcceptsChild(const FunctionBase& New) const noexcept;
     /// \breif Removes a child from the list, presuming that the child is contained in this list.
     /// \param obj The function to remove.
     /// \param Delete Deletes 'obj' if true.
@@ -62,6 +69,10 @@ protected:
     [[nodiscard]] FunctionIterator FirstChild() noexcept;
     [[nodiscard]] FunctionIterator LastChild() noexcept;
 
+    /// \brief Lowers this function into bytecode (see FunctionProgram.h), so that registers Dest to Dest + OutputDim - 1 receive Factor times its value. Children are lowered with Out.Emit.
+    /// The default calls Evaluate from the program, so only override this with an exact equivalent of Evaluate.
+    virtual void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const;
+
 public:
     FunctionBase(const FunctionBase& Obj) = delete;
     FunctionBase(FunctionBase&& Obj) = delete;
@@ -69,6 +80,7 @@ public:
 
     friend class FunctionIterator;
     friend class ConstFunctionIterator;
+    friend class FunctionCompiler;
 
     FunctionBase& operator=(const FunctionBase& Obj) = delete;
     FunctionBase& operator=(FunctionBase&& Obj) = delete;
@@ -94,6 +106,39 @@ public:
     /// \return MathVector::ErrorVector() if 'Exists' is false, otherwise a MathVector of dimension 'this->OutputDim' containing the result of the computation.
     [[nodiscard]] virtual MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept = 0;
 
+    /// \brief The number of points handed to EvaluateBlock at once by EvaluateMany, so that the temporaries of each block stay in cache.
+    static constexpr size_t BlockSize = VectorBatch::ChunkSize;
+
+    /// \brief Evaluates the function at every point of X, with the same existence as calling Evaluate on each point, and the same values to within
+    /// the error bounds of VectorMath(), which the built in functions use for their elementary functions.
+    /// \param X The points, as a batch of dimension InputDim. If X.Dim() != InputDim, the function exists nowhere.
+    /// \param Out Receives the results as a batch of dimension OutputDim, one vector per point. It is reallocated unless it already has that shape.
+    /// \param Exists Receives one bit per point, set where the function exists. The vectors of Out where it does not are unspecified.
+    void EvaluateMany(const VectorBatch& X, VectorBatch& Out, ExistsMask& Exists) const;
+    /// \brief The kernel behind EvaluateMany, for up to BlockSize points in structure of arrays form. The default calls Evaluate on each point.
+    /// \param X InputDim arrays of Count doubles, one per input component.
+    /// \param Count The number of points.
+    /// \param Out OutputDim arrays of Count doubles, which receive the output components.
+    /// \param Exists Count flags, each set to one where the function exists and zero where it does not.
+    /// \param Scratch Storage for temporaries, of at least Count points and with BlockScratchRows() rows Free().
+    virtual void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept;
+    /// \brief The number of rows of BlockScratch that EvaluateBlock takes at once, counting those of the children it evaluates. The default is the most any child takes.
+    [[nodiscard]] virtual unsigned BlockScratchRows() const noexcept;
+
+    /// \brief Evaluates the function on dual numbers (see Dual.h), giving its value and its derivatives along the directions of X in one pass.
+    /// The default differentiates Evaluate numerically, by central differences, so the built in functions all override it with their exact derivatives.
+    /// \param X InputDim duals, which must all have Directions directions.
+    /// \param Directions The number of directions of each dual, which the outputs are given too.
+    /// \param Out OutputDim duals, which receive the outputs and their derivatives along the directions of X.
+    /// \return True if the function exists at the values of X, false otherwise (and Out is left unspecified).
+    virtual bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept;
+    /// \brief Evaluates the function and its Jacobian at X, in one forward mode pass with one direction per input.
+    /// \param Jacobian Receives the OutputDim x InputDim matrix of partial derivatives, where row i is the gradient of output i. It is Matrix::ErrorMatrix() if Exists is false.
+    /// \return The value at X, as Evaluate would return it, or MathVector::ErrorVector() if Exists is false.
+    [[nodiscard]] MathVector EvaluateJacobian(const MathVector& X, Matrix& Jacobian, bool& Exists) const noexcept;
+    /// \brief The gradient at X of a function with one output. Exists is false if OutputDim != 1.
+    [[nodiscard]] MathVector Gradient(const MathVector& X, bool& Exists) const noexcept;
+
     [[nodiscard]] bool FlagActive(FunctionFlags Flag) const noexcept;
     void SetFlag(FunctionFlags Flag, bool Active) noexcept;
     void InvertFlag(FunctionFlags Flag) noexcept;
@@ -0,0 +1,75 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "FunctionBatch.h"
+
+#include <algorithm>
+#include <bit>
+
+ExistsMask::ExistsMask(size_t Count, bool Value)
+{
+    Reset(Count, Value);
+}
+
+void ExistsMask::Reset(size_t NewCount, bool Value)
+{
+    Count = NewCount;
+    Words.assign((Count + 63) / 64, Value ? ~uint64_t(0) : uint64_t(0));
+    if (Value && Count % 64 != 0)
+        Words.back() = (uint64_t(1) << (Count % 64)) - 1;
+}
+void ExistsMask::Store(size_t Offset, const unsigned char* Flags, size_t Length) noexcept
+{
+    size_t i = 0;
+    for (; i < Length && (Offset + i) % 64 != 0; i++)
+        Set(Offset + i, Flags[i] != 0);
+
+    //Whole words at once.
+    for (; i + 64 <= Length; i += 64)
+    {
+        uint64_t Word = 0;
+        for (unsigned j = 0; j < 64; j++)
+            Word |= uint64_t(Flags[i + j] != 0) << j;
+
+        Words[(Offset + i) / 64] = Word;
+    }
+
+    for (; i < Length; i++)
+        Set(Offset + i, Flags[i] != 0);
+}
+void ExistsMask::Set(size_t i, bool Value) noexcept
+{
+    uint64_t Bit = uint64_t(1) << (i % 64);
+    if (Value)
+        Words[i / 64] |= Bit;
+    else
+        Words[i / 64] &= ~Bit;
+}
+
+size_t ExistsMask::CountSet() const noexcept
+{
+    size_t Result = 0;
+    for (uint64_t Word : Words)
+        Result += std::popcount(Word);
+
+    return Result;
+}
+
+BlockScratch::BlockScratch(unsigned RowCount, size_t Count) : Rows(RowCount), Stride((Count + 7) & ~size_t(7))
+{
+    //Each row starts on its own cache line.
+    Storage.resize(Stride * RowCount);
+    Flags.resize(Stride * RowCount);
+    for (unsigned r = 0; r < RowCount; r++)
+        Rows[r] = Storage.data() + r * Stride;
+}
+
+BlockFrame::BlockFrame(BlockScratch& Scratch, unsigned RowCount) noexcept : Scratch(Scratch), First(Scratch.Used)
+{
+    Scratch.Used += RowCount;
+}
+BlockFrame::~BlockFrame()
+{
+    Scratch.Used = First;
+}
@@ -0,0 +1,91 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_FUNCTIONBATCH_H
+#define JASON_FUNCTIONBATCH_H
+
+#include "FunctionCommon.h"
+#include "../Calc/AlignedAllocator.h"
+
+#include <cstdint>
+#include <vector>
+
+/// \brief One bit per point of a batch evaluation, set where the function exists.
+class MATH_LIB ExistsMask
+{
+private:
+    std::vector<uint64_t> Words;
+    size_t Count = 0;
+
+public:
+    ExistsMask() = default;
+    explicit ExistsMask(size_t Count, bool Value = false);
+
+    /// \brief Resizes the mask to Count bits, all set to Value.
+    void Reset(size_t Count, bool Value);
+    /// \brief Packs Count flags (zero or one, as written by FunctionBase::EvaluateBlock) into bits Offset to Offset + Count - 1.
+    void Store(size_t Offset, const unsigned char* Flags, size_t Count) noexcept;
+
+    [[nodiscard]] size_t Size() const noexcept { return Count; }
+    [[nodiscard]] bool operator[](size_t i) const noexcept { return (Words[i / 64] >> (i % 64)) & 1u; }
+    void Set(size_t i, bool Value) noexcept;
+
+    /// \brief The number of points where the function exists.
+    [[nodiscard]] size_t CountSet() const noexcept;
+    [[nodiscard]] bool All() const noexcept { return CountSet() == Count; }
+    [[nodiscard]] bool None() const noexcept { return CountSet() == 0; }
+
+    /// \brief The bits, 64 points per word, with point i at bit i % 64 of word i / 64. Bits past Size() are zero.
+    [[nodiscard]] const std::vector<uint64_t>& Data() const noexcept { return Words; }
+};
+
+/// \brief Scratch storage for the blocks of a batch evaluation: RowCount rows of Count doubles, each with Count existence flags.
+/// FunctionBase::EvaluateMany allocates one, with FunctionBase::BlockScratchRows() rows, and hands it down through EvaluateBlock.
+/// Composite functions take the rows they evaluate their children into off the top with a BlockFrame, as on a stack, so no block allocates.
+class MATH_LIB BlockScratch
+{
+private:
+    std::vector<double, AlignedAllocator<double>> Storage;
+    std::vector<double*> Rows;
+    std::vector<unsigned char> Flags;
+    size_t Stride;
+    unsigned Used = 0;
+
+    friend class BlockFrame;
+
+public:
+    BlockScratch(unsigned RowCount, size_t Count);
+
+    /// \brief The number of rows not yet taken by a BlockFrame.
+    [[nodiscard]] unsigned Free() const noexcept { return static_cast<unsigned>(Rows.size()) - Used; }
+};
+
+/// \brief RowCount rows taken from a BlockScratch, which are given back when the frame goes out of scope. Frames must be destroyed in the
+/// reverse order they were made, which scoping them to the EvaluateBlock that makes them gives. The scratch must have RowCount rows Free().
+class MATH_LIB BlockFrame
+{
+private:
+    BlockScratch& Scratch;
+    unsigned First;
+
+public:
+    BlockFrame(BlockScratch& Scratch, unsigned RowCount) noexcept;
+    BlockFrame(const BlockFrame& Obj) = delete;
+    BlockFrame& operator=(const BlockFrame& Obj) = delete;
+    ~BlockFrame();
+
+    /// \brief The output arrays of the frame, to be passed as Out to EvaluateBlock.
+    [[nodiscard]] double* const* Rows() const noexcept { return Scratch.Rows.data() + First; }
+    /// \brief Count existence flags, to be passed as Exists to EvaluateBlock.
+    [[nodiscard]] unsigned char* Exists() const noexcept { return Scratch.Flags.data() + First * Scratch.Stride; }
+};
+
+/// \brief Sets Exists[i] to zero wherever Other[i] is zero.
+inline void CombineExists(unsigned char* Exists, const unsigned char* Other, size_t Count) noexcept
+{
+    for (size_t i = 0; i < Count; i++)
+        Exists[i] &= Other[i];
+}
+
+#endif //JASON_FUNCTIONBATCH_H
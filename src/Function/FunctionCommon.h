@@ -0,0 +1,13 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_FUNCTIONCOMMON_H
+#define JASON_FUNCTIONCOMMON_H
+
+/// \brief Marks the classes exported by the Function library. GCC and Clang export every symbol of a shared library by default, so it expands to nothing.
+#ifndef MATH_LIB
+#define MATH_LIB
+#endif
+
+#endif //JASON_FUNCTIONCOMMON_H
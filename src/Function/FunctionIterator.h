@@ -6,7 +6,7 @@
 #define JASON_FUNCTIONITERATOR_H
 
 #include <iterator>
-#include "../Calc/StdCalc.h"
+#include "FunctionCommon.h"
 
 class MATH_LIB FunctionBase;
 
@@ -0,0 +1,224 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "FunctionProgram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+FunctionCompiler::FunctionCompiler(unsigned InputDim) noexcept : InputDim(InputDim), Top(InputDim), Peak(InputDim)
+{
+
+}
+
+unsigned FunctionCompiler::Input(unsigned Var) const
+{
+    if (Var >= InputDim)
+        throw std::logic_error("The variable is out of the range of the function's inputs.");
+
+    return Var;
+}
+
+unsigned FunctionCompiler::Allocate(unsigned Count) noexcept
+{
+    unsigned Result = Top;
+    Top += Count;
+    Peak = std::max(Peak, Top);
+    return Result;
+}
+void FunctionCompiler::Release(unsigned Mark) noexcept
+{
+    if (Mark < Top)
+        Top = Mark;
+}
+
+void FunctionCompiler::Push(FunctionOps Op, unsigned Dest, unsigned One, unsigned Two, double Imm)
+{
+    Code.push_back(FunctionInstruction{ Op, Dest, One, Two, Imm });
+}
+void FunctionCompiler::Scale(unsigned Dest, unsigned One, double Factor)
+{
+    if (Factor != 1.0)
+        Push(FO_Scale, Dest, One, 0, Factor);
+    else if (Dest != One)
+        Push(FO_Copy, Dest, One);
+}
+
+void FunctionCompiler::Power(unsigned Dest, unsigned One, double N, double Factor)
+{
+    if (N == 0.0) //pow(x, 0) is one for every x, even NaN.
+        Push(FO_Const, Dest, 0, 0, Factor);
+    else if (N == 1.0)
+        Scale(Dest, One, Factor);
+    else
+    {
+        if (N == 2.0)
+            Push(FO_Square, Dest, One);
+        else
+            Push(FO_PowConst, Dest, One, 0, N);
+
+        Scale(Dest, Dest, Factor);
+    }
+}
+
+void FunctionCompiler::Emit(const FunctionBase& Func, unsigned Dest, double Factor)
+{
+    unsigned Start = Mark();
+    Func.Emit(*this, Dest, Factor);
+    Release(Start);
+}
+void FunctionCompiler::Call(const FunctionBase& Func, unsigned Dest, double Factor)
+{
+    auto Index = static_cast<unsigned>(Calls.size());
+    Calls.push_back(&Func);
+    Push(FO_Call, Dest, Index, 0, Factor);
+}
+
+FunctionProgram FunctionProgram::Compile(const FunctionBase& Func)
+{
+    FunctionCompiler Out(Func.InputDim);
+    unsigned Dest = Out.Allocate(Func.OutputDim);
+    Out.Emit(Func, Dest, 1.0);
+
+    FunctionProgram Result;
+    Result.Code = std::move(Out.Code);
+    Result.Calls = std::move(Out.Calls);
+    Result.InputDim = Func.InputDim;
+    Result.OutputDim = Func.OutputDim;
+    Result.Registers = Out.Peak;
+    return Result;
+}
+
+bool FunctionProgram::Execute(const double* X, double* Out, double* Work) const noexcept
+{
+    double* R = Work;
+    std::copy(X, X + InputDim, R);
+
+    for (const FunctionInstruction& I : Code)
+    {
+        switch (I.Op)
+        {
+        case FO_Const:
+            R[I.Dest] = I.Imm;
+            break;
+        case FO_Copy:
+            R[I.Dest] = R[I.One];
+            break;
+        case FO_Scale:
+            R[I.Dest] = I.Imm * R[I.One];
+            break;
+        case FO_Add:
+            R[I.Dest] = R[I.One] + R[I.Two];
+            break;
+        case FO_Sub:
+            R[I.Dest] = R[I.One] - R[I.Two];
+            break;
+        case FO_Mul:
+            R[I.Dest] = R[I.One] * R[I.Two];
+            break;
+        case FO_Div:
+            R[I.Dest] = R[I.One] / R[I.Two];
+            break;
+        case FO_Recip:
+            R[I.Dest] = I.Imm / R[I.One];
+            break;
+        case FO_Square:
+            R[I.Dest] = R[I.One] * R[I.One];
+            break;
+        case FO_PowConst:
+            R[I.Dest] = std::pow(R[I.One], I.Imm);
+            break;
+        case FO_Pow:
+            R[I.Dest] = std::pow(R[I.One], R[I.Two]);
+            break;
+        case FO_ExpBase:
+            R[I.Dest] = std::pow(I.Imm, R[I.One]);
+            break;
+        case FO_Log:
+            R[I.Dest] = I.Imm * std::log(R[I.One]);
+            break;
+        case FO_Abs:
+            R[I.Dest] = std::fabs(R[I.One]);
+            break;
+        case FO_Sin:
+            R[I.Dest] = std::sin(R[I.One]);
+            break;
+        case FO_Cos:
+            R[I.Dest] = std::cos(R[I.One]);
+            break;
+        case FO_Tan:
+            R[I.Dest] = std::tan(R[I.One]);
+            break;
+        case FO_Asin:
+            R[I.Dest] = std::asin(R[I.One]);
+            break;
+        case FO_Acos:
+            R[I.Dest] = std::acos(R[I.One]);
+            break;
+        case FO_Atan:
+            R[I.Dest] = std::atan(R[I.One]);
+            break;
+        case FO_RequirePositive:
+            if (!(R[I.One] > 0.0))
+                return false;
+            break;
+        case FO_RequireUnit:
+            if (!(R[I.One] >= -1.0 && R[I.One] <= 1.0))
+                return false;
+            break;
+        case FO_RequireFinite:
+            if (R[I.One] == std::numeric_limits<double>::infinity())
+                return false;
+            break;
+        case FO_Call:
+        {
+            const FunctionBase& Func = *Calls[I.One];
+            bool Exists = false;
+            try
+            {
+                MathVector In(InputDim);
+                std::copy(R, R + InputDim, In.data());
+                MathVector Result = Func.Evaluate(In, Exists);
+                if (!Exists || Result.Dim() < Func.OutputDim)
+                    return false;
+
+                for (unsigned j = 0; j < Func.OutputDim; j++)
+                    R[I.Dest + j] = I.Imm * Result[j];
+            }
+            catch (std::exception&)
+            {
+                return false;
+            }
+            break;
+        }
+        case FO_Fail:
+        default:
+            return false;
+        }
+    }
+
+    std::copy(R + InputDim, R + InputDim + OutputDim, Out);
+    return true;
+}
+
+MathVector FunctionProgram::Evaluate(const MathVector& X, bool& Exists) const noexcept
+{
+    Exists = false;
+    if (X.Dim() != InputDim)
+        return MathVector::ErrorVector();
+
+    try
+    {
+        std::vector<double> Work(Registers);
+        MathVector Result(OutputDim);
+        Exists = Execute(X.data(), Result.data(), Work.data());
+        return Exists ? Result : MathVector::ErrorVector();
+    }
+    catch (std::exception&)
+    {
+        Exists = false;
+        return MathVector::ErrorVector();
+    }
+}
@@ -0,0 +1,142 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_FUNCTIONPROGRAM_H
+#define JASON_FUNCTIONPROGRAM_H
+
+#include "FunctionBase.h"
+
+#include <vector>
+
+/*
+ * FUNCTION PROGRAMS
+ *
+ * FunctionBase::Evaluate walks the function tree, makes a virtual call per node, and allocates a MathVector at every level. That is fine for a
+ * single value, but plotting or integrating a function samples it millions of times. A FunctionProgram is the same function lowered into a flat
+ * list of register instructions over doubles, which is run by one loop with no allocation and no virtual calls.
+ *
+ * The registers start with the InputDim inputs, followed by the outputs and then temporaries, which are reused once the node that needed them is
+ * done. Everything the tree decides per call is decided once at compile time instead:
+ *  - The A factors, and the FF_Poly_Neg flags of polynomial terms, are folded into a single factor per term, which is applied in the same
+ *    instruction that computes the term when possible (logarithms and reciprocals), and by one multiply otherwise.
+ *  - FF_Rat_Inv terms of rational functions become divisions.
+ *  - Domain checks (the argument of a logarithm, of arc sine and arc cosine, and tangent at its poles) become check instructions, which stop the
+ *    program and report that the value does not exist, just as Evaluate would.
+ *  - Missing children compile to a failure, since Evaluate fails on them too.
+ *
+ * Functions that do not know how to lower themselves are called through Evaluate, so every function can be compiled. A program keeps pointers
+ * to such functions, and must not outlive the function it was compiled from. Programs are immutable once compiled, and can be shared by threads.
+ */
+
+/// \brief The operations of a FunctionProgram. R is the register file, and Imm is the constant stored in the instruction.
+enum FunctionOps : unsigned char
+{
+    FO_Const,        // R[Dest] = Imm
+    FO_Copy,         // R[Dest] = R[One]
+    FO_Scale,        // R[Dest] = Imm * R[One]
+    FO_Add,          // R[Dest] = R[One] + R[Two]
+    FO_Sub,          // R[Dest] = R[One] - R[Two]
+    FO_Mul,          // R[Dest] = R[One] * R[Two]
+    FO_Div,          // R[Dest] = R[One] / R[Two]
+    FO_Recip,        // R[Dest] = Imm / R[One]
+    FO_Square,       // R[Dest] = R[One] * R[One]
+    FO_PowConst,     // R[Dest] = R[One] ^ Imm
+    FO_Pow,          // R[Dest] = R[One] ^ R[Two]
+    FO_ExpBase,      // R[Dest] = Imm ^ R[One]
+    FO_Log,          // R[Dest] = Imm * ln(R[One])
+    FO_Abs,          // R[Dest] = |R[One]|
+    FO_Sin,          // R[Dest] = sin(R[One])
+    FO_Cos,          // R[Dest] = cos(R[One])
+    FO_Tan,          // R[Dest] = tan(R[One])
+    FO_Asin,         // R[Dest] = asin(R[One])
+    FO_Acos,         // R[Dest] = acos(R[One])
+    FO_Atan,         // R[Dest] = atan(R[One])
+    FO_RequirePositive, // Fails unless R[One] > 0
+    FO_RequireUnit,  // Fails unless -1 <= R[One] <= 1
+    FO_RequireFinite,// Fails if R[One] is positive infinity
+    FO_Call,         // R[Dest ...] = Imm * Calls[One]->Evaluate(R[0 ... InputDim])
+    FO_Fail          // Always fails
+};
+
+/// \brief One instruction of a FunctionProgram. Unused fields are zero.
+struct FunctionInstruction
+{
+    FunctionOps Op;
+    unsigned Dest, One, Two;
+    double Imm;
+};
+
+class FunctionProgram;
+class FunctionTape;
+
+/// \brief Builds a FunctionProgram. Each function lowers itself through FunctionBase::Emit, using the registers and instructions handed out here.
+class MATH_LIB FunctionCompiler
+{
+private:
+    std::vector<FunctionInstruction> Code;
+    std::vector<const FunctionBase*> Calls;
+    unsigned InputDim;
+    unsigned Top; //The first register not in use.
+    unsigned Peak; //The most registers ever in use.
+
+    explicit FunctionCompiler(unsigned InputDim) noexcept;
+
+    friend class FunctionProgram;
+
+public:
+    /// \brief The register holding input variable Var. Throws if there is no such input.
+    [[nodiscard]] unsigned Input(unsigned Var) const;
+
+    /// \brief Reserves Count consecutive registers, and returns the first.
+    [[nodiscard]] unsigned Allocate(unsigned Count = 1) noexcept;
+    /// \brief The current top of the registers. Pass it to Release to free every register allocated after this call.
+    [[nodiscard]] unsigned Mark() const noexcept { return Top; }
+    void Release(unsigned Mark) noexcept;
+
+    /// \brief Appends an instruction.
+    void Push(FunctionOps Op, unsigned Dest, unsigned One = 0, unsigned Two = 0, double Imm = 0.0);
+    /// \brief Stores Factor * R[One] in R[Dest], emitting nothing when Factor is one and One is Dest.
+    void Scale(unsigned Dest, unsigned One, double Factor);
+    /// \brief Stores Factor * R[One] ^ N in R[Dest], with the cheaper forms for N of zero, one and two.
+    void Power(unsigned Dest, unsigned One, double N, double Factor);
+
+    /// \brief Lowers Func so that registers Dest to Dest + Func.OutputDim - 1 receive Factor times its value.
+    void Emit(const FunctionBase& Func, unsigned Dest, double Factor);
+    /// \brief Lowers Func by calling its Evaluate when the program runs. This is the fallback for functions without their own Emit.
+    void Call(const FunctionBase& Func, unsigned Dest, double Factor);
+};
+
+/// \brief A function compiled into register bytecode. See the notes at the top of this file.
+class MATH_LIB FunctionProgram
+{
+private:
+    std::vector<FunctionInstruction> Code;
+    std::vector<const FunctionBase*> Calls;
+    unsigned InputDim = 0, OutputDim = 0;
+    unsigned Registers = 0;
+
+    friend class FunctionTape;
+
+public:
+    /// \brief Lowers Func into a program. Func must outlive the program.
+    [[nodiscard]] static FunctionProgram Compile(const FunctionBase& Func);
+
+    [[nodiscard]] unsigned Inputs() const noexcept { return InputDim; }
+    [[nodiscard]] unsigned Outputs() const noexcept { return OutputDim; }
+    /// \brief The number of doubles of working storage that Execute needs.
+    [[nodiscard]] unsigned RegisterCount() const noexcept { return Registers; }
+    [[nodiscard]] const std::vector<FunctionInstruction>& Instructions() const noexcept { return Code; }
+
+    /// \brief Runs the program. Nothing is allocated, unless the program calls a function through FO_Call.
+    /// \param X The Inputs() input values.
+    /// \param Out Receives the Outputs() output values, if the function exists at X.
+    /// \param Work Scratch storage of RegisterCount() doubles. Each thread must use its own.
+    /// \return True if the function exists at X, false otherwise (and Out is left unspecified).
+    bool Execute(const double* X, double* Out, double* Work) const noexcept;
+
+    /// \brief Evaluates the program with the same contract as FunctionBase::Evaluate.
+    [[nodiscard]] MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept;
+};
+
+#endif //JASON_FUNCTIONPROGRAM_H
@@ -0,0 +1,385 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "FunctionTape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+FunctionTape FunctionTape::Record(const FunctionBase& Func)
+{
+    FunctionProgram Program = FunctionProgram::Compile(Func);
+
+    FunctionTape Result;
+    Result.Calls = Program.Calls;
+    Result.InputDim = Program.InputDim;
+    Result.OutputDim = Program.OutputDim;
+    Result.Slots = Program.InputDim;
+
+    //The slot currently holding each register. Registers are reused by the program, but slots never are.
+    constexpr unsigned Unset = std::numeric_limits<unsigned>::max();
+    std::vector<unsigned> Current(Program.Registers, Unset);
+    for (unsigned j = 0; j < Program.InputDim; j++)
+        Current[j] = j;
+
+    auto Read = [&](unsigned Register) -> unsigned
+    {
+        if (Current[Register] == Unset) //Never written, so it holds the zero the program's storage starts with.
+        {
+            Result.Code.push_back(FunctionInstruction{ FO_Const, Result.Slots, 0, 0, 0.0 });
+            Current[Register] = Result.Slots++;
+        }
+
+        return Current[Register];
+    };
+
+    unsigned Jacobians = 0;
+    for (FunctionInstruction I : Program.Code)
+    {
+        switch (I.Op)
+        {
+        case FO_Const:
+        case FO_Fail:
+            break;
+        case FO_Call:
+            Result.JacobianOffsets.push_back(Jacobians);
+            Jacobians += Func.InputDim * Program.Calls[I.One]->OutputDim;
+            break;
+        case FO_Add:
+        case FO_Sub:
+        case FO_Mul:
+        case FO_Div:
+        case FO_Pow:
+            I.One = Read(I.One);
+            I.Two = Read(I.Two);
+            break;
+        default:
+            I.One = Read(I.One);
+            break;
+        }
+
+        if (I.Op == FO_Call)
+        {
+            unsigned Count = Program.Calls[I.One]->OutputDim;
+            for (unsigned j = 0; j < Count; j++)
+                Current[I.Dest + j] = Result.Slots + j;
+
+            I.Dest = Result.Slots;
+            Result.Slots += Count;
+        }
+        else if (I.Op != FO_RequirePositive && I.Op != FO_RequireUnit && I.Op != FO_RequireFinite && I.Op != FO_Fail)
+        {
+            Current[I.Dest] = Result.Slots;
+            I.Dest = Result.Slots++;
+        }
+        else
+            I.Dest = 0;
+
+        Result.Code.push_back(I);
+    }
+
+    for (unsigned r = 0; r < Program.OutputDim; r++)
+        Result.OutputSlots.push_back(Read(Program.InputDim + r));
+
+    //The Jacobians are placed after the values and adjoints.
+    for (unsigned& Offset : Result.JacobianOffsets)
+        Offset += 2 * Result.Slots;
+
+    Result.Arena.assign(2 * static_cast<size_t>(Result.Slots) + Jacobians, 0.0);
+    return Result;
+}
+
+bool FunctionTape::Forward(const double* X) noexcept
+{
+    Recorded = false;
+    double* V = Values();
+    std::copy(X, X + InputDim, V);
+
+    for (const FunctionInstruction& I : Code)
+    {
+        switch (I.Op)
+        {
+        case FO_Const:
+            V[I.Dest] = I.Imm;
+            break;
+        case FO_Copy:
+            V[I.Dest] = V[I.One];
+            break;
+        case FO_Scale:
+            V[I.Dest] = I.Imm * V[I.One];
+            break;
+        case FO_Add:
+            V[I.Dest] = V[I.One] + V[I.Two];
+            break;
+        case FO_Sub:
+            V[I.Dest] = V[I.One] - V[I.Two];
+            break;
+        case FO_Mul:
+            V[I.Dest] = V[I.One] * V[I.Two];
+            break;
+        case FO_Div:
+            V[I.Dest] = V[I.One] / V[I.Two];
+            break;
+        case FO_Recip:
+            V[I.Dest] = I.Imm / V[I.One];
+            break;
+        case FO_Square:
+            V[I.Dest] = V[I.One] * V[I.One];
+            break;
+        case FO_PowConst:
+            V[I.Dest] = std::pow(V[I.One], I.Imm);
+            break;
+        case FO_Pow:
+            V[I.Dest] = std::pow(V[I.One], V[I.Two]);
+            break;
+        case FO_ExpBase:
+            V[I.Dest] = std::pow(I.Imm, V[I.One]);
+            break;
+        case FO_Log:
+            V[I.Dest] = I.Imm * std::log(V[I.One]);
+            break;
+        case FO_Abs:
+            V[I.Dest] = std::fabs(V[I.One]);
+            break;
+        case FO_Sin:
+            V[I.Dest] = std::sin(V[I.One]);
+            break;
+        case FO_Cos:
+            V[I.Dest] = std::cos(V[I.One]);
+            break;
+        case FO_Tan:
+            V[I.Dest] = std::tan(V[I.One]);
+            break;
+        case FO_Asin:
+            V[I.Dest] = std::asin(V[I.One]);
+            break;
+        case FO_Acos:
+            V[I.Dest] = std::acos(V[I.One]);
+            break;
+        case FO_Atan:
+            V[I.Dest] = std::atan(V[I.One]);
+            break;
+        case FO_RequirePositive:
+            if (!(V[I.One] > 0.0))
+                return false;
+            break;
+        case FO_RequireUnit:
+            if (!(V[I.One] >= -1.0 && V[I.One] <= 1.0))
+                return false;
+            break;
+        case FO_RequireFinite:
+            if (V[I.One] == std::numeric_limits<double>::infinity())
+                return false;
+            break;
+        case FO_Call:
+        {
+            //The called function is differentiated now, while its inputs are at hand, and its Jacobian kept for Backward.
+            const FunctionBase& Func = *Calls[I.One];
+            double* J = Arena.data() + JacobianOffsets[I.One];
+            bool Exists = false;
+            try
+            {
+                MathVector In(InputDim);
+                std::copy(V, V + InputDim, In.data());
+                Matrix Jacobian = Matrix::ErrorMatrix();
+                MathVector Result = Func.EvaluateJacobian(In, Jacobian, Exists);
+                if (!Exists || Result.Dim() < Func.OutputDim)
+                    return false;
+
+                for (unsigned r = 0; r < Func.OutputDim; r++)
+                {
+                    V[I.Dest + r] = I.Imm * Result[r];
+                    for (unsigned c = 0; c < InputDim; c++)
+                        J[r * InputDim + c] = I.Imm * Jacobian[r][c];
+                }
+            }
+            catch (std::exception&)
+            {
+                return false;
+            }
+            break;
+        }
+        case FO_Fail:
+        default:
+            return false;
+        }
+    }
+
+    Recorded = true;
+    return true;
+}
+
+double FunctionTape::Value(unsigned Index) const noexcept
+{
+    if (!Recorded || Index >= OutputDim)
+        return std::numeric_limits<double>::quiet_NaN();
+
+    return Arena[OutputSlots[Index]];
+}
+
+void FunctionTape::Backward(const double* Seed, double* Grad) noexcept
+{
+    if (!Recorded)
+        return;
+
+    const double* V = Values();
+    double* A = Adjoints();
+    std::fill_n(A, Slots, 0.0);
+    for (unsigned r = 0; r < OutputDim; r++)
+        A[OutputSlots[r]] += Seed[r];
+
+    //Each instruction passes the adjoint of its result on to its operands, times the partial derivative with respect to each.
+    for (auto It = Code.rbegin(); It != Code.rend(); ++It)
+    {
+        const FunctionInstruction& I = *It;
+        if (I.Op == FO_Call)
+        {
+            const FunctionBase& Func = *Calls[I.One];
+            const double* J = Arena.data() + JacobianOffsets[I.One];
+            for (unsigned r = 0; r < Func.OutputDim; r++)
+            {
+                double D = A[I.Dest + r];
+                if (D != 0.0)
+                    for (unsigned c = 0; c < InputDim; c++)
+                        A[c] += J[r * InputDim + c] * D;
+            }
+            continue;
+        }
+
+        double D = A[I.Dest];
+        if (D == 0.0) //Nothing to pass on. This also keeps infinite partials (such as at the ends of asin) from making NaNs of unused branches.
+            continue;
+
+        double y = V[I.Dest], a = V[I.One], b = V[I.Two];
+        switch (I.Op)
+        {
+        case FO_Copy:
+            A[I.One] += D;
+            break;
+        case FO_Scale:
+            A[I.One] += I.Imm * D;
+            break;
+        case FO_Add:
+            A[I.One] += D;
+            A[I.Two] += D;
+            break;
+        case FO_Sub:
+            A[I.One] += D;
+            A[I.Two] -= D;
+            break;
+        case FO_Mul:
+            A[I.One] += b * D;
+            A[I.Two] += a * D;
+            break;
+        case FO_Div:
+            A[I.One] += D / b;
+            A[I.Two] -= D * y / b;
+            break;
+        case FO_Recip:
+            A[I.One] -= D * y / a;
+            break;
+        case FO_Square:
+            A[I.One] += 2.0 * a * D;
+            break;
+        case FO_PowConst:
+            if (I.Imm != 0.0)
+                A[I.One] += I.Imm * std::pow(a, I.Imm - 1.0) * D;
+            break;
+        case FO_Pow:
+            //As in Dual::Pow, the derivative along the exponent only exists for positive bases.
+            if (b != 0.0)
+                A[I.One] += b * std::pow(a, b - 1.0) * D;
+            if (a > 0.0)
+                A[I.Two] += y * std::log(a) * D;
+            break;
+        case FO_ExpBase:
+            A[I.One] += y * std::log(I.Imm) * D;
+            break;
+        case FO_Log:
+            A[I.One] += I.Imm / a * D;
+            break;
+        case FO_Abs:
+            A[I.One] += (a > 0.0 ? D : a < 0.0 ? -D : 0.0);
+            break;
+        case FO_Sin:
+            A[I.One] += std::cos(a) * D;
+            break;
+        case FO_Cos:
+            A[I.One] -= std::sin(a) * D;
+            break;
+        case FO_Tan:
+            A[I.One] += (1.0 + y * y) * D;
+            break;
+        case FO_Asin:
+            A[I.One] += D / std::sqrt(1.0 - a * a);
+            break;
+        case FO_Acos:
+            A[I.One] -= D / std::sqrt(1.0 - a * a);
+            break;
+        case FO_Atan:
+            A[I.One] += D / (1.0 + a * a);
+            break;
+        default: //Constants and checks have no operands to differentiate.
+            break;
+        }
+    }
+
+    std::copy(A, A + InputDim, Grad);
+}
+
+MathVector FunctionTape::Gradient(const MathVector& X, bool& Exists) noexcept
+{
+    Exists = OutputDim == 1 && X.Dim() == InputDim && Forward(X.data());
+    if (!Exists)
+        return MathVector::ErrorVector();
+
+    try
+    {
+        double Seed = 1.0;
+        MathVector Result(InputDim);
+        Backward(&Seed, Result.data());
+        return Result;
+    }
+    catch (std::exception&)
+    {
+        Exists = false;
+        return MathVector::ErrorVector();
+    }
+}
+MathVector FunctionTape::EvaluateJacobian(const MathVector& X, Matrix& Jacobian, bool& Exists) noexcept
+{
+    Exists = X.Dim() == InputDim && Forward(X.data());
+    try
+    {
+        if (!Exists)
+        {
+            Jacobian = Matrix::ErrorMatrix();
+            return MathVector::ErrorVector();
+        }
+
+        MathVector Result(OutputDim), Row(InputDim);
+        std::vector<double> Seed(OutputDim, 0.0);
+        Jacobian = Matrix(OutputDim, InputDim);
+        for (unsigned r = 0; r < OutputDim; r++)
+        {
+            Result[r] = Value(r);
+
+            Seed[r] = 1.0;
+            Backward(Seed.data(), Row.data());
+            Seed[r] = 0.0;
+
+            for (unsigned c = 0; c < InputDim; c++)
+                Jacobian[r][c] = Row[c];
+        }
+
+        return Result;
+    }
+    catch (std::exception&)
+    {
+        Exists = false;
+        Jacobian = Matrix::ErrorMatrix();
+        return MathVector::ErrorVector();
+    }
+}
@@ -0,0 +1,75 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_FUNCTIONTAPE_H
+#define JASON_FUNCTIONTAPE_H
+
+#include "FunctionProgram.h"
+
+#include <vector>
+
+/*
+ * FUNCTION TAPES
+ *
+ * Forward mode differentiation (FunctionBase::EvaluateDual) carries one derivative per input through every node, so a gradient of a function
+ * with hundreds of inputs costs hundreds of times an evaluation. Reverse mode records the evaluation instead, and then walks the record backwards
+ * once, accumulating the derivative of the output with respect to every intermediate value (its adjoint). A gradient then costs a small multiple
+ * of one evaluation, whatever the number of inputs.
+ *
+ * A FunctionTape is that record. It is built once from a FunctionProgram, by giving every instruction its own slot for its result (single
+ * assignment form), so that nothing the backward sweep needs is overwritten. The structure of a function does not depend on where it is evaluated,
+ * so the same tape is replayed for every point:
+ *  - Forward(X) runs the instructions, keeping every intermediate value.
+ *  - Backward(Seed, Grad) then propagates Seed (one weight per output) back to the inputs, giving Seed^T J, in one sweep.
+ *
+ * Values, adjoints and the Jacobians of called functions live in one arena, allocated when the tape is recorded, so evaluating and differentiating
+ * allocate nothing. Functions called through FO_Call (those without their own Emit) are differentiated with EvaluateJacobian during Forward.
+ *
+ * A tape keeps pointers to such functions, and must not outlive the function it was recorded from. Forward and Backward write to the arena, so each
+ * thread must use its own copy of a tape.
+ */
+
+/// \brief A function recorded for reverse mode differentiation. See the notes at the top of this file.
+class MATH_LIB FunctionTape
+{
+private:
+    std::vector<FunctionInstruction> Code; //Dest, One and Two are slots, and each slot is written by one instruction.
+    std::vector<const FunctionBase*> Calls;
+    std::vector<unsigned> JacobianOffsets; //Per call, the start of its Jacobian in the arena.
+    std::vector<unsigned> OutputSlots;
+    std::vector<double> Arena; //Slots values, then Slots adjoints, then the Jacobians of the calls.
+    unsigned InputDim = 0, OutputDim = 0;
+    unsigned Slots = 0;
+    bool Recorded = false; //True once Forward has succeeded, so that Backward has values to work with.
+
+    [[nodiscard]] double* Values() noexcept { return Arena.data(); }
+    [[nodiscard]] double* Adjoints() noexcept { return Arena.data() + Slots; }
+
+public:
+    /// \brief Records Func. Func must outlive the tape.
+    [[nodiscard]] static FunctionTape Record(const FunctionBase& Func);
+
+    [[nodiscard]] unsigned Inputs() const noexcept { return InputDim; }
+    [[nodiscard]] unsigned Outputs() const noexcept { return OutputDim; }
+    /// \brief The number of values kept by Forward, including the inputs.
+    [[nodiscard]] unsigned SlotCount() const noexcept { return Slots; }
+    [[nodiscard]] const std::vector<FunctionInstruction>& Instructions() const noexcept { return Code; }
+
+    /// \brief Evaluates the function at X (Inputs() values), keeping every intermediate value for Backward.
+    /// \return True if the function exists at X, false otherwise.
+    bool Forward(const double* X) noexcept;
+    /// \brief Output Index of the last successful Forward.
+    [[nodiscard]] double Value(unsigned Index) const noexcept;
+    /// \brief Propagates the derivatives of the last successful Forward from the outputs back to the inputs.
+    /// \param Seed Outputs() weights, one per output.
+    /// \param Grad Receives Inputs() values, the gradient of the sum of Seed[r] times output r. It is left untouched if Forward has not succeeded.
+    void Backward(const double* Seed, double* Grad) noexcept;
+
+    /// \brief The gradient at X of a function with one output, by one forward and one backward sweep. Exists is false if Outputs() != 1.
+    [[nodiscard]] MathVector Gradient(const MathVector& X, bool& Exists) noexcept;
+    /// \brief The value and Jacobian at X, with the same contract as FunctionBase::EvaluateJacobian, by one backward sweep per output.
+    [[nodiscard]] MathVector EvaluateJacobian(const MathVector& X, Matrix& Jacobian, bool& Exists) noexcept;
+};
+
+#endif //JASON_FUNCTIONTAPE_H
@@ -0,0 +1,345 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include "FunctionTester.h"
+#include "Function.h"
+#include "Impls/Bezier.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+
+namespace
+{
+    //Relative to the larger of one and the expected value, and loose enough for the bounds of VectorMath().
+    constexpr double Tolerance = 1e-12;
+
+    bool Check(const char* What, bool Passed)
+    {
+        if (!Passed)
+            std::cerr << "Function check failed: " << What << '\n';
+
+        return Passed;
+    }
+
+    /// Infinities must match exactly, and NaNs match each other, so that the three paths agree on every value Evaluate gives.
+    bool Close(double Expected, double Actual)
+    {
+        if (std::isnan(Expected) || std::isnan(Actual))
+            return std::isnan(Expected) && std::isnan(Actual);
+        if (Expected == Actual)
+            return true;
+
+        return std::fabs(Expected - Actual) <= Tolerance * std::max(1.0, std::fabs(Expected));
+    }
+
+    /// Count points of Dim components, uniform over [Low, High], with a few exact values (zero, the ends of the unit interval) mixed in.
+    VectorBatch Points(unsigned Dim, size_t Count, double Low, double High)
+    {
+        std::mt19937 Gen(Dim * 7919 + static_cast<unsigned>(Count));
+        std::uniform_real_distribution<double> Dist(Low, High);
+        const double Exact[] = { 0.0, 1.0, -1.0, 0.5 };
+
+        VectorBatch Result(Dim, Count);
+        for (unsigned c = 0; c < Dim; c++)
+        {
+            double* x = Result.Component(c);
+            for (size_t i = 0; i < Count; i++)
+                x[i] = i % 17 == 0 ? Exact[(i / 17 + c) % 4] : Dist(Gen);
+        }
+
+        return Result;
+    }
+
+    /// Evaluates Func at every point of X with Evaluate, its compiled FunctionProgram and EvaluateMany, and checks that they agree on existence and value.
+    bool CheckPaths(const std::string& Name, const FunctionBase& Func, const VectorBatch& X)
+    {
+        FunctionProgram Program = FunctionProgram::Compile(Func);
+        std::vector<double> Work(Program.RegisterCount()), ProgramOut(Func.OutputDim);
+
+        VectorBatch Many(Func.OutputDim, X.Count());
+        ExistsMask ManyExists;
+        Func.EvaluateMany(X, Many, ManyExists);
+
+        size_t ExistMismatches = 0, ValueMismatches = 0, Existing = 0;
+        MathVector Point(X.Dim());
+        for (size_t i = 0; i < X.Count(); i++)
+        {
+            for (unsigned c = 0; c < X.Dim(); c++)
+                Point[c] = X.Component(c)[i];
+
+            bool Exists = false;
+            MathVector Expected = Func.Evaluate(Point, Exists);
+            bool ProgramExists = Program.Execute(Point.data(), ProgramOut.data(), Work.data());
+            if (ProgramExists != Exists || ManyExists[i] != Exists)
+            {
+                ExistMismatches++;
+                continue;
+            }
+            if (!Exists)
+                continue;
+
+            Existing++;
+            for (unsigned r = 0; r < Func.OutputDim; r++)
+                if (!Close(Expected[r], ProgramOut[r]) || !Close(Expected[r], Many.Component(r)[i]))
+                {
+                    ValueMismatches++;
+                    break;
+                }
+        }
+
+        bool Passed = true;
+        Passed &= Check((Name + ": existence of program and batch matches Evaluate").c_str(), ExistMismatches == 0);
+        Passed &= Check((Name + ": values of program and batch match Evaluate").c_str(), ValueMismatches == 0);
+        Passed &= Check((Name + ": exists somewhere in the sample").c_str(), Existing != 0);
+        return Passed;
+    }
+
+    //A two input polynomial with a negated term, used as the argument of the other functions.
+    FunctionBase* Inner()
+    {
+        auto* Result = new Polynomial(2, 1);
+        Result->AddFunction(new Monomial(2, 0, 0.75, 1.0));
+        Result->SubtractFunction(new Monomial(2, 1, 0.5, 2.0));
+        Result->AddFunction(new Constant(2, 0.25));
+        return Result;
+    }
+
+    bool CheckEveryType()
+    {
+        VectorBatch X = Points(2, 2 * FunctionBase::BlockSize + 37, -3.0, 3.0);
+        bool Passed = true;
+
+        std::vector<std::pair<std::string, std::unique_ptr<FunctionBase>>> Funcs;
+        Funcs.emplace_back("Constant", new Constant(2, 2.5));
+        Funcs.emplace_back("Monomial", new Monomial(2, 0, 1.5, 3.0));
+        Funcs.emplace_back("Monomial, negative power", new Monomial(2, 1, 2.0, -1.0));
+        Funcs.emplace_back("Monomial, fractional power", new Monomial(2, 0, 1.0, 0.5));
+        Funcs.emplace_back("FnMonomial", new FnMonomial(Inner(), 2.0, 1.5));
+        Funcs.emplace_back("PFnMonomial", new PFnMonomial(2, Inner(), new Monomial(2, 1, 1.0, 1.0), 0.5));
+        Funcs.emplace_back("Exponent", new Exponent(Inner(), 2.0, 1.5));
+        Funcs.emplace_back("Logarithm", new Logarithm(Inner(), 10.0, 0.5));
+        Funcs.emplace_back("AbsoluteValue", new AbsoluteValue(Inner(), 1.25));
+
+        const std::pair<const char*, unsigned> TrigTypes[] = {
+            { "sin", TrigFunc::Sine }, { "cos", TrigFunc::Cosine }, { "tan", TrigFunc::Tangent }
+        };
+        for (const auto& [Name, Type] : TrigTypes)
+        {
+            Funcs.emplace_back(std::string("Trig ") + Name, new Trig(Inner(), Type, 2.0));
+            Funcs.emplace_back(std::string("Trig arc") + Name, new Trig(Inner(), Type | TrigFunc::Inverse, 2.0));
+            Funcs.emplace_back(std::string("Trig reciprocal ") + Name, new Trig(Inner(), Type | TrigFunc::Reciprocal, 2.0));
+            Funcs.emplace_back(std::string("Trig arc reciprocal ") + Name, new Trig(Inner(), Type | TrigFunc::Inverse | TrigFunc::Reciprocal, 2.0));
+        }
+
+        auto* Poly = new Polynomial(2, 1);
+        Poly->AddFunction(new Monomial(2, 0, 3.0, 2.0));
+        Poly->SubtractFunction(new Trig(new Monomial(2, 1), TrigFunc::Sine, 2.0));
+        Poly->AddFunction(new Logarithm(new Monomial(2, 0), 10.0, 0.5));
+        Poly->SubtractFunction(Inner()); //Its terms are taken over, negated.
+        Poly->AddFunction(new AbsoluteValue(Inner(), 1.25));
+        Funcs.emplace_back("Polynomial", Poly);
+
+        auto* Rational = new RationalFunction(2);
+        Rational->MultiplyFunction(new Trig(new Monomial(2, 0), TrigFunc::Cosine, 1.0));
+        Rational->DivideFunction(Inner());
+        Rational->MultiplyFunction(new Exponent(new Monomial(2, 1), 1.5, 2.0));
+        Funcs.emplace_back("RationalFunction", Rational);
+
+        auto* Vector = new VectorFunction(2, 3);
+        Vector->AssignFunction(0, Inner());
+        Vector->AssignFunction(1, new Logarithm(Inner(), 2.0, 1.0));
+        Vector->AssignFunction(2, new PFnMonomial(2, new AbsoluteValue(Inner(), 1.0), new Monomial(2, 0), 1.0));
+        Funcs.emplace_back("VectorFunction", Vector);
+
+        Funcs.emplace_back("General::Cubic", General::Cubic(2, 1, 1.0, -2.0, 0.5, 3.0));
+        Funcs.emplace_back("General::SquareRoot", General::SquareRoot(2, 0, 2.0));
+        Funcs.emplace_back("General::Cosine", General::Cosine(2, 0, 1.5, 2.0, 0.25, -1.0));
+
+        for (const auto& [Name, Func] : Funcs)
+            Passed &= CheckPaths(Name, *Func, X);
+
+        //A Bezier curve takes a parameter in [0, 1], and does not exist outside of it.
+        std::unique_ptr<FunctionBase> Curve(CreateBezier(2, 3, { MathVector::FromList(0, 0), MathVector::FromList(1, 2), MathVector::FromList(3, -1), MathVector::FromList(4, 4) }));
+        Passed &= CheckPaths("Bezier", *Curve, Points(1, FunctionBase::BlockSize + 5, -0.5, 1.5));
+
+        return Passed;
+    }
+
+    /// Checks that the reverse mode Jacobian of FunctionTape matches the forward mode one of FunctionBase::EvaluateJacobian at every point of X.
+    bool CheckTape(const std::string& Name, const FunctionBase& Func, const VectorBatch& X)
+    {
+        FunctionTape Tape = FunctionTape::Record(Func);
+        size_t ExistMismatches = 0, Mismatches = 0, Existing = 0;
+        MathVector Point(X.Dim());
+        for (size_t i = 0; i < X.Count(); i++)
+        {
+            for (unsigned c = 0; c < X.Dim(); c++)
+                Point[c] = X.Component(c)[i];
+
+            bool DualExists = false, TapeExists = false;
+            Matrix DualJacobian = Matrix::ErrorMatrix(), TapeJacobian = Matrix::ErrorMatrix();
+            MathVector DualValue = Func.EvaluateJacobian(Point, DualJacobian, DualExists);
+            MathVector TapeValue = Tape.EvaluateJacobian(Point, TapeJacobian, TapeExists);
+            if (DualExists != TapeExists)
+            {
+                ExistMismatches++;
+                continue;
+            }
+            if (!DualExists)
+                continue;
+
+            Existing++;
+            bool Same = true;
+            for (unsigned r = 0; r < Func.OutputDim; r++)
+            {
+                //The two modes sum the chain rule in different orders, so they only agree to rounding.
+                Same &= std::fabs(DualValue[r] - TapeValue[r]) <= Tolerance * std::max(1.0, std::fabs(DualValue[r]));
+                for (unsigned c = 0; c < Func.InputDim; c++)
+                    Same &= std::fabs(DualJacobian[r][c] - TapeJacobian[r][c]) <= 1e-9 * std::max(1.0, std::fabs(DualJacobian[r][c]));
+            }
+
+            Mismatches += !Same;
+        }
+
+        bool Passed = true;
+        Passed &= Check((Name + ": tape exists where the duals do").c_str(), ExistMismatches == 0);
+        Passed &= Check((Name + ": tape Jacobian matches the dual Jacobian").c_str(), Mismatches == 0);
+        Passed &= Check((Name + ": Jacobian exists somewhere in the sample").c_str(), Existing != 0);
+        return Passed;
+    }
+
+    bool CheckDerivatives()
+    {
+        //Only random points, since the derivatives of some of these are infinite at the exact values Points mixes in.
+        std::mt19937 Gen(4099);
+        std::uniform_real_distribution<double> Dist(-2.0, 2.0);
+        VectorBatch X(3, 300);
+        for (unsigned c = 0; c < 3; c++)
+            for (size_t i = 0; i < X.Count(); i++)
+                X.Component(c)[i] = Dist(Gen);
+
+        auto Argument = []
+        {
+            auto* Result = new Polynomial(3, 1);
+            Result->AddFunction(new Monomial(3, 0, 0.5, 2.0));
+            Result->SubtractFunction(new Monomial(3, 1, 0.75, 1.0));
+            Result->AddFunction(new Monomial(3, 2, 0.25, 3.0));
+            return Result;
+        };
+
+        bool Passed = true;
+        auto* Scalar = new Polynomial(3, 1);
+        Scalar->AddFunction(new Trig(Argument(), TrigFunc::Sine, 2.0));
+        Scalar->AddFunction(new Trig(Argument(), TrigFunc::Tangent | TrigFunc::Inverse, 1.0));
+        Scalar->SubtractFunction(new Logarithm(new AbsoluteValue(Argument(), 1.0), 10.0, 0.5));
+        Scalar->AddFunction(new PFnMonomial(3, new Exponent(Argument(), 1.0, 2.0), new Monomial(3, 2), 1.5));
+        std::unique_ptr<FunctionBase> ScalarOwner(Scalar);
+        Passed &= CheckTape("Scalar", *Scalar, X);
+
+        auto* Rational = new RationalFunction(3);
+        Rational->MultiplyFunction(new Trig(Argument(), TrigFunc::Cosine, 1.0));
+        Rational->DivideFunction(new FnMonomial(Argument(), 2.0, 1.0));
+        Rational->MultiplyFunction(new Trig(Argument(), TrigFunc::Sine | TrigFunc::Inverse, 1.0));
+        std::unique_ptr<FunctionBase> RationalOwner(Rational);
+        Passed &= CheckTape("Rational", *Rational, X);
+
+        VectorFunction Vector(3, 3);
+        Vector.AssignFunction(0, Argument());
+        Vector.AssignFunction(1, new Exponent(Argument(), -1.0, 3.0));
+        Vector.AssignFunction(2, new Trig(Argument(), TrigFunc::Cosine | TrigFunc::Reciprocal, 0.5));
+        Passed &= CheckTape("Vector", Vector, X);
+
+        //Bezier curves have no Emit, so their tape calls back into EvaluateJacobian.
+        std::unique_ptr<FunctionBase> Curve(CreateBezier(2, 2, { MathVector::FromList(0, 0), MathVector::FromList(1, 2), MathVector::FromList(3, -1) }));
+        VectorBatch T(1, 50);
+        for (size_t i = 0; i < T.Count(); i++)
+            T.Component(0)[i] = (i + 0.5) / T.Count();
+        Passed &= CheckTape("Bezier", *Curve, T);
+
+        //The gradient of a scalar function is the single row of its Jacobian.
+        FunctionTape Tape = FunctionTape::Record(*Scalar);
+        MathVector At = MathVector::FromList(0.3, -0.7, 1.1);
+        bool TapeExists = false, DualExists = false;
+        MathVector Gradient = Tape.Gradient(At, TapeExists);
+        MathVector Expected = Scalar->Gradient(At, DualExists);
+        bool Same = TapeExists && DualExists;
+        for (unsigned c = 0; Same && c < 3; c++)
+            Same = std::fabs(Gradient[c] - Expected[c]) <= 1e-9 * std::max(1.0, std::fabs(Expected[c]));
+        Passed &= Check("Tape gradient matches the dual gradient", Same);
+
+        return Passed;
+    }
+
+    bool CheckRegressions()
+    {
+        bool Passed = true;
+        MathVector At = MathVector::FromList(-2.0, 0.5);
+
+        //PushChild lost every child after the second, and LastChild() pointed at the last child rather than past it, so evaluation skipped it.
+        Polynomial Sum(2, 1);
+        Sum.AddFunction(new Constant(2, 1.0));
+        Sum.AddFunction(new Constant(2, 10.0));
+        Sum.AddFunction(new Constant(2, 100.0));
+        Sum.AddFunction(new Constant(2, 1000.0));
+        bool Exists = false;
+        MathVector Value = Sum.Evaluate(At, Exists);
+        Passed &= Check("Polynomial keeps every term", Sum.ChildCount() == 4);
+        Passed &= Check("Polynomial evaluates its last term", Exists && Value[0] == 1111.0);
+        Passed &= Check("Polynomial indexes its last term", Sum[3].A == 1000.0);
+
+        //SetFlag and InvertFlag could never set a flag.
+        Constant Flagged(2, 1.0);
+        Flagged.SetFlag(FF_Poly_Neg, true);
+        Passed &= Check("SetFlag sets the flag", Flagged.FlagActive(FF_Poly_Neg) && !Flagged.FlagActive(FF_Rat_Inv));
+        Flagged.SetFlag(FF_Poly_Neg, false);
+        Passed &= Check("SetFlag clears the flag", !Flagged.FlagActive(FF_Poly_Neg));
+        Flagged.InvertFlag(FF_Rat_Inv);
+        Passed &= Check("InvertFlag sets the flag", Flagged.FlagActive(FF_Rat_Inv));
+        Flagged.InvertFlag(FF_Rat_Inv);
+        Passed &= Check("InvertFlag clears the flag", !Flagged.FlagActive(FF_Rat_Inv));
+
+        Polynomial Difference(2, 1);
+        Difference.AddFunction(new Constant(2, 5.0));
+        Difference.SubtractFunction(new Constant(2, 3.0));
+        Value = Difference.Evaluate(At, Exists);
+        Passed &= Check("Polynomial subtracts negated terms", Exists && Value[0] == 2.0);
+
+        //Trig's cosine evaluated sine.
+        Trig Cosine(new Monomial(2, 1), TrigFunc::Cosine, 1.0);
+        Value = Cosine.Evaluate(At, Exists);
+        Passed &= Check("Trig cosine is the cosine", Exists && Close(std::cos(0.5), Value[0]));
+
+        //AbsoluteValue kept the sign of its argument.
+        AbsoluteValue Abs(new Monomial(2, 0), 3.0);
+        Value = Abs.Evaluate(At, Exists);
+        Passed &= Check("AbsoluteValue drops the sign", Exists && Value[0] == 6.0);
+
+        //Monomial never set Exists.
+        Monomial Square(2, 0, 1.0, 2.0);
+        Exists = false;
+        Value = Square.Evaluate(At, Exists);
+        Passed &= Check("Monomial sets Exists", Exists && Value[0] == 4.0);
+
+        return Passed;
+    }
+}
+
+bool FunctionTester() noexcept
+{
+    try
+    {
+        bool Passed = true;
+        Passed &= CheckRegressions();
+        Passed &= CheckEveryType();
+        Passed &= CheckDerivatives();
+        return Passed;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Function tests threw: " << e.what() << '\n';
+        return false;
+    }
+}
@@ -0,0 +1,13 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#ifndef JASON_FUNCTIONTESTER_H
+#define JASON_FUNCTIONTESTER_H
+
+/// \brief Checks every function type against its own Evaluate, through FunctionProgram and EvaluateMany, along with the fixed bugs of the function tree,
+/// and checks the Jacobians of FunctionTape against those of the dual numbers.
+/// \return True if every check passed. Each failure is written to std::cerr.
+bool FunctionTester() noexcept;
+
+#endif //JASON_FUNCTIONTESTER_H
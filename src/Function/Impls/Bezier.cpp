@@ -1,4 +1,6 @@
 #include "Bezier.h"
+#include "../../Calc/SimdKernels.h"
+#include "../../Calc/VectorMath.h"
 
 BezierMonomial::BezierMonomial(unsigned Dim, unsigned i, unsigned n, const MathVector& Target) : FunctionBase(1, Dim), Point(Target)
 {
@@ -15,15 +17,65 @@ BezierMonomial::BezierMonomial(unsigned Dim, unsigned i, unsigned n, const MathV
 
 MathVector BezierMonomial::Evaluate(const MathVector& T, bool& Exists) const noexcept
 {
-    if (T.Dim() != 1 || T[0] < 0 || T[1] > 1) //Out of range
+    if (T.Dim() != 1 || T[0] < 0 || T[0] > 1) //Out of range
     {
         Exists = false;
         return MathVector::ErrorVector();
     }
 
+    Exists = true;
     return Point * (this->A * pow(1 - T[0], n - 1) * pow(T[0], i));
 }
 
+void BezierMonomial::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    //The weight of each point is computed into the last output row, and scales the point into every row.
+    const double* t = X[0];
+    double* w = Out[OutputDim - 1];
+    BlockFrame Power(Scratch, 1);
+    double* ti = Power.Rows()[0];
+    for (size_t k = 0; k < Count; k++)
+    {
+        Exists[k] = t[k] >= 0 && t[k] <= 1;
+        w[k] = 1 - t[k];
+        ti[k] = t[k];
+    }
+
+    const auto& vm = VectorMath();
+    const auto& simd = SimdKernels();
+    vm.PowConst(w, n - 1, Count);
+    vm.PowConst(ti, i, Count);
+    simd.MultiplyElements(w, ti, Count);
+    simd.Scale(w, this->A, Count);
+
+    for (unsigned r = 0; r + 1 < OutputDim; r++)
+    {
+        double p = Point[r];
+        for (size_t k = 0; k < Count; k++)
+            Out[r][k] = p * w[k];
+    }
+
+    double p = Point[OutputDim - 1];
+    for (size_t k = 0; k < Count; k++)
+        w[k] *= p;
+}
+unsigned BezierMonomial::BlockScratchRows() const noexcept
+{
+    return 1;
+}
+bool BezierMonomial::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    const Dual& t = X[0];
+    if (t.Value < 0 || t.Value > 1)
+        return false;
+
+    Dual Weight = Dual::Pow(Dual(1.0, Directions) - t, n - 1) * Dual::Pow(t, i) * this->A;
+    for (unsigned r = 0; r < OutputDim; r++)
+        Out[r] = Weight * Point[r];
+
+    return true;
+}
+
 [[nodiscard]] bool BezierMonomial::ComparesTo(const FunctionBase* obj) const noexcept
 {
     const auto* conv = dynamic_cast<const BezierMonomial*>(obj);
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../../Calc/StdCalc.h"
+#include "../FunctionCommon.h"
 #include "../FunctionBase.h"
 #include "../Composite/Polynomial.h"
 
@@ -17,6 +17,9 @@ public:
     BezierMonomial(unsigned int Dim, unsigned i, unsigned n, const MathVector& Target);
 
     MathVector Evaluate(const MathVector& T, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    [[nodiscard]] unsigned BlockScratchRows() const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* obj) const noexcept override;
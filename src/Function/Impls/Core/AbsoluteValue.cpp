@@ -1,4 +1,7 @@
 #include "../CoreFunctions.h"
+#include "../../FunctionProgram.h"
+
+#include <algorithm>
 
 AbsoluteValue::AbsoluteValue(FunctionBase* N, double A) : FunctionBase(!N ? 0 : N->InputDim, 1)
 {
@@ -38,7 +41,43 @@ MathVector AbsoluteValue::Evaluate(const MathVector& X, bool& Exists) const noex
     if (!Exists)
         return MathVector::ErrorVector();
 
-    return MathVector(A * Base.Magnitude());
+    return MathVector::FromList(A * fabs(Base[0])); //Magnitude keeps the sign of one dimensional vectors.
+}
+
+void AbsoluteValue::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (!N)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    N->EvaluateBlock(X, Count, Out, Exists, Scratch);
+
+    double* y = Out[0];
+    for (size_t i = 0; i < Count; i++)
+        y[i] = A * fabs(y[i]);
+}
+bool AbsoluteValue::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (!N || !N->EvaluateDual(X, Directions, Out))
+        return false;
+
+    Out[0] = Dual::Abs(Out[0]) * A;
+    return true;
+}
+
+void AbsoluteValue::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    if (!N)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    Out.Emit(*N, Dest, 1.0);
+    Out.Push(FO_Abs, Dest, Dest);
+    Out.Scale(Dest, Dest, Factor * A);
 }
 
 [[nodiscard]] bool AbsoluteValue::ComparesTo(const FunctionBase* Obj) const noexcept
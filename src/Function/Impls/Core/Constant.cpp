@@ -1,4 +1,7 @@
 #include "../CoreFunctions.h"
+#include "../../FunctionProgram.h"
+
+#include <algorithm>
 
 Constant::Constant(unsigned int InputDim, double A) : FunctionBase(InputDim, 1)
 {
@@ -19,7 +22,23 @@ MathVector Constant::Evaluate(const MathVector& X, bool& Exists) const noexcept
     }
 
     Exists = true;
-    return MathVector(A);
+    return MathVector::FromList(A);
+}
+
+void Constant::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    std::fill_n(Out[0], Count, A);
+    std::fill_n(Exists, Count, 1);
+}
+bool Constant::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    Out[0] = Dual(A, Directions);
+    return true;
+}
+
+void Constant::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    Out.Push(FO_Const, Dest, 0, 0, Factor * A);
 }
 
 bool Constant::ComparesTo(const FunctionBase* Obj) const noexcept
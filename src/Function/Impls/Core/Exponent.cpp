@@ -1,4 +1,9 @@
 #include "../CoreFunctions.h"
+#include "../../FunctionProgram.h"
+#include "../../../Calc/SimdKernels.h"
+#include "../../../Calc/VectorMath.h"
+
+#include <algorithm>
 
 Exponent::Exponent(FunctionBase* N, double A, double B) : FunctionBase(!N ? 0 : N->InputDim, 1)
 {
@@ -39,7 +44,42 @@ MathVector Exponent::Evaluate(const MathVector& X, bool& Exists) const noexcept
     if (!Exists)
         return MathVector::ErrorVector();
 
-    return MathVector(A * pow(Base, Result[0]));
+    return MathVector::FromList(A * pow(Base, Result[0]));
+}
+
+void Exponent::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (!N)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    N->EvaluateBlock(X, Count, Out, Exists, Scratch);
+
+    VectorMath().ExpBase(Out[0], Base, Count);
+    SimdKernels().Scale(Out[0], A, Count);
+}
+bool Exponent::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (!N || !N->EvaluateDual(X, Directions, Out))
+        return false;
+
+    Out[0] = Dual::Pow(Base, Out[0]) * A;
+    return true;
+}
+
+void Exponent::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    if (!N)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    Out.Emit(*N, Dest, 1.0);
+    Out.Push(FO_ExpBase, Dest, Dest, 0, Base);
+    Out.Scale(Dest, Dest, Factor * A);
 }
 
 bool Exponent::ComparesTo(const FunctionBase* Obj) const noexcept
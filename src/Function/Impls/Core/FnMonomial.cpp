@@ -1,4 +1,9 @@
 #include "../CoreFunctions.h"
+#include "../../FunctionProgram.h"
+#include "../../../Calc/SimdKernels.h"
+#include "../../../Calc/VectorMath.h"
+
+#include <algorithm>
 
 FnMonomial::FnMonomial(FunctionBase* InnerFunction, double Power, double A) : FunctionBase(!InnerFunction ? 0 : InnerFunction->InputDim, 1)
 {
@@ -43,7 +48,55 @@ MathVector FnMonomial::Evaluate(const MathVector& X, bool& Exists) const noexcep
     if (!Exists)
         return MathVector::ErrorVector();
 
-    return MathVector(A * pow(InnerEval[0], N));
+    return MathVector::FromList(A * pow(InnerEval[0], N));
+}
+
+void FnMonomial::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (!B)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    B->EvaluateBlock(X, Count, Out, Exists, Scratch);
+
+    double* y = Out[0];
+    if (N == 1.0)
+    {
+        for (size_t i = 0; i < Count; i++)
+            y[i] = A * y[i];
+    }
+    else if (N == 2.0)
+    {
+        for (size_t i = 0; i < Count; i++)
+            y[i] = A * (y[i] * y[i]);
+    }
+    else
+    {
+        VectorMath().PowConst(y, N, Count);
+        SimdKernels().Scale(y, A, Count);
+    }
+}
+bool FnMonomial::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (!B || !B->EvaluateDual(X, Directions, Out))
+        return false;
+
+    Out[0] = Dual::Pow(Out[0], N) * A;
+    return true;
+}
+
+void FnMonomial::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    if (!B)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    Out.Emit(*B, Dest, 1.0);
+    Out.Power(Dest, Dest, N, Factor * A);
 }
 
 [[nodiscard]] bool FnMonomial::ComparesTo(const FunctionBase* Obj) const noexcept
@@ -1,4 +1,9 @@
 #include "../CoreFunctions.h"
+#include "../../FunctionProgram.h"
+#include "../../../Calc/SimdKernels.h"
+#include "../../../Calc/VectorMath.h"
+
+#include <algorithm>
 
 Logarithm::Logarithm(FunctionBase* N, double Base, double A) : FunctionBase(!N ? 0 : N->InputDim, 1)
 {
@@ -40,7 +45,46 @@ MathVector Logarithm::Evaluate(const MathVector& X, bool& Exists) const noexcept
     if (!Exists)
         return MathVector::ErrorVector();
 
-    return MathVector(A * log(Result[0]) / log(Base));
+    return MathVector::FromList(A * log(Result[0]) / log(Base));
+}
+
+void Logarithm::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (!N)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    N->EvaluateBlock(X, Count, Out, Exists, Scratch);
+
+    double* y = Out[0];
+    for (size_t i = 0; i < Count; i++)
+        Exists[i] &= y[i] > 0.0;
+
+    VectorMath().Log(y, Count);
+    SimdKernels().Scale(y, A / log(Base), Count);
+}
+bool Logarithm::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (!N || !N->EvaluateDual(X, Directions, Out) || Out[0].Value <= 0.0)
+        return false;
+
+    Out[0] = Dual::Log(Out[0]) * (A / log(Base));
+    return true;
+}
+
+void Logarithm::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    if (!N)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    Out.Emit(*N, Dest, 1.0);
+    Out.Push(FO_RequirePositive, 0, Dest);
+    Out.Push(FO_Log, Dest, Dest, 0, Factor * A / log(Base)); //The change of base is folded into the factor.
 }
 
 bool Logarithm::ComparesTo(const FunctionBase* Obj) const noexcept
@@ -1,4 +1,9 @@
 #include "../CoreFunctions.h"
+#include "../../FunctionProgram.h"
+#include "../../../Calc/SimdKernels.h"
+#include "../../../Calc/VectorMath.h"
+
+#include <algorithm>
 
 Monomial::Monomial(unsigned int InputDim, unsigned int Var, double A, double N) : FunctionBase(InputDim, 1)
 {
@@ -15,7 +20,51 @@ MathVector Monomial::Evaluate(const MathVector& X, bool& Exists) const noexcept
         return MathVector::ErrorVector();
     }
 
-    return MathVector(A * pow(X[VarLetter], N));
+    Exists = true;
+    return MathVector::FromList(A * pow(X[VarLetter], N));
+}
+
+void Monomial::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (VarLetter >= InputDim)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    const double* x = X[VarLetter];
+    double* y = Out[0];
+    if (N == 1.0)
+    {
+        for (size_t i = 0; i < Count; i++)
+            y[i] = A * x[i];
+    }
+    else if (N == 2.0)
+    {
+        for (size_t i = 0; i < Count; i++)
+            y[i] = A * (x[i] * x[i]);
+    }
+    else
+    {
+        std::copy_n(x, Count, y);
+        VectorMath().PowConst(y, N, Count);
+        SimdKernels().Scale(y, A, Count);
+    }
+
+    std::fill_n(Exists, Count, 1);
+}
+bool Monomial::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (VarLetter >= InputDim)
+        return false;
+
+    Out[0] = Dual::Pow(X[VarLetter], N) * A;
+    return true;
+}
+
+void Monomial::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    Out.Power(Dest, Out.Input(VarLetter), N, Factor * A);
 }
 
 [[nodiscard]] bool Monomial::ComparesTo(const FunctionBase* Obj) const noexcept
@@ -1,4 +1,9 @@
 #include "../CoreFunctions.h"
+#include "../../FunctionProgram.h"
+#include "../../../Calc/SimdKernels.h"
+#include "../../../Calc/VectorMath.h"
+
+#include <algorithm>
 
 PFnMonomial::PFnMonomial(unsigned int InputDim, FunctionBase* B, FunctionBase* N, double A) : FunctionBase(InputDim, 1)
 {
@@ -72,7 +77,53 @@ MathVector PFnMonomial::Evaluate(const MathVector& X, bool& Exists) const noexce
     if (!Exists)
         return MathVector::ErrorVector();
 
-    return MathVector(A * pow(BaseV[0], PowerV[0]));
+    return MathVector::FromList(A * pow(BaseV[0], PowerV[0]));
+}
+
+void PFnMonomial::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (!B || !N)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    B->EvaluateBlock(X, Count, Out, Exists, Scratch);
+    BlockFrame PowerV(Scratch, 1);
+    N->EvaluateBlock(X, Count, PowerV.Rows(), PowerV.Exists(), Scratch);
+    CombineExists(Exists, PowerV.Exists(), Count);
+
+    VectorMath().Pow(Out[0], PowerV.Rows()[0], Count);
+    SimdKernels().Scale(Out[0], A, Count);
+}
+unsigned PFnMonomial::BlockScratchRows() const noexcept
+{
+    //The power is evaluated into a row of its own.
+    return 1 + FunctionBase::BlockScratchRows();
+}
+bool PFnMonomial::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    Dual PowerV;
+    if (!B || !N || !B->EvaluateDual(X, Directions, Out) || !N->EvaluateDual(X, Directions, &PowerV))
+        return false;
+
+    Out[0] = Dual::Pow(Out[0], PowerV) * A;
+    return true;
+}
+
+void PFnMonomial::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    if (!B || !N)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    unsigned PowerR = Out.Allocate();
+    Out.Emit(*B, Dest, 1.0);
+    Out.Emit(*N, PowerR, 1.0);
+    Out.Push(FO_Pow, Dest, Dest, PowerR);
+    Out.Scale(Dest, Dest, Factor * A);
 }
 
 FunctionBase* PFnMonomial::Clone() const noexcept
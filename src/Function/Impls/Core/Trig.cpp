@@ -1,4 +1,10 @@
 #include "../CoreFunctions.h"
+#include "../../FunctionProgram.h"
+#include "../../../Calc/SimdKernels.h"
+#include "../../../Calc/VectorMath.h"
+
+#include <algorithm>
+#include <limits>
 
 Trig::Trig(FunctionBase* Func, unsigned Type, double A) : FunctionBase(!Func ? 0 : Func->InputDim, 1)
 {
@@ -57,11 +63,11 @@ MathVector Trig::Evaluate(const MathVector& X, bool& Exists) const noexcept
                 return MathVector::ErrorVector();
             }
 
-            return MathVector( asin(Result) );
+            return MathVector::FromList( asin(Result) );
         }
 
         double Val = sin(Result);
-        return MathVector( A * (IsRecip ? 1 / Val : Val) );
+        return MathVector::FromList( A * (IsRecip ? 1 / Val : Val) );
     }
     case TrigFunc::Cosine:
     {
@@ -73,16 +79,16 @@ MathVector Trig::Evaluate(const MathVector& X, bool& Exists) const noexcept
                 return MathVector::ErrorVector();
             }
 
-            return MathVector(acos((Result)));
+            return MathVector::FromList(acos((Result)));
         }
 
-        double Val = sin(Result);
-        return MathVector( A * (IsRecip ? 1 / Val : Val) );
+        double Val = cos(Result);
+        return MathVector::FromList( A * (IsRecip ? 1 / Val : Val) );
     }
     case TrigFunc::Tangent:
     {
         if (IsInverse)
-            return MathVector(atan(Result));
+            return MathVector::FromList(atan(Result));
 
         double Val = tan(Result);
         if (Val == std::numeric_limits<double>::infinity())
@@ -91,7 +97,7 @@ MathVector Trig::Evaluate(const MathVector& X, bool& Exists) const noexcept
             return MathVector::ErrorVector();
         }
         else
-            return MathVector( A * (IsRecip ? 1 / Val : Val) );
+            return MathVector::FromList( A * (IsRecip ? 1 / Val : Val) );
     }
     default:
         Exists = false;
@@ -100,6 +106,153 @@ MathVector Trig::Evaluate(const MathVector& X, bool& Exists) const noexcept
 
 }
 
+void Trig::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (!N)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    N->EvaluateBlock(X, Count, Out, Exists, Scratch);
+
+    double* y = Out[0];
+    const auto& vm = VectorMath();
+    bool IsInverse = Type & TrigFunc::Inverse, IsRecip = Type & TrigFunc::Reciprocal;
+    unsigned type = Type & ~static_cast<unsigned>(TrigFunc::Inverse | TrigFunc::Reciprocal);
+    switch (type)
+    {
+    case TrigFunc::Sine:
+    case TrigFunc::Cosine:
+    {
+        bool IsSine = type == TrigFunc::Sine;
+        if (IsInverse)
+        {
+            for (size_t i = 0; i < Count; i++)
+                Exists[i] &= y[i] >= -1 && y[i] <= 1;
+
+            (IsSine ? vm.Asin : vm.Acos)(y, Count);
+        }
+        else
+            (IsSine ? vm.Sin : vm.Cos)(y, Count);
+        break;
+    }
+    case TrigFunc::Tangent:
+    {
+        if (IsInverse)
+            vm.Atan(y, Count);
+        else
+        {
+            vm.Tan(y, Count);
+            for (size_t i = 0; i < Count; i++)
+                Exists[i] &= y[i] != std::numeric_limits<double>::infinity();
+        }
+        break;
+    }
+    default:
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    //The inverse functions are not scaled, as in Evaluate.
+    if (IsInverse)
+        return;
+
+    if (IsRecip)
+    {
+        for (size_t i = 0; i < Count; i++)
+            y[i] = A / y[i];
+    }
+    else
+        SimdKernels().Scale(y, A, Count);
+}
+bool Trig::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (!N || !N->EvaluateDual(X, Directions, Out))
+        return false;
+
+    Dual& y = Out[0];
+    bool IsInverse = Type & TrigFunc::Inverse, IsRecip = Type & TrigFunc::Reciprocal;
+    unsigned type = Type & ~static_cast<unsigned>(TrigFunc::Inverse | TrigFunc::Reciprocal);
+    Dual Val;
+    switch (type)
+    {
+    case TrigFunc::Sine:
+    case TrigFunc::Cosine:
+    {
+        bool IsSine = type == TrigFunc::Sine;
+        if (IsInverse)
+        {
+            if (y.Value < -1 || y.Value > 1)
+                return false;
+
+            y = IsSine ? Dual::Asin(y) : Dual::Acos(y);
+            return true;
+        }
+
+        Val = IsSine ? Dual::Sin(y) : Dual::Cos(y);
+        break;
+    }
+    case TrigFunc::Tangent:
+    {
+        if (IsInverse)
+        {
+            y = Dual::Atan(y);
+            return true;
+        }
+
+        Val = Dual::Tan(y);
+        if (Val.Value == std::numeric_limits<double>::infinity())
+            return false;
+        break;
+    }
+    default:
+        return false;
+    }
+
+    y = (IsRecip ? Dual(1.0, Val.Directions()) / Val : Val) * A;
+    return true;
+}
+
+void Trig::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    if (!N)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    Out.Emit(*N, Dest, 1.0);
+
+    bool IsInverse = Type & TrigFunc::Inverse, IsRecip = Type & TrigFunc::Reciprocal;
+    unsigned type = Type & ~static_cast<unsigned>(TrigFunc::Inverse | TrigFunc::Reciprocal);
+    if (type > TrigFunc::Tangent)
+    {
+        Out.Push(FO_Fail, Dest);
+        return;
+    }
+
+    //As in Evaluate, the inverse functions ignore A and the reciprocal flag.
+    if (IsInverse)
+    {
+        if (type != TrigFunc::Tangent)
+            Out.Push(FO_RequireUnit, 0, Dest);
+
+        Out.Push(type == TrigFunc::Sine ? FO_Asin : (type == TrigFunc::Cosine ? FO_Acos : FO_Atan), Dest, Dest);
+        Out.Scale(Dest, Dest, Factor);
+        return;
+    }
+
+    Out.Push(type == TrigFunc::Sine ? FO_Sin : (type == TrigFunc::Cosine ? FO_Cos : FO_Tan), Dest, Dest);
+    if (type == TrigFunc::Tangent)
+        Out.Push(FO_RequireFinite, 0, Dest);
+
+    if (IsRecip)
+        Out.Push(FO_Recip, Dest, Dest, 0, Factor * A);
+    else
+        Out.Scale(Dest, Dest, Factor * A);
+}
+
 bool Trig::ComparesTo(const FunctionBase* Obj) const noexcept
 {
     const auto* conv = dynamic_cast<const Trig*>(Obj);
@@ -8,6 +8,7 @@ class MATH_LIB Constant : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Child) noexcept override;
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
 public:
     explicit Constant(unsigned int InputDim, double A = 1.0);
@@ -18,6 +19,8 @@ public:
     Constant& operator=(Constant&& Obj) = delete;
 
     MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -39,6 +42,7 @@ class MATH_LIB Monomial : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Obj) noexcept override { }
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
 public:
     Monomial(unsigned int InputDim, unsigned int Var, double A = 1.0, double N = 1.0);
@@ -52,6 +56,8 @@ public:
     unsigned int VarLetter = 0;
 
     MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -65,6 +71,7 @@ class MATH_LIB FnMonomial : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Obj) noexcept override;
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
     FunctionBase* B = nullptr;
 public:
@@ -81,6 +88,8 @@ public:
     double N = 0.0;
 
     MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -94,6 +103,7 @@ class MATH_LIB PFnMonomial : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Obj) noexcept override;
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
     FunctionBase* B = nullptr, * N = nullptr;
 public:
@@ -113,6 +123,9 @@ public:
     void Power(FunctionBase* New);
 
     MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    [[nodiscard]] unsigned BlockScratchRows() const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -126,6 +139,7 @@ class MATH_LIB AbsoluteValue : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Child) noexcept override;
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
     FunctionBase* N = nullptr;
 public:
@@ -141,6 +155,8 @@ public:
     void Base(FunctionBase* NewN);
 
     MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -154,6 +170,7 @@ class MATH_LIB Exponent : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Obj) noexcept override;
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
     FunctionBase* N = nullptr;
 public:
@@ -170,6 +187,8 @@ public:
     void Power(FunctionBase* NewFunction);
 
     MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -183,6 +202,7 @@ class MATH_LIB Logarithm : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Child) noexcept override;
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
     FunctionBase* N = nullptr;
 public:
@@ -199,6 +219,8 @@ public:
     void Function(FunctionBase* Obj);
 
     MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -221,6 +243,7 @@ class MATH_LIB Trig : public FunctionBase
 {
 private:
     void ChildRemoved(FunctionBase* Obj) noexcept override;
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
     unsigned Type;
     FunctionBase* N = nullptr;
@@ -238,6 +261,8 @@ public:
     void Function(FunctionBase* NewObj);
 
     MathVector Evaluate(const MathVector& X, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../../Calc/StdCalc.h"
+#include "../FunctionCommon.h"
 
 class MATH_LIB FunctionBase;
 
@@ -1,4 +1,7 @@
 #include "VectorFunction.h"
+#include "../FunctionProgram.h"
+
+#include <algorithm>
 
 VectorFunction::VectorFunction(unsigned int InputDim, unsigned int OutputDim) : FunctionBase(InputDim, OutputDim)
 {
@@ -40,6 +43,11 @@ void VectorFunction::ChildRemoved(FunctionBase* Item) noexcept
         }
     }
 }
+bool VectorFunction::AcceptsChild(const FunctionBase& New) const noexcept
+{
+    //Each component is a function with one output.
+    return New.InputDim == this->InputDim && New.OutputDim == 1;
+}
 
 const FunctionBase& VectorFunction::operator[](unsigned i) const
 {
@@ -100,6 +108,66 @@ MathVector VectorFunction::Evaluate(const MathVector& In, bool& Exists) const no
     return Return;
 }
 
+void VectorFunction::EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept
+{
+    if (!Func)
+    {
+        std::fill_n(Exists, Count, 0);
+        return;
+    }
+
+    //Each component function writes straight into its own output row.
+    std::fill_n(Exists, Count, 1);
+    BlockFrame Component(Scratch, 1);
+    for (unsigned int i = 0; i < OutputDim; i++)
+    {
+        if (!Func[i])
+        {
+            std::fill_n(Exists, Count, 0);
+            return;
+        }
+
+        Func[i]->EvaluateBlock(X, Count, Out + i, Component.Exists(), Scratch);
+        CombineExists(Exists, Component.Exists(), Count);
+    }
+}
+unsigned VectorFunction::BlockScratchRows() const noexcept
+{
+    //The components are kept in Func rather than found by walking the children, and each needs the flags of one row for its existence.
+    unsigned Rows = 0;
+    for (unsigned i = 0; Func && i < OutputDim; i++)
+        if (Func[i])
+            Rows = std::max(Rows, Func[i]->BlockScratchRows());
+
+    return 1 + Rows;
+}
+bool VectorFunction::EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept
+{
+    if (!Func)
+        return false;
+
+    //Each component gives one row of the Jacobian.
+    for (unsigned i = 0; i < OutputDim; i++)
+        if (!Func[i] || !Func[i]->EvaluateDual(X, Directions, Out + i))
+            return false;
+
+    return true;
+}
+
+void VectorFunction::Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const
+{
+    for (unsigned int i = 0; i < OutputDim; i++)
+    {
+        if (!Func || !Func[i])
+        {
+            Out.Push(FO_Fail, Dest);
+            return;
+        }
+
+        Out.Emit(*Func[i], Dest + i, Factor);
+    }
+}
+
 bool VectorFunction::ComparesTo(const FunctionBase* Obj) const noexcept
 {
     const auto* conv = dynamic_cast<const VectorFunction*>(Obj);
@@ -16,6 +16,8 @@ private:
     FunctionBase** Func = nullptr;
 protected:
     void ChildRemoved(FunctionBase* Item) noexcept override;
+    bool AcceptsChild(const FunctionBase& New) const noexcept override;
+    void Emit(FunctionCompiler& Out, unsigned Dest, double Factor) const override;
 
 public:
     VectorFunction(unsigned int InputDim, unsigned int OutputDim) ;
@@ -34,6 +36,9 @@ public:
     [[nodiscard]] [[maybe_unused]] FunctionBase& operator[](unsigned i);
 
     MathVector Evaluate(const MathVector& In, bool& Exists) const noexcept override;
+    void EvaluateBlock(const double* const* X, size_t Count, double* const* Out, unsigned char* Exists, BlockScratch& Scratch) const noexcept override;
+    [[nodiscard]] unsigned BlockScratchRows() const noexcept override;
+    bool EvaluateDual(const Dual* X, size_t Directions, Dual* Out) const noexcept override;
 
     [[nodiscard]] bool ComparesTo(const FunctionBase* Obj) const noexcept override;
     [[nodiscard]] bool EquatesTo(const FunctionBase* Obj) const noexcept override;
@@ -306,7 +306,7 @@ std::optional<PackageEntryKey> Package::AddEntry(std::string elementName, Packag
         return {};
 
     PackageEntryKey key(this->packID, this->currID + 1); //NOTE: If this function succedes, we need to truly increment currID. This is in case we fail, we can keep that key slot open.
-    unsigned needed_pages = !data ? 1 : data->RequiredUnits();
+    unsigned needed_pages = !data ? 1 : data->RequiredUnits(this->pager.UnitSize());
     if (!this->pager.Register(key))
         return {};
 
@@ -323,7 +323,7 @@ std::optional<PackageEntryKey> Package::AddEntry(std::string elementName, Packag
             ),
         std::weak_ptr<PackageReference>(ref));
 
-    result.Data(std::move(data));
+    result.Data(Value(std::move(data)));
     this->entries.emplace_back( std::move(result) );
 
     (void)this->GetNextID(); //Truly increment the ID
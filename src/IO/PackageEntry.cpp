@@ -35,15 +35,14 @@ bool PackageEntry::WriteData(PackagePager& pager) noexcept
     bool result = false;
     if (this->data)
     {
-        VariableType* obj = this->data->get();
-        unsigned needed = obj->RequiredUnits();
-        if (!pager.EnsureAllocation(needed)) 
-            return false;
-
-        if (obj)
+        if (!this->data->IsEmpty())
         {
+            unsigned needed = this->data->RequiredUnits(pager.UnitSize());
+            if (!pager.EnsureAllocation(needed)) 
+                return false;
+
             pager.MoveRelative(0);
-            result = pager.WriteUnits(obj->ToBinary());
+            result = pager.WriteUnits(this->data->ToBinary(pager.UnitSize()));
         }
         else 
             result = pager.WipeAll();
@@ -56,10 +55,8 @@ bool PackageEntry::DisplayData(std::ostream& out) const noexcept
 {
     if (!this->data.has_value())
         out << "(Unloaded)";
-    else if (!(*this->data))
-        out << "NULL";
     else
-        (*this->data)->Print(out);
+        out << *this->data;
 
     return !out.bad();
 }
@@ -101,9 +98,9 @@ void PackageEntry::Load(PackagePager& in)
 
     std::vector<Unit> allUnits = in.ReadAllUnits();
     if (allUnits.empty() || this->index.data_type == VT_None)
-        this->data = nullptr;
+        this->data = Value();
     else 
-        this->data = VariableType::FromBinary(allUnits, this->index.data_type);
+        this->data = Value::FromBinary(allUnits, this->index.data_type);
 }
 bool PackageEntry::LoadNoThrow(std::string& message) noexcept
 { 
@@ -123,9 +120,6 @@ bool PackageEntry::Unload() noexcept
     if (!this->WriteData())
         return false;
 
-    if (this->data.has_value())
-        this->data.value().reset();
-
     this->data = {};
     return true;
 }
@@ -140,21 +134,21 @@ void PackageEntry::Reset() noexcept
     Unload();
 }
 
-const VariableType& PackageEntry::Data() const
+const Value& PackageEntry::Data() const
 {
     if (!this->data.has_value())
         throw std::logic_error("The data contained is not loaded.");
-    else if (! *(this->data))
+    else if (this->data->IsEmpty())
         throw std::logic_error("This package entry contains no data.");
 
-    return *(*this->data);
+    return *this->data;
 }
-void PackageEntry::Data(std::unique_ptr<VariableType>&& New) noexcept
+void PackageEntry::Data(Value New) noexcept
 {
     Unload();
 
+    this->index.data_type = New.IsEmpty() ? VT_None : New.GetType();
     this->data = std::move(New);
-    this->index.data_type = !this->data ? VT_None : (*this->data)->GetType();
     this->modified = true;
 }
 
@@ -164,7 +158,7 @@ bool PackageEntry::IsLoaded() const noexcept
 }
 std::optional<bool> PackageEntry::HasData() const noexcept
 {
-    return !this->data ? std::optional<bool>() : *this->data != nullptr;
+    return !this->data ? std::optional<bool>() : !this->data->IsEmpty();
 }
 bool PackageEntry::IsModified() const noexcept
 {
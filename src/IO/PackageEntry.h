@@ -11,7 +11,7 @@
 
 #include "PackageEntryKey.h"
 #include "PackageEntryIndex.h"
-#include "../Calc/VariableType.h"
+#include "../Calc/Value.h"
 
 class PackageReference;
 class Package;
@@ -20,7 +20,7 @@ class PackagePager;
 class PackageEntry
 {
 private:
-    std::optional<std::unique_ptr<VariableType>> data = {};
+    std::optional<Value> data = {}; //Unloaded when empty; loaded with no data when it holds an empty Value.
     std::weak_ptr<PackageReference> parent;
     PackageEntryIndex index;
     bool modified = false;
@@ -52,8 +52,9 @@ public:
     /// @brief Deletes 'Data' from memory & the file system.
     void Reset() noexcept;
 
-    [[nodiscard]] const VariableType& Data() const;
-    void Data(std::unique_ptr<VariableType>&& New) noexcept;
+    /// @brief The loaded data. Copying the result shares vector and matrix buffers with this entry.
+    [[nodiscard]] const Value& Data() const;
+    void Data(Value New) noexcept;
 
     [[nodiscard]] bool IsLoaded() const noexcept;
     [[nodiscard]] std::optional<bool> HasData() const noexcept;
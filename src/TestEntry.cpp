@@ -0,0 +1,40 @@
+//
+// Created by exdisj on 10/17/26.
+//
+
+#include <cstring>
+#include <iostream>
+
+#include "Calc/NumericsTester.h"
+#include "Function/FunctionTester.h"
+
+int main(int argc, char** argv)
+{
+    struct Suite
+    {
+        const char* Name;
+        bool (*Run)() noexcept;
+    };
+    const Suite Suites[] = {
+        { "numerics", NumericsTester },
+        { "functions", FunctionTester }
+    };
+
+    //With no arguments every suite runs, otherwise only the ones named.
+    int Failed = 0;
+    for (const Suite& Curr : Suites)
+    {
+        bool Selected = argc == 1;
+        for (int i = 1; i < argc; i++)
+            Selected |= std::strcmp(argv[i], Curr.Name) == 0;
+
+        if (!Selected)
+            continue;
+
+        bool Passed = Curr.Run();
+        std::cout << Curr.Name << ": " << (Passed ? "passed" : "FAILED") << std::endl;
+        Failed += !Passed;
+    }
+
+    return Failed == 0 ? 0 : 1;
+}